@@ -27,6 +27,7 @@
 #include <math.h>    // ceil, M_LOG2E
 #include <stdio.h>   // printf, fprintf, sprintf, fwrite, FILE
 #include <stdlib.h>  // atoi, free 
+#include <limits.h>  // INT_MAX
 #ifndef HAVE_STDBOOL_H
 #include <stdbool.h> // true, false
 #endif
@@ -74,6 +75,9 @@ typedef unsigned char BYTE;	// Unsigned Char
 #define ID_RGBAZ88		5	// ID for RGBAZ  88-bit	
 #define ID_RGBA64		6	// ID for RGBA   64-bit	
 #define ID_RGBAZ96		7	// ID for RGBAZ  96-bit	
+#define ID_RGBA128_PLANAR	8	// ID for RGBA  128-bit (Planar: R, G, B, A planes)	
+#define ID_RGBAZ160_PLANAR	9	// ID for RGBAZ 160-bit (Planar: R, G, B, A, Z planes)	
+#define NUM_PIXEL_IDS		10	// Number of Pixel IDs
 
 #define RGBA32			4	//  4 Bytes ( Byte  RGBA : 4 * 1 Byte  )
 #define RGBAZ64			8	//  8 Bytes ( Byte  RGBA Float Z: 4 * 1 Byte + 1 * 4 Bytes )
@@ -92,6 +96,9 @@ typedef unsigned char BYTE;	// Unsigned Char
 #define LEFT  			0	// Node on the left side  
 #define RIGHT 			1	// Node on the right side
 
+#define OVER  			0	// Image in front
+#define UNDER 			1	// Image behind
+
 #define ALPHA_BtoF	 	-1	// Alpha-blending (OLD)
 #define ALPHA		 	0	// Alpha-blending
 #define DEPTH   	      	1	// Z-depth Sorting
@@ -99,50 +106,44 @@ typedef unsigned char BYTE;	// Unsigned Char
 #define DEPTH_ROI  	    	3	// Z-depth Sorting with ROI
 #define ALPHA_COMPRESS		4	// Alpha-blending with COMPRESSION
 #define DEPTH_COMPRESS		5	// Z-depth Sorting with COMPRESSION
+#define ALPHA_SPARSE		6	// Alpha-blending with Active-pixel (SPAN) encoding
 // Other Pixel Merging Modes
 
+#define FILE_RAW		0	// Header ( "234C\n" width height pixel_ID ) + Pixels
+#define FILE_PNM		1	// PPM ( BYTE Pixels ) or PFM ( Float Pixels ): RGB only
+
 // ======================================
-//	    VARIABLES (Image Data ) 
+//	    COMPOSITING CONTEXT
 // ======================================
 
-BYTE *temp_image_rgba32;		// Temporary Image Data (RGBA32 Pixels)
-BYTE *temp_image_rgba32_ptr;	// Pointer for the Temporary Image Data (RGBA32 Pixels)
-
-BYTE *temp_image_rgba56;		// Temporary Image Data (RGBA56 Pixels)
-BYTE *temp_image_rgba56_ptr;	// Pointer for the Temporary Image Data (RGBA56 Pixels)
-
-BYTE *temp_image_rgba64;		// Temporary Image Data (RGBA64 Pixels)
-BYTE *temp_image_rgba64_ptr;	// Pointer for the Temporary Image Data (RGBA64 Pixels)
-
-BYTE *temp_image_rgbaz64;		// Temporary Image Data (RGBAZ64 Pixels)
-BYTE *temp_image_rgbaz64_ptr;	// Pointer for the Temporary Image Data (RGBAZ64 Pixels)
-
-BYTE *temp_image_rgbaz88;		// Temporary Image Data (RGBAZ88 Pixels)
-BYTE *temp_image_rgbaz88_ptr;	// Pointer for the Temporary Image Data (RGBAZ88 Pixels)
-
-BYTE *temp_image_rgbaz96;		// Temporary Image Data (RGBAZ96 Pixels)
-BYTE *temp_image_rgbaz96_ptr;	// Pointer for the Temporary Image Data (RGBAZ96 Pixels)
-
-BYTE *temp_image_byte_ptr;		// Pointer for the Temporary Image Data (BYTE)
-
-float *temp_image_rgba128;		// Temporary Image Data (RGBA128 Pixels)
-float *temp_image_rgba128_ptr;	// Pointer for the Temporary Image Data (RGBA128 Pixels)
-
-float *temp_image_rgbaz160;		// Temporary Image Data (RGBAZ160 Pixels)
-float *temp_image_rgbaz160_ptr;	// Pointer for the Temporary Image Data (RGBAZ160 Pixels)
-
-float *temp_image_float_ptr;	// Pointer for the Temporary Image Data (FLOAT) 
-
-unsigned int global_width;		// Image width
-unsigned int global_height;		// Image height
+// Image buffers, sizes and communicators of one composition 
+// ( Opaque for the application. See context.h )
+typedef struct Compositor234_Context Compositor234_Context;
 
-unsigned int global_num_pixels;	// Number of pixels ( Image size )
-unsigned int global_image_size;	// image size ( Number of pixels * image_type )
+// ======================================
+//	    COMPOSITION STATISTICS
+// ======================================
 
-unsigned int global_mod_pixels; // Remainder pixels (Number of pixels mod Number of nodes)
-unsigned int global_add_pixels; // Added pixels to complete a divisible number of pixels
+#define STATS_MAX_STAGES	32	// Binary-Swap stages ( Radix-k rounds ) recorded
+
+// Statistics of the last composition of a node ( See Get_234Composition_Stats )
+// Times in seconds ( MPI_Wtime )
+typedef struct
+{
+	double total_time;			// Whole composition, final image gathering included
+	double partial_time;			// 2-3-4 partial stage ( and 3 node Direct-Send )
+	double stage_time[ STATS_MAX_STAGES ];	// Each Binary-Swap stage ( or Radix-k round )
+	unsigned int num_stages;		// Number of entries of stage_time
+	double gather_time;			// Final image gathering
+	double blend_time;			// Compositing stages outside MPI waits ( blending and copies )
+	double wait_time;			// Blocked in MPI waits and blocking sends and receives
+
+	unsigned long long bytes_sent;		// Image data sent to the pair nodes ( final gathering excluded )
+	unsigned long long bytes_received;	// Image data received from the pair nodes
+	unsigned long long compress_raw_bytes;	// Image data given to the RLE compression ( ALPHA_COMPRESS, DEPTH_COMPRESS )
+	unsigned long long compress_bytes;	// Same data after the compression ( Ratio: compress_raw_bytes / compress_bytes )
+} Compositor234_Stats;
 
-unsigned int global_image_type;	// Image type ( RGBA32, RGBAZ_64, RGBA128, RGBAZ160 )
 unsigned int pixel_ID;			// pixel ID (ID_RGBA32, ID_RGBAZ64, ID_RGBA128, ID_RGBAZ160)
 
 // ======================================
@@ -160,114 +161,31 @@ unsigned int pixel_ID;			// pixel ID (ID_RGBA32, ID_RGBAZ64, ID_RGBA128, ID_RGBA
 #define PAIR_12_TAG	104 	// MPI Communicator Tag ( Nodes 1 and 2 )
 #define PAIR_13_TAG	105 	// MPI Communicator Tag ( Nodes 1 and 3 )
 
-// ======================================
-//	    VARIABLES ( MPI related ) 
-// ======================================
-
-MPI_Status  global_status;	// Status object for MPI_Recv
-MPI_Request global_isend;	// ISend request parameter
-MPI_Request global_irecv;	// IRecv request parameter
-
-_Bool is_power_of_two; 		// Check wether is power-of-two (2^n)
+// Non-blocking Composition ( 2 Tags per composition in progress )
+#define ICOMP_TAG	110 	// MPI Communicator Tag ( First Tag )
+#define ICOMP_MAX_TAGS	1024 	// Number of compositions with different Tags
 
-// ======================================
-//	    TRADITIONAL GATHERV 
-//	 Final image gathering (MPI_Gatherv)
-// ======================================
-
-unsigned int bs_counts;			// Data counts information for MPI_Gatherv				
-unsigned int bs_offset;			// Offset information for MPI_Gatherv
+// Pipelined Binary-Swap exchange
+#define BSWAP_CHUNK_SIZE 1048576 	// Default message size in bytes ( 1 MiB )
 
-int *bs_gatherv_offset;			// List of offset data for MPI_Gatherv
-int *bs_gatherv_counts;			// List of data counts information for MPI_Gatherv 
-int *bs_gatherv_counts_offset;		// List of data counts information for MPI_Gatherv 
-
-int *bs_gatherv_offset_ptr;		// Pointer for bs_gatherv_offset
-int *bs_gatherv_counts_ptr;		// Pointer for bs_gatherv_counts
-int *bs_gatherv_counts_offset_ptr;	// Pointer for bs_gatherv_counts
-
-// ======================================
-//		    BIT-REVERSAL 
-//	 Final image gathering (MPI_Gather)
-// ======================================
-
-MPI_Comm MPI_COMM_BITREV; 	// MPI Communicator (Bit-reversal rank order)
-
-int bitrev_my_rank;		// My Rank (MPI_COMM_BITREV)
-int bitrev_nnodes;		// Num Nodes (MPI_COMM_BITREV)
-
-int bitrev_my_group;		// Group(Color) for MPI_Comm_split
-
-//==========================
-// Not even image size
-//==========================
-BYTE* send_byte_pixel_ptr;	// Pointer for remaining pixels (BYTE) to be sent	
-BYTE* recv_byte_pixel_ptr;	// Pointer to receive remaining pixels (BYTE) 
-
-float* send_float_pixel_ptr;	// Pointer for remaining pixels (float) to be sent	
-float* recv_float_pixel_ptr;	// Pointer to receive remaining pixels (float) 
-
-// ======================================
-//	    2-3-4 Decomposition
-// ======================================
-
-unsigned int near_pow2;		// Nearest power of two smaller than total number of nodes
-
-unsigned int ngroups_234;	// Number of groups
-unsigned int base_234;		// Base for 2-3-4 Decomposition
-unsigned int over_234;		// Nodes over threshold
-unsigned int threshold_234;	// Threshold for 2-3-4 Decomposition (3)
-
-//==========================
-MPI_Comm MPI_COMM_234; 		// MPI Communicator (Groups of 2, 3 or 4)
-
-int my_rank_234;		// My Rank (Groups of 2, 3 or 4)
-int nnodes_234;			// Num Nodes (Groups of 2, 3 or 4)
-
-unsigned int my_group_234;	// Group(Color) for MPI_Comm_split
-//==========================
-
-// ======================================
-//	    2nd stage Binary-Swap
-// ======================================
-int *group_bswap;			// List of nodes (2nd stage Binary-Swap) 
-int *group_bswap_ptr;			// Pointer for group_bswap
-
-MPI_Group MPI_GROUP_WORLD;		// Group (Entire nodes)
-MPI_Group MPI_GROUP_STAGE2_BSWAP;	// Group (2nd stage Binary-Swap)
-
-//==========================
-MPI_Comm  MPI_COMM_STAGE2_BSWAP;	// MPI Communicator (2nd stage Binary-Swap)
-
-int stage2_bswap_my_rank;		// My Rank (2nd stage Binary-Swap)
-int stage2_bswap_nnodes; ;		// Num Nodes (2nd stage Binary-Swap)
-
-MPI_Comm  MPI_COMM_STAGE2_BITREV;	// MPI Communicator (2nd stage Bit-Reversed Binary-Swap)
-
-int stage2_bitrev_my_rank;		// My Rank (2nd stage Binary-Swap)
-int stage2_bitrev_nnodes; ;		// Num Nodes (2nd stage Binary-Swap)
-//==========================
-
-// ======================================
-//	    BIT-REVERSAL  (for MPI_Gather)
-// ======================================
-MPI_Comm MPI_COMM_MSTEP1_BITREV; // MPI Communicator (Step 1 w/ Bit-reversal rank order)
-MPI_Comm MPI_COMM_MSTEP2_BITREV; // MPI Communicator (Step 2 w/ Bit-reversal rank order)
-
-int bitrev_mstep1_my_rank;	// My Rank   (MPI_COMM_MSTEP1_BITREV)
-int bitrev_mstep1_nnodes;	// Num Nodes (MPI_COMM_MSTEP1_BITREV)
-
-int bitrev_mstep2_my_rank;	// My Rank   (MPI_COMM_MSTEP2_BITREV)
-int bitrev_mstep2_nnodes;	// Num Nodes (MPI_COMM_MSTEP2_BITREV)
-
-int bitrev_mstep1_my_group;	// Group(Color) for MPI_Comm_split
-int bitrev_mstep2_my_group;	// Group(Color) for MPI_Comm_split
+// Placement order ( Set_234Composition_Placement )
+#define PLACEMENT_MAX_DIMS	8	// Maximum number of network coordinates per node
 
 // ======================================
 //		K_234Composition API
 // ======================================
 int Init_234Composition  ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int ); 
 			// my_rank, nnodes, width, height, pixel_ID 
+
+// Hierarchical composition: the ranks of every node ( MPI_COMM_TYPE_SHARED ) composite 
+// their images in a shared memory window, then only one rank per node takes part in the 
+// 234 + Binary-Swap. The ranks of every node must be consecutive in MPI_COMM_WORLD 
+// ( otherwise Init_234Composition ). Used by Do_234Composition ( Interleaved pixel types ).
+int Init_234Composition_Hierarchical ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int ); 
+			// my_rank, nnodes, width, height, pixel_ID 
+void* Get_234Composition_Shared_Image ( void ); 
+			// My image in the shared memory window ( can be rendered into directly ) 
+
 // Do image composition
 int  Do_234Composition  ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, MPI_Comm ); 
 			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image_byte, MPI_COMM 
@@ -277,10 +195,89 @@ int  Do_234ZComposition  ( unsigned int, unsigned int, unsigned int, unsigned in
 
 void* Do_234Composition_Ptr ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, MPI_Comm ); 
 			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image_byte, MPI_COMM 	
+			// The returned image (ROOT_NODE) belongs to the library and is valid until the next 
+			// composition or Destroy_234Composition ( NULL on the other nodes or on error )
+
+// Borrowed view of the gathered image (ROOT_NODE, NULL on the other nodes): no copy to 
+// my_image. The compositions fail until the view is given back by Release_234Composition_View.
+int  Do_234Composition_View ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, void**, MPI_Comm ); 
+			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, **view, MPI_COMM 
+int  Release_234Composition_View ( void* ); 
+			// *view 
+
+// Output buffer of Do_234Composition: the final image gathering lands in it ( no copy to 
+// my_image ). It must hold Get_234Composition_Output_Size bytes ( blank pixels included ).
+int  Set_234Composition_Output ( void*, size_t ); 
+			// *output_image ( NULL: my_image ), output_size 
+size_t Get_234Composition_Output_Size ( void ); 
+
+// Tiled composition: the image is composited in bands of tile_height rows, so the 
+// temporary buffers only hold one tile ( Init_234Composition with width, tile_height ).
+// The ROOT_NODE passes each finished tile to store_tile ( NULL: copied into my_image ). 
+// With load_tile, every node reads each tile of its image from load_tile ( my_image unused ).
+// ( Interleaved pixel types )
+typedef int (*Compositor234_TileFunc) ( void*, unsigned int, unsigned int, unsigned int, void* ); 
+			// *tile_image, tile_y, width, tile_height, *user_data ( EXIT_SUCCESS or EXIT_FAILURE )
+
+int  Do_234Composition_Tiled ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, \
+			       Compositor234_TileFunc, Compositor234_TileFunc, void*, MPI_Comm ); 
+			// my_rank, nnodes, width, height, tile_height, pixel_ID, merge_ID, *my_image, load_tile, store_tile, *user_data, MPI_COMM 
+
+// Parallel file output: every node writes its composited region to the file 
+// ( MPI-IO collective write ) instead of gathering the image on the ROOT_NODE.
+// The rows are written in memory order. ( Interleaved pixel types )
+int  Do_234Composition_File ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, \
+			      const char*, unsigned int, MPI_Comm ); 
+			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, *file_name, file_format, MPI_COMM 
+
+// Distributed result: no final image gathering ( Runtime equivalent of _NOGATHER ). 
+// Every node gets its composited region: pixels [ offset, offset + counts ) of the image 
+// ( NULL and 0 pixels: None ), valid until the next composition. ( Interleaved pixel types )
+int  Do_234Composition_Distributed ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, \
+				     void**, size_t*, size_t*, MPI_Comm ); 
+			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, **my_region, *my_offset, *my_counts, MPI_COMM 
+
+// Set the ROI of my image for the next composition (ALPHA_ROI and DEPTH_ROI)
+int Set_234Composition_ROI ( unsigned int, unsigned int, unsigned int, unsigned int ); 
+			// x, y, roi_width, roi_height 
+
+// Set the number of pixels per message of the pipelined Binary-Swap exchange
+int Set_234Composition_Chunk ( unsigned int, unsigned int ); 
+			// pixel_ID, chunk_pixels ( 0: BSWAP_CHUNK_SIZE bytes ) 
+
+// Use Radix-k instead of Binary-Swap (ALPHA and DEPTH)
+int Set_234Composition_Radix ( unsigned int ); 
+			// radix ( power-of-two; 0 or 2: Binary-Swap ) 
+
+// Set the domain of each node and the view direction: Do_234ZComposition (ALPHA)
+// then uses their visibility order, cached until one of them changes
+int Set_234Composition_Domain ( unsigned int, unsigned int, const float*, MPI_Comm ); 
+			// my_rank, nnodes, *bounds ( x, y, z min and x, y, z max ), MPI_COMM 
+int Set_234Composition_View ( const float* ); 
+			// *view_direction ( x, y, z ) 
+
+// Set the placement of the nodes in the network: the 2-3-4 groups and the Binary-Swap 
+// partners of Do_234Composition are then chosen among close nodes ( Z-order curve of the 
+// coordinates ). Only used for RGBAZ64 ( depth sorting does not depend on the rank order ).
+int Set_234Composition_Placement ( unsigned int, unsigned int, const int*, unsigned int, MPI_Comm ); 
+			// my_rank, nnodes, *my_coords ( NULL: Shared memory node ), ndims, MPI_COMM 
 	
 int Destroy_234Composition ( unsigned int );
 			// pixel_ID )
 
+// The image buffers are kept by Destroy_234Composition for the next Init_234Composition 
+// ( Same or smaller image ). Release_234Composition_Memory frees them.
+int Release_234Composition_Memory ( void ); 
+
+// Statistics of the last composition of my node ( Interleaved and planar pixel types. 
+// Not recorded by the non-blocking composition ). Reduce_234Composition_Stats combines 
+// them field by field over the nodes of MPI_COMM ( MPI_MAX, MPI_MIN or MPI_SUM ): every 
+// node gets the result ( collective ).
+int Get_234Composition_Stats ( Compositor234_Stats* ); 
+			// *stats 
+int Reduce_234Composition_Stats ( Compositor234_Stats*, MPI_Op, MPI_Comm ); 
+			// *stats, MPI_OP, MPI_COMM 
+
 // Initialize variables and image buffer for 234 Image Compositing 
 int Init_234Composition_FLOAT ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int ); 
 				// my_rank, nnodes, width, height, pixel_ID
@@ -304,14 +301,130 @@ int  Do_234Composition_Core_FLOAT ( unsigned int, unsigned int, unsigned int, un
 				// my_rank, nnodes, width, height, pixel_ID, *my_image_float,  MPI_COMM 	
 
 int Destroy_234Composition_FLOAT ( unsigned int );
+
+// Do image composition (Planar Pixels)
+int  Do_234Composition_Core_PLANAR ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float*, float*, MPI_Comm );
+				// my_rank, nnodes, width, height, pixel_ID, *my_depth_plane, *my_image_float,  MPI_COMM 	
 //=====================================
 
-unsigned int global_my_rank;
-unsigned int global_nnodes;
+// ======================================
+//	  K_234Composition API (Context)
+// ======================================
+// Same as the API above, but working on the given context instead 
+// of the default one. Each context has its own image buffers and 
+// communicators, so several compositions (e.g. different image 
+// sizes or pixel types) can be kept at the same time or run from 
+// different threads (MPI_THREAD_MULTIPLE and one communicator per 
+// context are then required).
+
+int Init_234Composition_Context ( Compositor234_Context**, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int ); 
+			// *context, my_rank, nnodes, width, height, pixel_ID 
+
+int Init_234Composition_Hierarchical_Context ( Compositor234_Context**, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int ); 
+			// *context, my_rank, nnodes, width, height, pixel_ID 
+
+void* Get_234Composition_Shared_Image_Context ( Compositor234_Context* ); 
+			// context 
+
+int Do_234Composition_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image_byte, MPI_COMM 
+
+int Do_234ZComposition_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, const float*, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image_byte, *my_image_depth, MPI_COMM 
+
+void* Do_234Composition_Ptr_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image_byte, MPI_COMM 	
+
+int Do_234Composition_View_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, void**, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, **view, MPI_COMM 
+
+int Release_234Composition_View_Context ( Compositor234_Context*, void* ); 
+			// context, *view 
+
+int Set_234Composition_Output_Context ( Compositor234_Context*, void*, size_t ); 
+			// context, *output_image, output_size 
+
+size_t Get_234Composition_Output_Size_Context ( Compositor234_Context* ); 
+			// context 
+
+int Do_234Composition_Tiled_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, \
+				      unsigned int, unsigned int, void*, Compositor234_TileFunc, Compositor234_TileFunc, void*, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, tile_height, pixel_ID, merge_ID, *my_image, load_tile, store_tile, *user_data, MPI_COMM 
+
+int Do_234Composition_File_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, \
+				     unsigned int, void*, const char*, unsigned int, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, *file_name, file_format, MPI_COMM 
+
+int Do_234Composition_Distributed_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, \
+					    unsigned int, void*, void**, size_t*, size_t*, MPI_Comm ); 
+			// context, my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, **my_region, *my_offset, *my_counts, MPI_COMM 
+
+int Set_234Composition_ROI_Context ( Compositor234_Context*, unsigned int, unsigned int, unsigned int, unsigned int ); 
+			// context, x, y, roi_width, roi_height 
+
+int Set_234Composition_Chunk_Context ( Compositor234_Context*, unsigned int, unsigned int ); 
+			// context, pixel_ID, chunk_pixels 
+
+int Set_234Composition_Radix_Context ( Compositor234_Context*, unsigned int ); 
+			// context, radix 
+
+int Set_234Composition_Domain_Context ( Compositor234_Context*, unsigned int, unsigned int, const float*, MPI_Comm ); 
+			// context, my_rank, nnodes, *bounds, MPI_COMM 
+
+int Set_234Composition_View_Context ( Compositor234_Context*, const float* ); 
+			// context, *view_direction 
+
+int Set_234Composition_Placement_Context ( Compositor234_Context*, unsigned int, unsigned int, const int*, unsigned int, MPI_Comm ); 
+			// context, my_rank, nnodes, *my_coords, ndims, MPI_COMM 
+
+int Destroy_234Composition_Context ( Compositor234_Context*, unsigned int );
+			// context, pixel_ID 
+
+int Release_234Composition_Memory_Context ( Compositor234_Context* ); 
+			// context 
+
+int Get_234Composition_Stats_Context ( Compositor234_Context*, Compositor234_Stats* ); 
+			// context, *stats 
+
+int Reduce_234Composition_Stats_Context ( Compositor234_Context*, Compositor234_Stats*, MPI_Op, MPI_Comm ); 
+			// context, *stats, MPI_OP, MPI_COMM 
+
+// ======================================
+//	  K_234Composition API (Non-blocking)
+// ======================================
+// Start the composition and return immediately. The composition 
+// advances on each call to Test_234Composition (or in a progress 
+// thread when built with -D_PROGRESS_THREAD and MPI_THREAD_MULTIPLE), 
+// and is completed by Wait_234Composition. The blended image is 
+// left in my_image of the ROOT_NODE. Every node must start its 
+// compositions in the same order.
+// ( Interleaved pixel types. Same 2-3-4 + Binary-Swap stages, hence the 
+//   same image, as Do_234Composition with ALPHA or DEPTH in rank order 
+//   ( Radix-k is not used ). ROI, COMPRESS and SPARSE modes are 
+//   composited as ALPHA or DEPTH. Other merge modes are rejected )
+
+typedef struct Compositor234_Request Compositor234_Request;
+
+int Ibegin_234Composition ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, void*, MPI_Comm, Compositor234_Request** ); 
+			// my_rank, nnodes, width, height, pixel_ID, merge_ID, *my_image, MPI_COMM, *request 
+
+int Test_234Composition ( Compositor234_Request**, int* ); 
+			// *request, *flag ( request is released and set to NULL when completed )
+
+int Wait_234Composition ( Compositor234_Request** ); 
+			// *request ( request is released and set to NULL )
 
 // ========= ALPHA BLENDING LOOK UP TABLE ========= //
-BYTE LUT_Mult[ 256 * 256 ]; /**< Product Lookup Table: (255 - Alpha) * Color */ 
+BYTE LUT_Mult[ 256 * 256 ]; /**< Product Lookup Table: (255 - Alpha) * Color ( Color for Alpha = 0 ) */ 
 BYTE LUT_Sat [ 512 ];       /**< Saturation Lookup Table: 255 if Color > 255 */ 
+
+// ========= COMPOSITING ROUTINES (SCALAR OR SIMD) ========= //
+// ( Defined in merge.c and selected by Select_AlphaBlend_SIMD )
+extern int (*composite_alpha_rgba32_blend)  ( BYTE*,  BYTE*,  BYTE*,  unsigned int ); /**< RGBA32 Alpha-blending routine (LUT or SIMD) */
+extern int (*composite_alpha_rgbaz64_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ); /**< RGBAZ64 Depth compositing routine */
+extern int (*composite_alpha_rgbaz88_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ); /**< RGBAZ88 Depth compositing routine */
+extern int (*composite_alpha_rgbaz96_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ); /**< RGBAZ96 Depth compositing routine */
+extern int (*composite_alpha_rgbaz160_blend)( float*, float*, float*, unsigned int ); /**< RGBAZ160 Depth compositing routine */
 //=====================================
 
 #ifndef COMPOSITOR234_MISC_H_INCLUDE
@@ -319,6 +432,11 @@ BYTE LUT_Sat [ 512 ];       /**< Saturation Lookup Table: 255 if Color > 255 */
 	#define COMPOSITOR234_MISC_H_INCLUDE
 #endif
 
+#ifndef COMPOSITOR234_COMPRESS_H_INCLUDE
+	#include "compress.h"
+	#define COMPOSITOR234_COMPRESS_H_INCLUDE
+#endif
+
 #ifndef COMPOSITOR234_EXCHANGE_H_INCLUDE
 	#include "exchange.h"
 	#define COMPOSITOR234_EXCHANGE_H_INCLUDE
@@ -0,0 +1,466 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   context.h
+// @brief  Compositing context (internal to the library)
+//          Every buffer, communicator and size used by one
+//          composition is kept in a Compositor234_Context.
+//          The library routines access the context in use
+//          through compositor_context (one per thread).
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#ifndef COMPOSITOR234_CONTEXT_H_INCLUDE
+#define COMPOSITOR234_CONTEXT_H_INCLUDE
+#endif
+
+#ifdef _PROGRESS_THREAD
+	#include <pthread.h>
+#endif
+
+// Thread-local context pointer
+#if defined ( __GNUC__ )
+	#define COMPOSITOR234_THREAD_LOCAL __thread
+#else
+	#define COMPOSITOR234_THREAD_LOCAL
+#endif
+
+// ======================================
+//	    PERSISTENT REQUESTS
+// ======================================
+
+// Send or receive of the exchange schedule ( See isend_persistent )
+struct Compositor234_Exchange
+{
+	_Bool        is_send;	// MPI_Send_init ( true ) or MPI_Recv_init ( false )
+	void*        buffer;	// Data to be sent or received
+	size_t       count;	// Number of elements
+	MPI_Datatype datatype;	// MPI datatype
+	int          peer;	// Destination or source rank
+	int          tag;	// MPI tag
+	MPI_Comm     comm;	// MPI Communicator
+	MPI_Request  request;	// Persistent request
+};
+
+struct Compositor234_Context
+{
+	// ======================================
+	//	    VARIABLES (Image Data ) 
+	// ======================================
+
+	BYTE *temp_image_rgba32;		// Temporary Image Data (RGBA32 Pixels)
+	BYTE *temp_image_rgba56;		// Temporary Image Data (RGBA56 Pixels)
+	BYTE *temp_image_rgba64;		// Temporary Image Data (RGBA64 Pixels)
+	BYTE *temp_image_rgbaz64;		// Temporary Image Data (RGBAZ64 Pixels)
+	BYTE *temp_image_rgbaz88;		// Temporary Image Data (RGBAZ88 Pixels)
+	BYTE *temp_image_rgbaz96;		// Temporary Image Data (RGBAZ96 Pixels)
+	BYTE *temp_image_byte_ptr;		// Pointer for the Temporary Image Data (BYTE)
+
+	float *temp_image_rgba128;		// Temporary Image Data (RGBA128 Pixels)
+	float *temp_image_rgbaz160;		// Temporary Image Data (RGBAZ160 Pixels)
+	size_t temp_image_pixels;		// Number of pixels of the Temporary Image Data
+
+	float *planar_depth_image;		// Depth plane for Do_234ZComposition (RGBAZ160 Planar Pixels)
+	float *zcomp_depth;			// Depth segment for Do_234ZComposition (RGBAZ64 and RGBAZ160 Pixels)
+	size_t zcomp_depth_size;		// Size of zcomp_depth in bytes
+	struct Compositor234_Memory memory_pool[ MEMORY_POOL_ENTRIES ];	// Image buffers kept across Destroy and Init
+	float *planar_image_planes[ RGBAZ ];	// Pointers to the image planes (Planar Pixels)
+
+	size_t global_num_pixels;	// Number of pixels ( Image size )
+	size_t global_image_size;	// image size ( Number of pixels * image_type )
+
+	unsigned int global_mod_pixels; // Remainder pixels (Number of pixels mod Number of nodes)
+	unsigned int global_add_pixels; // Added pixels to complete a divisible number of pixels
+
+	size_t global_image_type;	// Image type ( RGBA32, RGBAZ_64, RGBA128, RGBAZ160 )
+
+	MPI_Datatype MPI_TYPE_PIXEL;	// One pixel ( global_image_type bytes )
+
+	// ======================================
+	//	    VARIABLES ( MPI related ) 
+	// ======================================
+
+	MPI_Status  global_status;	// Status object for MPI_Recv
+	MPI_Request global_isend;	// ISend request parameter
+	MPI_Request global_irecv;	// IRecv request parameter
+
+	unsigned int global_merge_ID;	// Pixel merging mode ( ALPHA, DEPTH, ALPHA_COMPRESS, ... )
+
+	// ======================================
+	//	    RLE COMPRESSION 
+	//	 (ALPHA_COMPRESS and DEPTH_COMPRESS)
+	// ======================================
+
+	BYTE* compress_send_buffer;		// Compressed data to be sent
+	BYTE* compress_recv_buffer;		// Received compressed data
+
+	size_t compress_send_size;	// Size of compress_send_buffer
+	size_t compress_recv_size;	// Size of compress_recv_buffer
+
+	// ======================================
+	//	    REGION OF INTEREST 
+	//	  (ALPHA_ROI and DEPTH_ROI)
+	// ======================================
+
+	int  global_roi[ 4 ];		// ROI of my image ( x_min, y_min, x_max, y_max )
+	_Bool global_roi_defined;	// ROI given by Set_234Composition_ROI
+
+	int* roi_list;			// ROI of every node ( 4 values per node )
+	unsigned int* roi_segments;	// Pixel segments ( offset, counts ) inside the ROI
+
+	_Bool is_power_of_two; 		// Check wether is power-of-two (2^n)
+
+	// ======================================
+	//	    PIPELINED BINARY-SWAP 
+	// ======================================
+
+	unsigned int bswap_chunk_pixels[ NUM_PIXEL_IDS ];	// Pixels per message ( 0: BSWAP_CHUNK_SIZE bytes )
+
+	// ======================================
+	//	    RADIX-K 
+	// ======================================
+
+	unsigned int bswap_radix;	// Nodes per group and round ( 0 or 2: Binary-Swap )
+
+	// ======================================
+	//	    HIERARCHICAL COMPOSITION 
+	//	 Intra-node ( Shared memory ) and 
+	//	 Inter-node ( Node leaders )
+	// ======================================
+
+	_Bool use_hierarchy;		// Init_234Composition_Hierarchical
+
+	MPI_Comm MPI_COMM_SHARED;	// MPI Communicator (Ranks of my node)
+	int shared_my_rank;		// My Rank (MPI_COMM_SHARED)
+	int shared_nnodes;		// Num Ranks (MPI_COMM_SHARED)
+
+	MPI_Comm MPI_COMM_LEADERS;	// MPI Communicator (Rank 0 of every node)
+	int leader_my_rank;		// My Rank (MPI_COMM_LEADERS)
+	int leader_nnodes;		// Num Nodes (MPI_COMM_LEADERS)
+
+	MPI_Win shared_window;		// Shared memory window (Images of my node)
+	BYTE**  shared_images;		// Image of every rank of my node
+
+	// ======================================
+	//	    DISTRIBUTED RESULT 
+	//	 Composited region of my node
+	// ======================================
+
+	_Bool skip_final_gather;		// No final image gathering ( File and Distributed output )
+
+	void*  region_image;			// Composited region ( NULL: None )
+	size_t region_offset;			// Offset of the region ( pixels )
+	size_t region_counts;			// Number of pixels of the region
+
+	const char* output_file_name;		// Output file ( NULL: None )
+	unsigned int output_file_format;	// FILE_RAW or FILE_PNM
+
+	// ======================================
+	//	    OUTPUT IMAGE 
+	//	 Gathered image on the ROOT_NODE
+	// ======================================
+
+	void*  output_image;			// Registered output buffer ( NULL: my_image )
+	void*  gather_buffer;			// Destination of the final gathering ( NULL: Temporary buffer )
+	void*  view_image;			// Gathered image lent by Do_234Composition_View ( NULL: None )
+
+	// ======================================
+	//	    TRADITIONAL GATHERV 
+	//	 Final image gathering (MPI_Gatherv)
+	// ======================================
+
+	int *bs_gatherv_offset;			// List of offset data for MPI_Gatherv
+	int *bs_gatherv_counts;			// List of data counts information for MPI_Gatherv 
+	int *bs_gatherv_counts_offset;		// List of data counts information for MPI_Gatherv 
+
+	int *bs_gatherv_offset_ptr;		// Pointer for bs_gatherv_offset
+	int *bs_gatherv_counts_ptr;		// Pointer for bs_gatherv_counts
+	int *bs_gatherv_counts_offset_ptr;	// Pointer for bs_gatherv_counts
+
+	// ======================================
+	//		    BIT-REVERSAL 
+	//	 Final image gathering (MPI_Gather)
+	// ======================================
+
+	MPI_Comm MPI_COMM_BITREV; 	// MPI Communicator (Bit-reversal rank order)
+
+	int bitrev_my_rank;		// My Rank (MPI_COMM_BITREV)
+	int bitrev_nnodes;		// Num Nodes (MPI_COMM_BITREV)
+
+	int bitrev_my_group;		// Group(Color) for MPI_Comm_split
+
+	// ======================================
+	//	    2-3-4 Decomposition
+	// ======================================
+
+	unsigned int near_pow2;		// Nearest power of two smaller than total number of nodes
+
+	unsigned int ngroups_234;	// Number of groups
+	unsigned int base_234;		// Base for 2-3-4 Decomposition
+	unsigned int over_234;		// Nodes over threshold
+	unsigned int threshold_234;	// Threshold for 2-3-4 Decomposition (3)
+
+	//==========================
+	MPI_Comm MPI_COMM_234; 		// MPI Communicator (Groups of 2, 3 or 4)
+
+	int my_rank_234;		// My Rank (Groups of 2, 3 or 4)
+	int nnodes_234;			// Num Nodes (Groups of 2, 3 or 4)
+
+	unsigned int my_group_234;	// Group(Color) for MPI_Comm_split
+	//==========================
+
+	// ======================================
+	//	    2nd stage Binary-Swap
+	// ======================================
+	int *group_bswap;			// List of nodes (2nd stage Binary-Swap) 
+	int *group_bswap_ptr;			// Pointer for group_bswap
+
+	MPI_Group MPI_GROUP_WORLD;		// Group (Entire nodes)
+	MPI_Group MPI_GROUP_STAGE2_BSWAP;	// Group (2nd stage Binary-Swap)
+
+	//==========================
+	MPI_Comm  MPI_COMM_STAGE2_BSWAP;	// MPI Communicator (2nd stage Binary-Swap)
+
+	int stage2_bswap_my_rank;		// My Rank (2nd stage Binary-Swap)
+	int stage2_bswap_nnodes;		// Num Nodes (2nd stage Binary-Swap)
+
+	MPI_Comm  MPI_COMM_STAGE2_BITREV;	// MPI Communicator (2nd stage Bit-Reversed Binary-Swap)
+
+	int stage2_bitrev_my_rank;		// My Rank (2nd stage Binary-Swap)
+	int stage2_bitrev_nnodes;		// Num Nodes (2nd stage Binary-Swap)
+	//==========================
+
+	// ======================================
+	//	    COMMUNICATOR PLAN
+	//	 (Reused by the next Init_234Composition)
+	// ======================================
+	_Bool     has_234_communicators;	// Communicators of create_234_communicators exist
+	MPI_Group MPI_GROUP_PLAN;		// Group of the communicator they were derived from
+
+	// ======================================
+	//	    VISIBILITY ORDER
+	//	 (Do_234ZComposition)
+	// ======================================
+	int* order_list;		// Rank of each visibility position ( NULL: Rank order )
+	MPI_Comm MPI_COMM_ORDER;	// MPI Communicator (Ranks in visibility order)
+	unsigned int order_my_rank;	// My Rank (MPI_COMM_ORDER)
+
+	float* domain_bounds;		// Bounding box of the domain of each rank ( NULL: Minimum depth )
+	float  view_direction[ 3 ];	// View direction ( 0, 0, 0: Minimum depth )
+	int*   view_order;		// Visibility order ( domain_bounds and view_direction )
+	_Bool  view_order_valid;	// view_order is up to date
+
+	// ======================================
+	//	    EXCHANGE SCHEDULE
+	//	 Persistent requests of the compositions,
+	//	 restarted in the same order every frame
+	// ======================================
+	struct Compositor234_Exchange* exchange_list;	// Persistent requests in posting order
+	unsigned int exchange_count;			// Number of persistent requests
+	unsigned int exchange_capacity;			// Allocated entries of exchange_list
+	unsigned int exchange_next;			// Next position ( current composition )
+
+	// ======================================
+	//	    PLACEMENT ORDER
+	//	 (Set_234Composition_Placement)
+	// ======================================
+	int*   placement_order;		// Rank of each position ( NULL: Rank order )
+	unsigned int placement_nnodes;	// Number of nodes of placement_order
+
+	// ======================================
+	//	    STATISTICS
+	//	 (Get_234Composition_Stats)
+	// ======================================
+	Compositor234_Stats composition_stats;	// Statistics of the last composition
+	double stats_start;			// Start of the composition ( MPI_Wtime )
+	double stats_mark;			// Start of the current phase ( MPI_Wtime )
+	int    stats_phase;			// Current phase ( STATS_SETUP, ... or Binary-Swap stage )
+};
+
+// ======================================
+//	    NON-BLOCKING COMPOSITION
+// ======================================
+
+// 2-3-4 + Binary-Swap schedule ( See icomp_schedule )
+#define ICOMP_STAGE	0	// Stage in progress
+#define ICOMP_GATHER	1	// Final image gathering in progress
+#define ICOMP_DONE	2	// Composition completed
+
+#define ICOMP_MAX_STAGES	34	// Stages of a node ( 2 partial + 32 Binary-Swap )
+
+#define ICOMP_MY_IMAGE		0	// Blended pixels of my node
+#define ICOMP_RECV_IMAGE	1	// Pixels received from the first node of the stage
+#define ICOMP_RECV_IMAGE2	2	// Pixels received from the second node of the stage
+
+// Stage of the schedule of a node: pixels exchanged with one or two 
+// nodes, then blended in [ blnd_offset, blnd_offset + blnd_counts )
+typedef struct
+{
+	unsigned int num_pairs;		// Number of nodes of the stage ( 1 or 2 )
+	int          pair_node  [ 2 ];	// MPI Rank of these nodes
+	unsigned int send_offset[ 2 ];	// First pixel sent to each node
+	unsigned int send_counts[ 2 ];	// Number of pixels sent to each node ( 0: None )
+	_Bool        recv       [ 2 ];	// blnd_counts pixels received from each node
+
+	unsigned int blnd_offset;	// First pixel blended by my node
+	unsigned int blnd_counts;	// Number of pixels blended by my node
+	unsigned int num_blends;	// Number of blends ( 0 to 2 )
+	unsigned int blnd_over [ 2 ];	// Image in front ( ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE or ICOMP_RECV_IMAGE2 )
+	unsigned int blnd_under[ 2 ];	// Image behind ( Blended into ICOMP_MY_IMAGE when one of them 
+					// is ICOMP_MY_IMAGE, otherwise into ICOMP_RECV_IMAGE )
+	int          phase;		// STATS_PARTIAL or Binary-Swap stage ( Composition statistics )
+} Compositor234_Stage;
+
+struct Compositor234_Request
+{
+	unsigned int my_rank;		// MPI Rank
+	unsigned int nnodes;		// Number of nodes
+	unsigned int pixel_ID;		// Pixel ID
+	size_t pixel_size;		// Bytes per pixel ( RGBA and depth values of split pixels )
+	size_t color_size;		// Bytes of the pixels of my_image ( RGBA values of split pixels )
+	unsigned int image_size;	// Number of pixels
+
+	BYTE* my_image;			// Image being composited (in place)
+	BYTE* recv_image;		// Pixels received at the current stage
+
+	const float* my_depth;		// Depth values of split pixels ( NULL: Interleaved pixels )
+	float* blnd_depth;		// Blended depth values of split pixels ( my_depth is not modified )
+	_Bool  has_blnd_depth;		// Depth values of my pixels in blnd_depth
+
+	MPI_Comm comm;			// MPI Communicator
+	int tag;			// MPI Tag (ICOMP_STAGE and ICOMP_GATHER are added)
+
+	Compositor234_Stage stages[ ICOMP_MAX_STAGES ];	// Schedule of my node
+	unsigned int num_stages;	// Number of stages
+	unsigned int cur_stage;		// Stage in progress
+	unsigned int final_offset;	// First pixel of my node in the gathered image
+	unsigned int final_counts;	// Number of pixels of my node in the gathered image ( 0: None )
+	_Bool record_stats;		// Bytes and wait time added to composition_stats ( Do_234ZComposition )
+
+	volatile int state;		// ICOMP_STAGE, ICOMP_GATHER or ICOMP_DONE
+
+	MPI_Request* requests;		// Outstanding MPI requests
+	unsigned int num_requests;	// Number of outstanding MPI requests
+
+#ifdef _PROGRESS_THREAD
+	pthread_t progress_thread;	// Thread advancing the composition
+	_Bool has_progress_thread;	// Progress thread running
+	Compositor234_Context* context;	// Context of the caller ( compositor_context of the thread )
+#endif
+};
+
+// Context in use by the calling thread ( Default context when 
+// called through Init_234Composition, Do_234Composition, ... )
+extern COMPOSITOR234_THREAD_LOCAL Compositor234_Context* compositor_context;
+
+// ======================================
+//	    CONTEXT MEMBERS
+// ======================================
+#define temp_image_rgba32             ( compositor_context->temp_image_rgba32 )
+#define temp_image_rgba56             ( compositor_context->temp_image_rgba56 )
+#define temp_image_rgba64             ( compositor_context->temp_image_rgba64 )
+#define temp_image_rgbaz64            ( compositor_context->temp_image_rgbaz64 )
+#define temp_image_rgbaz88            ( compositor_context->temp_image_rgbaz88 )
+#define temp_image_rgbaz96            ( compositor_context->temp_image_rgbaz96 )
+#define temp_image_byte_ptr           ( compositor_context->temp_image_byte_ptr )
+#define temp_image_rgba128            ( compositor_context->temp_image_rgba128 )
+#define temp_image_rgbaz160           ( compositor_context->temp_image_rgbaz160 )
+#define temp_image_pixels             ( compositor_context->temp_image_pixels )
+#define planar_depth_image            ( compositor_context->planar_depth_image )
+#define zcomp_depth                   ( compositor_context->zcomp_depth )
+#define zcomp_depth_size              ( compositor_context->zcomp_depth_size )
+#define memory_pool                   ( compositor_context->memory_pool )
+#define planar_image_planes           ( compositor_context->planar_image_planes )
+#define global_num_pixels             ( compositor_context->global_num_pixels )
+#define global_image_size             ( compositor_context->global_image_size )
+#define global_mod_pixels             ( compositor_context->global_mod_pixels )
+#define global_add_pixels             ( compositor_context->global_add_pixels )
+#define global_image_type             ( compositor_context->global_image_type )
+#define MPI_TYPE_PIXEL                ( compositor_context->MPI_TYPE_PIXEL )
+#define global_status                 ( compositor_context->global_status )
+#define global_isend                  ( compositor_context->global_isend )
+#define global_irecv                  ( compositor_context->global_irecv )
+#define global_merge_ID               ( compositor_context->global_merge_ID )
+#define compress_send_buffer          ( compositor_context->compress_send_buffer )
+#define compress_recv_buffer          ( compositor_context->compress_recv_buffer )
+#define compress_send_size            ( compositor_context->compress_send_size )
+#define compress_recv_size            ( compositor_context->compress_recv_size )
+#define global_roi                    ( compositor_context->global_roi )
+#define global_roi_defined            ( compositor_context->global_roi_defined )
+#define roi_list                      ( compositor_context->roi_list )
+#define roi_segments                  ( compositor_context->roi_segments )
+#define is_power_of_two               ( compositor_context->is_power_of_two )
+#define bswap_chunk_pixels            ( compositor_context->bswap_chunk_pixels )
+#define bswap_radix                   ( compositor_context->bswap_radix )
+#define use_hierarchy                 ( compositor_context->use_hierarchy )
+#define MPI_COMM_SHARED               ( compositor_context->MPI_COMM_SHARED )
+#define shared_my_rank                ( compositor_context->shared_my_rank )
+#define shared_nnodes                 ( compositor_context->shared_nnodes )
+#define MPI_COMM_LEADERS              ( compositor_context->MPI_COMM_LEADERS )
+#define leader_my_rank                ( compositor_context->leader_my_rank )
+#define leader_nnodes                 ( compositor_context->leader_nnodes )
+#define shared_window                 ( compositor_context->shared_window )
+#define shared_images                 ( compositor_context->shared_images )
+#define skip_final_gather             ( compositor_context->skip_final_gather )
+#define region_image                  ( compositor_context->region_image )
+#define region_offset                 ( compositor_context->region_offset )
+#define region_counts                 ( compositor_context->region_counts )
+#define output_file_name              ( compositor_context->output_file_name )
+#define output_file_format            ( compositor_context->output_file_format )
+#define output_image                  ( compositor_context->output_image )
+#define gather_buffer                 ( compositor_context->gather_buffer )
+#define view_image                    ( compositor_context->view_image )
+#define bs_gatherv_offset             ( compositor_context->bs_gatherv_offset )
+#define bs_gatherv_counts             ( compositor_context->bs_gatherv_counts )
+#define bs_gatherv_counts_offset      ( compositor_context->bs_gatherv_counts_offset )
+#define bs_gatherv_offset_ptr         ( compositor_context->bs_gatherv_offset_ptr )
+#define bs_gatherv_counts_ptr         ( compositor_context->bs_gatherv_counts_ptr )
+#define bs_gatherv_counts_offset_ptr  ( compositor_context->bs_gatherv_counts_offset_ptr )
+#define MPI_COMM_BITREV               ( compositor_context->MPI_COMM_BITREV )
+#define bitrev_my_rank                ( compositor_context->bitrev_my_rank )
+#define bitrev_nnodes                 ( compositor_context->bitrev_nnodes )
+#define bitrev_my_group               ( compositor_context->bitrev_my_group )
+#define near_pow2                     ( compositor_context->near_pow2 )
+#define ngroups_234                   ( compositor_context->ngroups_234 )
+#define base_234                      ( compositor_context->base_234 )
+#define over_234                      ( compositor_context->over_234 )
+#define threshold_234                 ( compositor_context->threshold_234 )
+#define MPI_COMM_234                  ( compositor_context->MPI_COMM_234 )
+#define my_rank_234                   ( compositor_context->my_rank_234 )
+#define nnodes_234                    ( compositor_context->nnodes_234 )
+#define my_group_234                  ( compositor_context->my_group_234 )
+#define group_bswap                   ( compositor_context->group_bswap )
+#define group_bswap_ptr               ( compositor_context->group_bswap_ptr )
+#define MPI_GROUP_WORLD               ( compositor_context->MPI_GROUP_WORLD )
+#define MPI_GROUP_STAGE2_BSWAP        ( compositor_context->MPI_GROUP_STAGE2_BSWAP )
+#define MPI_COMM_STAGE2_BSWAP         ( compositor_context->MPI_COMM_STAGE2_BSWAP )
+#define stage2_bswap_my_rank          ( compositor_context->stage2_bswap_my_rank )
+#define stage2_bswap_nnodes           ( compositor_context->stage2_bswap_nnodes )
+#define MPI_COMM_STAGE2_BITREV        ( compositor_context->MPI_COMM_STAGE2_BITREV )
+#define stage2_bitrev_my_rank         ( compositor_context->stage2_bitrev_my_rank )
+#define stage2_bitrev_nnodes          ( compositor_context->stage2_bitrev_nnodes )
+#define order_list                    ( compositor_context->order_list )
+#define has_234_communicators         ( compositor_context->has_234_communicators )
+#define MPI_GROUP_PLAN                ( compositor_context->MPI_GROUP_PLAN )
+#define MPI_COMM_ORDER                ( compositor_context->MPI_COMM_ORDER )
+#define order_my_rank                 ( compositor_context->order_my_rank )
+#define domain_bounds                 ( compositor_context->domain_bounds )
+#define view_direction                ( compositor_context->view_direction )
+#define view_order                    ( compositor_context->view_order )
+#define view_order_valid              ( compositor_context->view_order_valid )
+#define exchange_list                 ( compositor_context->exchange_list )
+#define exchange_count                ( compositor_context->exchange_count )
+#define exchange_capacity             ( compositor_context->exchange_capacity )
+#define exchange_next                 ( compositor_context->exchange_next )
+#define placement_order               ( compositor_context->placement_order )
+#define placement_nnodes              ( compositor_context->placement_nnodes )
+#define composition_stats             ( compositor_context->composition_stats )
+#define stats_start                   ( compositor_context->stats_start )
+#define stats_mark                    ( compositor_context->stats_mark )
+#define stats_phase                   ( compositor_context->stats_phase )
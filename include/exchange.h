@@ -16,9 +16,49 @@
 #ifndef COMPOSITOR234_EXCHANGE_H_INCLUDE
 #define COMPOSITOR234_EXCHANGE_H_INCLUDE
 
+// Elements per block of the derived datatypes used for counts above INT_MAX
+#define LARGE_COUNT_BLOCK	( 1 << 30 )
+
+// Entries added to the exchange schedule at a time
+#define EXCHANGE_SCHEDULE_BLOCK	64
+
+// Phases of the composition statistics ( Binary-Swap stages: 0, 1, ... )
+#define STATS_SETUP	-1	// Buffers and ROI before the first stage
+#define STATS_PARTIAL	-2	// 2-3-4 partial stage ( and 3 node Direct-Send )
+#define STATS_GATHER	-3	// Final image gathering
+
 // ======================================
 //		Function Prototypes
 // ======================================
+// Point-to-point transfers with size_t counts (above INT_MAX: derived datatype)
+int isend_large ( void*, size_t, MPI_Datatype, int, int, MPI_Comm, MPI_Request* );
+int irecv_large ( void*, size_t, MPI_Datatype, int, int, MPI_Comm, MPI_Request* );
+int send_large  ( void*, size_t, MPI_Datatype, int, int, MPI_Comm );
+int recv_large  ( void*, size_t, MPI_Datatype, int, int, MPI_Comm );
+// Statistics of the composition ( Get_234Composition_Stats )
+void begin_composition_stats ( void );
+void begin_stats_phase       ( int );
+void end_composition_stats   ( void );
+// Persistent requests restarted every composition ( Exchange schedule )
+int  isend_persistent ( void*, size_t, MPI_Datatype, int, int, MPI_Comm, MPI_Request* );
+int  irecv_persistent ( void*, size_t, MPI_Datatype, int, int, MPI_Comm, MPI_Request* );
+void restart_exchange_schedule ( void );
+void free_exchange_schedule    ( void );
+// Pairwise Image Exchange (RLE compressed for ALPHA_COMPRESS and DEPTH_COMPRESS)
+int exchange_image ( void*, size_t, void*, size_t, MPI_Datatype, int, int, int, MPI_Comm );
+int send_image     ( void*, size_t, MPI_Datatype, int, int, MPI_Comm );
+int recv_image     ( void*, size_t, MPI_Datatype, int, int, MPI_Comm );
+// Pairwise Image Exchange using Active-pixel Spans (ALPHA_SPARSE)
+int exchange_image_spans ( BYTE*, unsigned int, size_t, BYTE**, int, int, int, MPI_Comm );
+// ROI of every node (ALPHA_ROI and DEPTH_ROI)
+int exchange_roi ( void*, unsigned int, unsigned int, unsigned int, MPI_Comm );
+// Pairwise Image Exchange of the pixels inside the ROI (ALPHA_ROI and DEPTH_ROI)
+int exchange_image_roi ( BYTE*, unsigned int, unsigned int, unsigned int, BYTE*, unsigned int, unsigned int, unsigned int, \
+			 unsigned int, size_t, unsigned int, int, int, int, MPI_Comm, unsigned int* );
+// Pipelined Pairwise Image Exchange and Compositing (in chunks)
+int exchange_composite_image ( BYTE*, unsigned int, BYTE*, unsigned int, BYTE*, BYTE*, unsigned int, \
+			       unsigned int, size_t, unsigned int, int, int, int, MPI_Comm );
+
 // Binary-Swap (RGBA32 and RGBA56 Pixels)
 int bswap_rgba_BYTE  ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, BYTE*,  BYTE**,  unsigned int*, unsigned int*, MPI_Comm ); 
 // Binary-Swap (RGBAZ64 and RGBAZ88 Pixels)
@@ -37,6 +77,14 @@ int stage2_bswap_rgba128    ( unsigned int, unsigned int, unsigned int, unsigned
 // Binary-Swap from Stage 2 (RGBAZ160 Pixels)
 int stage2_bswap_rgbaz160   ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float*, float**, unsigned int*, unsigned int*, MPI_Comm );	
 
+// Radix-k (RGBA32, RGBA56, RGBA64, RGBAZ64, RGBAZ88, RGBAZ96, RGBA128 and RGBAZ160 Pixels)
+int radixk_image        ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, BYTE*, BYTE**, unsigned int*, unsigned int*, MPI_Comm ); 
+// Radix-k from Stage 2 (RGBA32, RGBA56, RGBA64, RGBAZ64, RGBAZ88, RGBAZ96, RGBA128 and RGBAZ160 Pixels)
+int stage2_radixk_image ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, BYTE*, BYTE**, unsigned int*, unsigned int*, MPI_Comm ); 
+
+// Intra-node compositing in shared memory (Hierarchical composition)
+int shared_composite_image ( unsigned int, unsigned int, size_t, unsigned int, size_t, BYTE** ); 
+
 // 2 Node Stage 1 Binary-Swap (RGBA32 and RGBA56 Pixels) 
 int partial_bswap2_rgba_BYTE  ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, BYTE* , BYTE* , MPI_Comm ); 
 // 2 Node Stage 1 Binary-Swap (RGBAZ64 and RGBAZ88 Pixels)
@@ -73,5 +121,16 @@ int dsend3_rgba128    ( unsigned int, unsigned int, unsigned int, unsigned int,
 // 3 Node Direct-Send (RGBAZ160 Pixels)
 int dsend3_rgbaz160   ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float*, float*, MPI_Comm ); 
 
+// Binary-Swap (RGBA128 and RGBAZ160 Planar Pixels)
+int planar_bswap_float  ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float**, float*, unsigned int*, unsigned int*, MPI_Comm ); 
+// Final Image Gathering (RGBA128 and RGBAZ160 Planar Pixels)
+int gather_planar_float ( unsigned int, unsigned int, unsigned int, unsigned int, unsigned int, float**, unsigned int, unsigned int, float*, MPI_Comm ); 
+
+// 2-3-4 + Binary-Swap stages and Final Image Gathering driven by a schedule 
+// (Interleaved pixels, and RGBAZ64 and RGBAZ160 Split Pixels: RGBA and depth segments)
+unsigned int icomp_schedule ( Compositor234_Request* );
+void  icomp_begin    ( Compositor234_Request* );
+_Bool icomp_progress ( Compositor234_Request*, _Bool );
+
 #endif
 
@@ -16,6 +16,12 @@
 #ifndef COMPOSITOR234_MERGE_H_INCLUDE
 #define COMPOSITOR234_MERGE_H_INCLUDE
 
+// SIMD alpha-blending (RGBA32) on x86 processors
+// ( Define _NOSIMD to disable )
+#if defined ( __GNUC__ ) && ( defined ( __x86_64__ ) || defined ( __i386__ )) && !defined ( _NOSIMD )
+	#define _SIMDBLEND
+#endif
+
 // ======================================
 //		Function Prototypes
 // ======================================
@@ -24,9 +30,26 @@ int composite_alpha_rgba32f   ( BYTE* , BYTE* , BYTE* , unsigned int );	// Alpha
 int composite_alpha_rgbaz64   ( BYTE* , BYTE* , BYTE* , unsigned int );	// Alpha-blend compositing (RGBA64 Pixels)
 int composite_alpha_rgba128   ( float*, float*, float*, unsigned int );	// Alpha-blend compositing (RGBA128 Pixels)
 int composite_alpha_rgbaz160  ( float*, float*, float*, unsigned int );	// Alpha-blend compositing (RGBAZ160 Pixels)
+int composite_alpha_rgba128_planar  ( float**, float**, float**, unsigned int ); // Alpha-blend compositing (RGBA128 Planar Pixels)
+int composite_alpha_rgbaz160_planar ( float**, float**, float**, unsigned int ); // Alpha-blend compositing (RGBAZ160 Planar Pixels)
+int composite_alpha_rgbaz64_split   ( BYTE* , float*, BYTE* , float*, BYTE* , float*, unsigned int ); // Depth compositing (RGBAZ64 Split Pixels)
+int composite_alpha_rgbaz160_split  ( float*, float*, float*, float*, float*, float*, unsigned int ); // Alpha-blend compositing (RGBAZ160 Split Pixels)
 
 void Create_AlphaBlend_LUT ( void ); // Generate Alpha Blending Look Up Table
 int composite_alpha_rgba32_LUT ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBA32 Pixels)
+int composite_alpha_rgba32_span ( BYTE* , BYTE* , BYTE* , unsigned int, unsigned int ); // Alpha-blend compositing (RGBA32 Pixels, ALPHA_SPARSE)
+
+void Select_AlphaBlend_SIMD ( void ); // Select the compositing routines (RGBA32 and RGBAZ Pixels)
+#ifdef _SIMDBLEND
+ int composite_alpha_rgba32_sse41  ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBA32 Pixels, SSE4.1)
+ int composite_alpha_rgba32_avx2   ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBA32 Pixels, AVX2)
+ int composite_alpha_rgba32_avx512 ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBA32 Pixels, AVX-512BW)
+ int composite_alpha_rgbaz64_avx2   ( BYTE* , BYTE* , BYTE* , unsigned int ); // Depth compositing (RGBAZ64 Pixels, AVX2)
+ int composite_alpha_rgbaz64_avx512 ( BYTE* , BYTE* , BYTE* , unsigned int ); // Depth compositing (RGBAZ64 Pixels, AVX-512)
+ int composite_alpha_rgbaz88_avx2   ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBAZ88 Pixels, AVX2)
+ int composite_alpha_rgbaz96_avx2   ( BYTE* , BYTE* , BYTE* , unsigned int ); // Alpha-blend compositing (RGBAZ96 Pixels, AVX2)
+ int composite_alpha_rgbaz160_avx2  ( float*, float*, float*, unsigned int ); // Alpha-blend compositing (RGBAZ160 Pixels, AVX2)
+#endif
 
 #ifdef C99
  int composite_alpha_rgba56   ( BYTE* restrict, BYTE* restrict, BYTE* restrict, unsigned int  ); // Alpha-blend compositing (RGBA56 Pixels)
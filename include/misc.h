@@ -16,6 +16,26 @@
 #ifndef COMPOSITOR234_MISC_H_INCLUDE
 #define COMPOSITOR234_MISC_H_INCLUDE
 
+// Alignment of the allocated memory regions ( SIMD loads and stores )
+#define MEMORY_ALIGNMENT	64
+
+// Regions of this size or larger are aligned to and backed by huge pages 
+// ( Transparent huge pages. Disabled by -D _NOHUGEPAGE )
+#define HUGE_PAGE_SIZE		( 2 << 20 )
+
+// Bytes cleared by a thread at a time ( First touch )
+#define MEMORY_TOUCH_BLOCK	4096
+
+// Released regions kept by a context for reuse
+#define MEMORY_POOL_ENTRIES	4
+
+// Memory region kept for reuse ( See release_pooled_memory_region )
+struct Compositor234_Memory
+{
+	void*  region;	// Memory region ( NULL: Empty entry )
+	size_t size;	// Size in bytes
+};
+
 // ======================================
 //		Function Prototypes
 // ======================================
@@ -30,9 +50,24 @@ unsigned int get_nearest_pow2 (unsigned int ); 		// Get nearest power-of-two fro
 unsigned int bitrevorder ( unsigned int, unsigned int );	// Returns the input data in bit-reversed order 
 
 // Memory Allocation
-BYTE  *allocate_byte_memory_region ( unsigned int ); 		// BYTE data
-float *allocate_float_memory_region ( unsigned int );		// float data
-unsigned int  *allocate_int_memory_region ( unsigned int ); // unsigned int data
+BYTE  *allocate_byte_memory_region ( size_t ); 		// BYTE data
+float *allocate_float_memory_region ( size_t );		// float data
+unsigned int  *allocate_int_memory_region ( size_t ); // unsigned int data
+void   clear_memory_region ( void*, size_t );		// Parallel clear ( First touch )
+
+// Memory Pool ( Reuse across Init and Destroy )
+void* allocate_pooled_memory_region ( struct Compositor234_Memory*, size_t );		// Pooled region or new one
+void  release_pooled_memory_region  ( struct Compositor234_Memory*, void*, size_t );	// Keep a region for reuse
+void  free_memory_pool ( struct Compositor234_Memory* );				// Free the kept regions
+
+// Region of Interest
+void get_image_roi ( void*, unsigned int, unsigned int, unsigned int, int* ); // Bounding rectangle of non-empty pixels
+
+// Visibility Order
+int get_visibility_order ( unsigned int, const float*, const float*, int* ); // Domains sorted along the view direction (kd-tree)
+
+// Placement Order
+int get_placement_order ( unsigned int, const int*, unsigned int, int* ); // Nodes sorted along the Z-order curve of their coordinates
 
 #endif
 
@@ -1,4 +1,10 @@
 mpicc -std=gnu99 -Wall -I../include -o test_234byte_mandel  test_234byte_mandel.c  ../lib/lib234comp.a -lm
 mpicc -std=gnu99 -Wall -I../include -o test_234float_mandel test_234float_mandel.c ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234tiled        test_234tiled.c        ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234distributed  test_234distributed.c  ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234file         test_234file.c         ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234output       test_234output.c       ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234reinit       test_234reinit.c       ../lib/lib234comp.a -lm
+mpicc -std=gnu99 -Wall -I../include -o test_234merge        test_234merge.c        ../lib/lib234comp.a -lm
 
 
@@ -0,0 +1,193 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234check.h
+
+// @brief  Image generation and comparison routines shared by the
+//         test programs that check a composition entry point
+//         against Do_234Composition ( Interleaved pixel types )
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#ifndef TEST_234CHECK_H_INCLUDE
+#define TEST_234CHECK_H_INCLUDE
+
+#include <string.h>
+
+#include "234compositor.h"
+
+/*========================================================*/
+/**
+ *  @brief Pixel size in bytes of an interleaved pixel type
+ *
+ *  @param  image_ID [in] Pixel type
+ */
+/*========================================================*/
+static size_t get_pixel_size ( unsigned int image_ID )
+{
+	switch ( image_ID )
+	{
+		case ID_RGBA32  : return RGBA32;
+		case ID_RGBAZ64 : return RGBAZ64;
+		case ID_RGBA128 : return RGBA128;
+		case ID_RGBAZ160: return RGBAZ160;
+		case ID_RGBA56  : return RGBA56;
+		case ID_RGBAZ88 : return RGBAZ88;
+		case ID_RGBA64  : return RGBA64;
+		case ID_RGBAZ96 : return RGBAZ96;
+	}
+	return 0;
+}
+
+/*========================================================*/
+/**
+ *  @brief Generate a pre-multiplied test image: about 30%
+ *         of the pixels are active, and the depth grows
+ *         with the rank ( same image for the same rank )
+ *
+ *  @param  my_rank  [in]  MPI rank number
+ *  @param  width    [in]  Image width
+ *  @param  height   [in]  Image height
+ *  @param  image_ID [in]  Pixel type
+ *  @param  image    [out] Generated image
+ */
+/*========================================================*/
+static void generate_image ( int my_rank, unsigned int width, unsigned int height, \
+			     unsigned int image_ID, BYTE* image )
+{
+	size_t i;
+	size_t image_size;
+	size_t pixel_size;
+
+	unsigned int seed;
+	_Bool active;
+
+	BYTE  rgba[ RGBA ];
+	float rgbaz[ RGBAZ ];
+	BYTE* image_ptr;
+
+	image_size = (size_t)width * height;
+	pixel_size = get_pixel_size ( image_ID );
+
+	seed = 1234 + my_rank * 77 + image_ID;
+
+	image_ptr = image;
+	for ( i = 0; i < image_size; i++ )
+	{
+		seed = seed * 1103515245u + 12345u;
+		active = ((( seed >> 16 ) % 10 ) < 3 );
+
+		seed = seed * 1103515245u + 12345u;
+		rgba[ 3 ] = active ? (BYTE)(( seed >> 16 ) % 256 ) : 0;
+		rgba[ 0 ] = (BYTE)(( seed >> 8 ) % ( rgba[ 3 ] + 1 ));
+		rgba[ 1 ] = (BYTE)(( seed >> 4 ) % ( rgba[ 3 ] + 1 ));
+		rgba[ 2 ] = (BYTE)( seed % ( rgba[ 3 ] + 1 ));
+
+		rgbaz[ 0 ] = rgba[ 0 ] / 255.0f;
+		rgbaz[ 1 ] = rgba[ 1 ] / 255.0f;
+		rgbaz[ 2 ] = rgba[ 2 ] / 255.0f;
+		rgbaz[ 3 ] = rgba[ 3 ] / 255.0f;
+		rgbaz[ 4 ] = my_rank + ( i % 1000 ) / 1000.0f;
+
+		switch ( image_ID )
+		{
+			case ID_RGBA32 : memcpy ( image_ptr, rgba, RGBA32 );
+					 break;
+			case ID_RGBAZ64: memcpy ( image_ptr, rgba, RGBA32 );
+					 memcpy ( image_ptr + 4, &rgbaz[ 4 ], sizeof(float) );
+					 break;
+			case ID_RGBA56 : memcpy ( image_ptr, rgba, RGB );
+					 memcpy ( image_ptr + 3, &rgbaz[ 3 ], sizeof(float) );
+					 break;
+			case ID_RGBAZ88: memcpy ( image_ptr, rgba, RGB );
+					 memcpy ( image_ptr + 3, &rgbaz[ 3 ], 2 * sizeof(float) );
+					 break;
+			case ID_RGBA64 : memcpy ( image_ptr, rgba, RGB );
+					 image_ptr[ 3 ] = 0;
+					 memcpy ( image_ptr + 4, &rgbaz[ 3 ], sizeof(float) );
+					 break;
+			case ID_RGBAZ96: memcpy ( image_ptr, rgba, RGB );
+					 image_ptr[ 3 ] = 0;
+					 memcpy ( image_ptr + 4, &rgbaz[ 3 ], 2 * sizeof(float) );
+					 break;
+			case ID_RGBA128 : memcpy ( image_ptr, rgbaz, RGBA128 );
+					  break;
+			case ID_RGBAZ160: memcpy ( image_ptr, rgbaz, RGBAZ160 );
+					  break;
+		}
+		image_ptr += pixel_size;
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Count the pixels of an image region that differ
+ *         from the reference image
+ *
+ *  @param  image      [in] Pixels to be checked
+ *  @param  reference  [in] Reference image ( whole image )
+ *  @param  offset     [in] Offset of the region ( pixels )
+ *  @param  counts     [in] Number of pixels of the region
+ *  @param  pixel_size [in] Pixel size
+ */
+/*========================================================*/
+static size_t count_different_pixels ( const BYTE* image, const BYTE* reference, \
+				       size_t offset, size_t counts, size_t pixel_size )
+{
+	size_t i;
+	size_t different_pixels;
+
+	reference += offset * pixel_size;
+
+	different_pixels = 0;
+	for ( i = 0; i < counts; i++ )
+	{
+		if ( memcmp ( image, reference, pixel_size ) != 0 ) {
+			different_pixels++;
+		}
+		image     += pixel_size;
+		reference += pixel_size;
+	}
+	return different_pixels;
+}
+
+/*========================================================*/
+/**
+ *  @brief Sum the different pixels of every node and print
+ *         the result on the ROOT_NODE ( Collective )
+ *
+ *  @param  my_rank          [in] MPI rank number
+ *  @param  test_name        [in] Name of the check
+ *  @param  different_pixels [in] Different pixels of my node
+ *  @param  checked_pixels   [in] Checked pixels of my node
+ *
+ *  @return EXIT_SUCCESS when no pixel differs
+ */
+/*========================================================*/
+static int report_check ( int my_rank, const char* test_name, \
+			  size_t different_pixels, size_t checked_pixels )
+{
+	unsigned long long counts[ 2 ];
+	unsigned long long total_counts[ 2 ];
+
+	counts[ 0 ] = different_pixels;
+	counts[ 1 ] = checked_pixels;
+
+	MPI_Allreduce ( counts, total_counts, 2, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+	if ( my_rank == ROOT_NODE ) {
+		printf ( "%-40s %s ( %llu of %llu pixels differ )\n", test_name, \
+			 ( total_counts[ 0 ] == 0 ) ? "OK    " : "FAILED", total_counts[ 0 ], total_counts[ 1 ] );
+	}
+
+	return ( total_counts[ 0 ] == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,142 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234distributed.c
+
+// @brief  Test program for 234Compositor
+//         Compare the composited region of every node given by
+//         Do_234Composition_Distributed with Do_234Composition,
+//         and check that the regions cover the whole image
+//         ( Also with a single node )
+//         mpicc -o test_234distributed test_234distributed.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define WIDTH  64
+#define HEIGHT 48
+
+#include "test_234check.h"
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height;
+	unsigned int image_ID;
+	unsigned int merge_ID;
+
+	size_t image_size;
+	size_t pixel_size;
+	size_t different_pixels;
+
+	unsigned long long region_pixels;
+	unsigned long long covered_pixels;
+
+	BYTE* reference_image;
+	BYTE* image;
+
+	void*  my_region;
+	size_t my_offset;
+	size_t my_counts;
+
+	//=====================================
+	width    = WIDTH;
+	height   = HEIGHT;
+	image_ID = ID_RGBA32;
+	merge_ID = ALPHA;
+
+	if (( argc != 1 ) && ( argc < 3 )) {
+		printf ("\n Usage: %s Width Height [ Pixel_ID [ Merge_ID ] ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc >= 3 ) {
+		width  = atoi(argv[1]);
+		height = atoi(argv[2]);
+	}
+	if ( argc >= 4 ) {
+		image_ID = atoi(argv[3]);
+	}
+	if ( argc >= 5 ) {
+		merge_ID = atoi(argv[4]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	if (( pixel_size = get_pixel_size ( image_ID )) == 0 ) {
+		printf ("<<< ERROR >>> Pixel ID %u is not an interleaved pixel type \n", image_ID );
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	image_size = (size_t)width * height * pixel_size;
+
+	Init_234Composition ( rank, nnodes, width, height, image_ID );
+
+	// my_image also holds the blank pixels added for MPI_Gather
+	reference_image = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) );
+	image           = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) );
+
+	if (( reference_image == NULL ) || ( image == NULL )) {
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	//=====================================
+	// Reference: Gathered image ( Every node )
+	//=====================================
+	generate_image ( rank, width, height, image_ID, reference_image );
+
+	// A single image is its own composition
+	if ( nnodes > 1 ) {
+		Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, reference_image, MPI_COMM_WORLD );
+	}
+	MPI_Bcast ( reference_image, (int)image_size, MPI_BYTE, ROOT_NODE, MPI_COMM_WORLD );
+
+	//=====================================
+	// Composited region of my node
+	//=====================================
+	generate_image ( rank, width, height, image_ID, image );
+
+	Do_234Composition_Distributed ( rank, nnodes, width, height, image_ID, merge_ID, image, \
+					&my_region, &my_offset, &my_counts, MPI_COMM_WORLD );
+
+	different_pixels = 0;
+	if ( my_region != NULL ) {
+		different_pixels = count_different_pixels ( my_region, reference_image, my_offset, my_counts, pixel_size );
+	}
+	result = report_check ( rank, "Do_234Composition_Distributed", different_pixels, my_counts );
+
+	// Every pixel belongs to one region
+	region_pixels = my_counts;
+	MPI_Allreduce ( &region_pixels, &covered_pixels, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD );
+
+	different_pixels = 0;
+	if ( rank == ROOT_NODE ) {
+		different_pixels = ( covered_pixels > (size_t)width * height ) ? \
+				   covered_pixels - (size_t)width * height : (size_t)width * height - covered_pixels;
+	}
+	if ( report_check ( rank, "Do_234Composition_Distributed ( Regions )", different_pixels, \
+			    ( rank == ROOT_NODE ) ? (size_t)width * height : 0 ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	Destroy_234Composition ( image_ID );
+
+	free ( reference_image );
+	free ( image );
+
+	MPI_Finalize();
+	return ( result );
+}
@@ -0,0 +1,210 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234file.c
+
+// @brief  Test program for 234Compositor
+//         Compare the image files written by Do_234Composition_File
+//         ( FILE_RAW and FILE_PNM ) with Do_234Composition
+//         mpicc -o test_234file test_234file.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define WIDTH  64
+#define HEIGHT 48
+
+#include "test_234check.h"
+
+BYTE* read_image_file ( const char*, unsigned int, size_t );
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height;
+	unsigned int image_ID;
+	unsigned int merge_ID;
+	unsigned int file_format;
+
+	size_t i;
+	size_t pixel_size;
+	size_t file_pixel_size;	// Bytes per pixel in the file
+	size_t different_pixels;
+	size_t checked_pixels;
+
+	BYTE* reference_image;
+	BYTE* image;
+	BYTE* file_image;
+
+	char* image_filename;
+
+	//=====================================
+	width    = WIDTH;
+	height   = HEIGHT;
+	image_ID = ID_RGBA32;
+	merge_ID = ALPHA;
+
+	if (( argc != 1 ) && ( argc < 3 )) {
+		printf ("\n Usage: %s Width Height [ Pixel_ID [ Merge_ID ] ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc >= 3 ) {
+		width  = atoi(argv[1]);
+		height = atoi(argv[2]);
+	}
+	if ( argc >= 4 ) {
+		image_ID = atoi(argv[3]);
+	}
+	if ( argc >= 5 ) {
+		merge_ID = atoi(argv[4]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	if (( pixel_size = get_pixel_size ( image_ID )) == 0 ) {
+		printf ("<<< ERROR >>> Pixel ID %u is not an interleaved pixel type \n", image_ID );
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	Init_234Composition ( rank, nnodes, width, height, image_ID );
+
+	// my_image also holds the blank pixels added for MPI_Gather
+	reference_image = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) );
+	image           = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) );
+	image_filename  = (char *)allocate_byte_memory_region( 255 );
+
+	if (( reference_image == NULL ) || ( image == NULL ) || ( image_filename == NULL )) {
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	checked_pixels = ( rank == ROOT_NODE ) ? (size_t)width * height : 0;
+
+	//=====================================
+	// Reference: Gathered image
+	//=====================================
+	generate_image ( rank, width, height, image_ID, reference_image );
+
+	// A single image is its own composition
+	if ( nnodes > 1 ) {
+		Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, reference_image, MPI_COMM_WORLD );
+	}
+
+	result = EXIT_SUCCESS;
+
+	for ( file_format = FILE_RAW; file_format <= FILE_PNM; file_format++ )
+	{
+		//=====================================
+		// Image file written by every node
+		//=====================================
+		generate_image ( rank, width, height, image_ID, image );
+
+		sprintf( image_filename, "output_file_%dx%d.%s", (int)width, (int)height, \
+			 ( file_format == FILE_RAW ) ? "raw" : "pnm" );
+
+		Do_234Composition_File ( rank, nnodes, width, height, image_ID, merge_ID, image, \
+					 image_filename, file_format, MPI_COMM_WORLD );
+
+		// RGB components of PPM ( BYTE ) and PFM ( Float )
+		file_pixel_size = pixel_size;
+		if ( file_format == FILE_PNM ) {
+			file_pixel_size = (( image_ID == ID_RGBA128 ) || ( image_ID == ID_RGBAZ160 )) ? RGB * sizeof(float) : RGB;
+		}
+
+		different_pixels = 0;
+		if ( rank == ROOT_NODE )
+		{
+			if (( file_image = read_image_file ( image_filename, ( file_format == FILE_RAW ) ? 2 : 3, \
+							     (size_t)width * height * file_pixel_size )) == NULL ) {
+				different_pixels = checked_pixels;
+			}
+			else if ( file_format == FILE_RAW ) {
+				different_pixels = count_different_pixels ( file_image, reference_image, 0, checked_pixels, pixel_size );
+				free ( file_image );
+			}
+			else {
+				for ( i = 0; i < checked_pixels; i++ ) {
+					if ( memcmp ( file_image + i * file_pixel_size, reference_image + i * pixel_size, file_pixel_size ) != 0 ) {
+						different_pixels++;
+					}
+				}
+				free ( file_image );
+			}
+		}
+
+		if ( report_check ( rank, ( file_format == FILE_RAW ) ? "Do_234Composition_File ( FILE_RAW )" : \
+									"Do_234Composition_File ( FILE_PNM )", \
+				    different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+	}
+
+	Destroy_234Composition ( image_ID );
+
+	free ( reference_image );
+	free ( image );
+	free ( image_filename );
+
+	MPI_Finalize();
+	return ( result );
+}
+
+/*========================================================*/
+/**
+ *  @brief Read the pixels of an image file written by
+ *         Do_234Composition_File
+ *
+ *  @param  image_filename [in] Filename
+ *  @param  header_lines   [in] Lines of the header
+ *  @param  pixels_size    [in] Bytes of the pixels
+ *
+ *  @return Pixels ( NULL: Wrong file )
+ */
+/*========================================================*/
+BYTE* read_image_file ( const char* image_filename, unsigned int header_lines, size_t pixels_size )
+{
+	FILE* in_fp;
+	BYTE* file_image;
+	int c;
+
+	if ( (in_fp = fopen( image_filename, "rb")) == NULL )
+	{
+		printf( "<<< ERROR >>> Cannot open \"%s\" for reading \n", image_filename );
+		return NULL;
+	}
+
+	// Header
+	while (( header_lines > 0 ) && (( c = fgetc ( in_fp )) != EOF )) {
+		if ( c == '\n' ) header_lines--;
+	}
+
+	if (( file_image = allocate_byte_memory_region( pixels_size + 1 )) == NULL ) {
+		fclose( in_fp );
+		return NULL;
+	}
+
+	// Pixels and nothing after them
+	if ( fread( file_image, 1, pixels_size + 1, in_fp ) != pixels_size )
+	{
+		printf( "<<< ERROR >>> Wrong size of \"%s\" \n", image_filename );
+		free ( file_image );
+		fclose( in_fp );
+		return NULL;
+	}
+
+	fclose( in_fp );
+	return file_image;
+}
@@ -0,0 +1,399 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234merge.c
+
+// @brief  Test program for 234Compositor
+//         Compare the merging modes and exchange options with
+//         Do_234Composition ( ALPHA or DEPTH ): ROI ( computed
+//         and given ), COMPRESS, SPARSE, Radix-k, chunked
+//         exchange, repeated compositions ( Persistent requests )
+//         and Ibegin_234Composition. Radix-k and SPARSE blend in
+//         another order, so their pixels may differ by rounding.
+//         Every node renders a rectangle of the image.
+//         mpicc -o test_234merge test_234merge.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define WIDTH  37
+#define HEIGHT 23
+
+#define ROUNDS        3		// Compositions with the same requests
+#define CHUNK_PIXELS  7		// Pixels per message of the chunked exchange
+#define FAR_DEPTH     1.0e6f	// Depth of the empty pixels
+#define FLOAT_ERROR   1.0e-5f	// Rounding error of the float values per stage
+
+#define NUM_CHECKS    7
+#define NOT_CHECKED   0xFFFFFFFF
+
+#include "test_234check.h"
+
+// Merging mode ( ALPHA and DEPTH pixel types ) and options of each check
+static const struct MergeCheck {
+	const char*  name;
+	unsigned int alpha_merge_ID;
+	unsigned int depth_merge_ID;
+	unsigned int radix;
+	unsigned int chunk_pixels;
+	_Bool        given_roi;	// Set_234Composition_ROI
+	_Bool        rounding;	// Pixels may differ by rounding
+} merge_check[ NUM_CHECKS ] = {
+	{ "ROI",                      ALPHA_ROI,      DEPTH_ROI,      0, 0,            false, false },
+	{ "ROI ( Given )",            ALPHA_ROI,      DEPTH_ROI,      0, 0,            true,  false },
+	{ "COMPRESS",                 ALPHA_COMPRESS, DEPTH_COMPRESS, 0, 0,            false, false },
+	{ "SPARSE",                   ALPHA_SPARSE,   NOT_CHECKED,    0, 0,            false, true  },
+	{ "Radix-k ( k = 4 )",        ALPHA,          DEPTH,          4, 0,            false, true  },
+	{ "Radix-k ( k = 8 )",        ALPHA,          DEPTH,          8, 0,            false, true  },
+	{ "Chunked exchange",         ALPHA,          DEPTH,          0, CHUNK_PIXELS, false, false }
+};
+
+/*========================================================*/
+/**
+ *  @brief Check if a pixel type has a depth value
+ *
+ *  @param  image_ID [in] Pixel type
+ */
+/*========================================================*/
+static _Bool has_depth ( unsigned int image_ID )
+{
+	return (( image_ID == ID_RGBAZ64 ) || ( image_ID == ID_RGBAZ160 ) || \
+		( image_ID == ID_RGBAZ88 ) || ( image_ID == ID_RGBAZ96  ));
+}
+
+/*========================================================*/
+/**
+ *  @brief Rectangle rendered by a node ( Half of the image )
+ *
+ *  @param  my_rank [in]  MPI rank number
+ *  @param  width   [in]  Image width
+ *  @param  height  [in]  Image height
+ *  @param  roi     [out] x, y, width and height
+ */
+/*========================================================*/
+static void get_node_rectangle ( int my_rank, unsigned int width, unsigned int height, \
+				 unsigned int* roi )
+{
+	roi[ 2 ] = ( width  + 1 ) / 2;
+	roi[ 3 ] = ( height + 1 ) / 2;
+	roi[ 0 ] = ( 3 * my_rank ) % ( width  - roi[ 2 ] + 1 );
+	roi[ 1 ] = ( 2 * my_rank ) % ( height - roi[ 3 ] + 1 );
+}
+
+/*========================================================*/
+/**
+ *  @brief Generate the test image of a node inside its
+ *         rectangle. Empty pixels are behind every other
+ *         pixel ( DEPTH ).
+ *
+ *  @param  my_rank  [in]  MPI rank number
+ *  @param  width    [in]  Image width
+ *  @param  height   [in]  Image height
+ *  @param  image_ID [in]  Pixel type
+ *  @param  image    [out] Generated image
+ */
+/*========================================================*/
+static void generate_rectangle_image ( int my_rank, unsigned int width, unsigned int height, \
+				       unsigned int image_ID, BYTE* image )
+{
+	unsigned int x, y;
+	unsigned int roi[ 4 ];
+
+	size_t pixel_size;
+	size_t color_size;
+	size_t i;
+
+	float far_depth;
+	BYTE* image_ptr;
+
+	generate_image ( my_rank, width, height, image_ID, image );
+	get_node_rectangle ( my_rank, width, height, roi );
+
+	pixel_size = get_pixel_size ( image_ID );
+	color_size = has_depth ( image_ID ) ? ( pixel_size - sizeof(float) ) : pixel_size;
+	far_depth  = FAR_DEPTH;
+
+	image_ptr = image;
+	for ( y = 0; y < height; y++ )
+	{
+		for ( x = 0; x < width; x++, image_ptr += pixel_size )
+		{
+			if (( x < roi[ 0 ] ) || ( x >= roi[ 0 ] + roi[ 2 ] ) || \
+			    ( y < roi[ 1 ] ) || ( y >= roi[ 1 ] + roi[ 3 ] )) {
+				memset ( image_ptr, 0, color_size );
+			}
+
+			if ( has_depth ( image_ID ) == false ) {
+				continue;
+			}
+
+			for ( i = 0; i < color_size; i++ ) {
+				if ( image_ptr[ i ] != 0 ) break;
+			}
+			if ( i == color_size ) {
+				memcpy ( image_ptr + color_size, &far_depth, sizeof(float) );
+			}
+		}
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Count the pixels that differ from the reference
+ *         image by more than the rounding error of the
+ *         blending stages ( 1 for BYTE values and FLOAT_ERROR
+ *         for float values per stage )
+ *
+ *  @param  image      [in] Pixels to be checked
+ *  @param  reference  [in] Reference image
+ *  @param  counts     [in] Number of pixels
+ *  @param  image_ID   [in] Pixel type
+ *  @param  num_stages [in] Blending stages ( log2 of nnodes )
+ */
+/*========================================================*/
+static size_t count_rounded_pixels ( const BYTE* image, const BYTE* reference, \
+				     size_t counts, unsigned int image_ID, \
+				     unsigned int num_stages )
+{
+	size_t i, j;
+	size_t pixel_size;
+	size_t byte_size;	// BYTE values ( RGB, alpha or padding ) before the float values
+	size_t different_pixels;
+
+	float value, reference_value;
+	_Bool different;
+
+	pixel_size = get_pixel_size ( image_ID );
+
+	switch ( image_ID )
+	{
+		case ID_RGBA32  :
+		case ID_RGBAZ64 :
+		case ID_RGBA64  :
+		case ID_RGBAZ96 : byte_size = RGBA;
+				  break;
+		case ID_RGBA56  :
+		case ID_RGBAZ88 : byte_size = RGB;
+				  break;
+		default         : byte_size = 0;
+				  break;
+	}
+
+	different_pixels = 0;
+	for ( i = 0; i < counts; i++ )
+	{
+		different = false;
+
+		for ( j = 0; j < byte_size; j++ ) {
+			if ( abs ( (int)image[ j ] - (int)reference[ j ] ) > (int)num_stages ) different = true;
+		}
+		for ( j = byte_size; j < pixel_size; j += sizeof(float) ) {
+			memcpy ( &value, image + j, sizeof(float) );
+			memcpy ( &reference_value, reference + j, sizeof(float) );
+
+			if ((( value - reference_value ) > num_stages * FLOAT_ERROR ) || \
+			    (( reference_value - value ) > num_stages * FLOAT_ERROR )) different = true;
+		}
+
+		if ( different == true ) {
+			different_pixels++;
+		}
+		image     += pixel_size;
+		reference += pixel_size;
+	}
+	return different_pixels;
+}
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height;
+	unsigned int image_ID;
+	unsigned int first_ID, last_ID;
+	unsigned int merge_ID;
+	unsigned int base_merge_ID;
+	unsigned int roi[ 4 ];
+	unsigned int round;
+	unsigned int num_stages;
+	unsigned int k;
+
+	size_t output_size;
+	size_t pixel_size;
+	size_t different_pixels;
+	size_t checked_pixels;
+
+	BYTE* reference_image;
+	BYTE* image;
+
+	Compositor234_Request* request;
+
+	char test_name[ 64 ];
+
+	//=====================================
+	width    = WIDTH;
+	height   = HEIGHT;
+	first_ID = ID_RGBA32;
+	last_ID  = ID_RGBAZ96;
+
+	if (( argc != 1 ) && ( argc < 3 )) {
+		printf ("\n Usage: %s Width Height [ Pixel_ID ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc >= 3 ) {
+		width  = atoi(argv[1]);
+		height = atoi(argv[2]);
+	}
+	if ( argc >= 4 ) {
+		first_ID = last_ID = atoi(argv[3]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	result = EXIT_SUCCESS;
+
+	// Blending stages of the composition ( Rounding errors )
+	num_stages = 1;
+	for ( k = 2; k < (unsigned int)nnodes; k *= 2 ) {
+		num_stages++;
+	}
+
+	for ( image_ID = first_ID; image_ID <= last_ID; image_ID++ )
+	{
+		if (( pixel_size = get_pixel_size ( image_ID )) == 0 ) {
+			printf ("<<< ERROR >>> Pixel ID %u is not an interleaved pixel type \n", image_ID );
+			MPI_Finalize();
+			exit ( EXIT_FAILURE );
+		}
+
+		base_merge_ID = has_depth ( image_ID ) ? DEPTH : ALPHA;
+
+		Init_234Composition ( rank, nnodes, width, height, image_ID );
+
+		// my_image also holds the blank pixels added for MPI_Gather
+		output_size = Get_234Composition_Output_Size ( );
+
+		reference_image = allocate_byte_memory_region( output_size );
+		image           = allocate_byte_memory_region( output_size );
+
+		if (( reference_image == NULL ) || ( image == NULL )) {
+			MPI_Finalize();
+			exit ( EXIT_FAILURE );
+		}
+
+		checked_pixels = ( rank == ROOT_NODE ) ? (size_t)width * height : 0;
+
+		//=====================================
+		// Reference: ALPHA or DEPTH
+		//=====================================
+		generate_rectangle_image ( rank, width, height, image_ID, reference_image );
+
+		Do_234Composition ( rank, nnodes, width, height, image_ID, base_merge_ID, \
+				    reference_image, MPI_COMM_WORLD );
+
+		//=====================================
+		// Merging modes and exchange options
+		//=====================================
+		for ( k = 0; k < NUM_CHECKS; k++ )
+		{
+			merge_ID = ( base_merge_ID == ALPHA ) ? merge_check[ k ].alpha_merge_ID : \
+								merge_check[ k ].depth_merge_ID;
+			if ( merge_ID == NOT_CHECKED ) {
+				continue;
+			}
+
+			generate_rectangle_image ( rank, width, height, image_ID, image );
+
+			if ( merge_check[ k ].given_roi == true ) {
+				get_node_rectangle ( rank, width, height, roi );
+				Set_234Composition_ROI ( roi[ 0 ], roi[ 1 ], roi[ 2 ], roi[ 3 ] );
+			}
+			Set_234Composition_Radix ( merge_check[ k ].radix );
+			Set_234Composition_Chunk ( image_ID, merge_check[ k ].chunk_pixels );
+
+			if ( Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, \
+						 image, MPI_COMM_WORLD ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+			}
+
+			Set_234Composition_Radix ( 0 );
+			Set_234Composition_Chunk ( image_ID, 0 );
+
+			different_pixels = 0;
+			if ( rank == ROOT_NODE ) {
+				different_pixels = ( merge_check[ k ].rounding == true ) ? \
+					count_rounded_pixels ( image, reference_image, checked_pixels, image_ID, num_stages ) : \
+					count_different_pixels ( image, reference_image, 0, checked_pixels, pixel_size );
+			}
+
+			sprintf ( test_name, "%s ( ID %u )", merge_check[ k ].name, image_ID );
+			if ( report_check ( rank, test_name, different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+			}
+		}
+
+		//=====================================
+		// Same exchanges as the previous composition
+		// ( Persistent requests restarted )
+		//=====================================
+		different_pixels = 0;
+		for ( round = 0; round < ROUNDS; round++ )
+		{
+			generate_rectangle_image ( rank, width, height, image_ID, image );
+
+			Do_234Composition ( rank, nnodes, width, height, image_ID, base_merge_ID, \
+					    image, MPI_COMM_WORLD );
+
+			if ( rank == ROOT_NODE ) {
+				different_pixels += count_different_pixels ( image, reference_image, 0, checked_pixels, pixel_size );
+			}
+		}
+
+		sprintf ( test_name, "Persistent requests ( ID %u )", image_ID );
+		if ( report_check ( rank, test_name, different_pixels, ROUNDS * checked_pixels ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+
+		//=====================================
+		// Non-blocking composition
+		//=====================================
+		generate_rectangle_image ( rank, width, height, image_ID, image );
+
+		if ( Ibegin_234Composition ( rank, nnodes, width, height, image_ID, base_merge_ID, \
+					     image, MPI_COMM_WORLD, &request ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+		else {
+			Wait_234Composition ( &request );
+		}
+
+		different_pixels = 0;
+		if ( rank == ROOT_NODE ) {
+			different_pixels = count_different_pixels ( image, reference_image, 0, checked_pixels, pixel_size );
+		}
+
+		sprintf ( test_name, "Ibegin_234Composition ( ID %u )", image_ID );
+		if ( report_check ( rank, test_name, different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+
+		Destroy_234Composition ( image_ID );
+
+		free ( reference_image );
+		free ( image );
+	}
+
+	MPI_Finalize();
+	return ( result );
+}
@@ -0,0 +1,215 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234output.c
+
+// @brief  Test program for 234Compositor
+//         Compare the image of the registered output buffer
+//         ( Set_234Composition_Output ), of Do_234Composition_View
+//         and of Do_234Composition_Ptr with Do_234Composition.
+//         Also my_image of Do_234ZComposition ( ALPHA: RGBA32 and
+//         RGBA128 ) with the depth of every node in rank order
+//         mpicc -o test_234output test_234output.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define WIDTH  64
+#define HEIGHT 48
+
+#include "test_234check.h"
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height;
+	unsigned int image_ID;
+	unsigned int merge_ID;
+	unsigned int composition;
+
+	size_t i;
+	size_t output_size;
+	size_t pixel_size;
+	size_t different_pixels;
+	size_t checked_pixels;
+
+	BYTE* reference_image;
+	BYTE* image;
+	BYTE* output_image;
+
+	float* depth;
+	void* view;
+	void* gathered_image;
+
+	//=====================================
+	width    = WIDTH;
+	height   = HEIGHT;
+	image_ID = ID_RGBA32;
+	merge_ID = ALPHA;
+
+	if (( argc != 1 ) && ( argc < 3 )) {
+		printf ("\n Usage: %s Width Height [ Pixel_ID [ Merge_ID ] ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc >= 3 ) {
+		width  = atoi(argv[1]);
+		height = atoi(argv[2]);
+	}
+	if ( argc >= 4 ) {
+		image_ID = atoi(argv[3]);
+	}
+	if ( argc >= 5 ) {
+		merge_ID = atoi(argv[4]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	if (( pixel_size = get_pixel_size ( image_ID )) == 0 ) {
+		printf ("<<< ERROR >>> Pixel ID %u is not an interleaved pixel type \n", image_ID );
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	Init_234Composition ( rank, nnodes, width, height, image_ID );
+
+	// my_image also holds the blank pixels added for MPI_Gather
+	output_size = Get_234Composition_Output_Size ( );
+
+	reference_image = allocate_byte_memory_region( output_size );
+	image           = allocate_byte_memory_region( output_size );
+	output_image    = allocate_byte_memory_region( output_size );
+
+	if (( reference_image == NULL ) || ( image == NULL ) || ( output_image == NULL )) {
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	checked_pixels = ( rank == ROOT_NODE ) ? (size_t)width * height : 0;
+
+	//=====================================
+	// Reference: Image gathered in my_image
+	//=====================================
+	generate_image ( rank, width, height, image_ID, reference_image );
+
+	// A single image is its own composition
+	if ( nnodes > 1 ) {
+		Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, reference_image, MPI_COMM_WORLD );
+	}
+
+	//=====================================
+	// Registered output buffer ( Twice: reused )
+	//=====================================
+	result = EXIT_SUCCESS;
+
+	Set_234Composition_Output ( output_image, output_size );
+
+	for ( composition = 0; composition < 2; composition++ )
+	{
+		generate_image ( rank, width, height, image_ID, image );
+		memset ( output_image, 0, output_size );
+
+		Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, image, MPI_COMM_WORLD );
+
+		different_pixels = 0;
+		if ( rank == ROOT_NODE ) {
+			different_pixels = count_different_pixels ( output_image, reference_image, 0, checked_pixels, pixel_size );
+		}
+		if ( report_check ( rank, "Set_234Composition_Output", different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+	}
+
+	Set_234Composition_Output ( NULL, 0 );
+
+	//=====================================
+	// Borrowed view of the gathered image
+	//=====================================
+	generate_image ( rank, width, height, image_ID, image );
+
+	Do_234Composition_View ( rank, nnodes, width, height, image_ID, merge_ID, image, &view, MPI_COMM_WORLD );
+
+	different_pixels = 0;
+	if ( rank == ROOT_NODE ) {
+		different_pixels = ( view == NULL ) ? checked_pixels : \
+				   count_different_pixels ( view, reference_image, 0, checked_pixels, pixel_size );
+	}
+	else if ( view != NULL ) {
+		printf ("<<< ERROR >>> MPI Rank [%d]: View given to a node other than the ROOT_NODE \n", rank );
+		result = EXIT_FAILURE;
+	}
+	if ( report_check ( rank, "Do_234Composition_View", different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	// The next composition needs the view back
+	if ( Release_234Composition_View ( view ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	//=====================================
+	// Image returned by Do_234Composition_Ptr
+	//=====================================
+	generate_image ( rank, width, height, image_ID, image );
+
+	gathered_image = Do_234Composition_Ptr ( rank, nnodes, width, height, image_ID, merge_ID, image, MPI_COMM_WORLD );
+
+	different_pixels = 0;
+	if ( rank == ROOT_NODE ) {
+		different_pixels = ( gathered_image == NULL ) ? checked_pixels : \
+				   count_different_pixels ( gathered_image, reference_image, 0, checked_pixels, pixel_size );
+	}
+	if ( report_check ( rank, "Do_234Composition_Ptr", different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	//=====================================
+	// Image gathered in my_image by Do_234ZComposition 
+	// ( Visibility order: rank order )
+	//=====================================
+	if (( merge_ID == ALPHA ) && (( image_ID == ID_RGBA32 ) || ( image_ID == ID_RGBA128 )))
+	{
+		if (( depth = allocate_float_memory_region( (size_t)width * height )) == NULL ) {
+			MPI_Finalize();
+			exit ( EXIT_FAILURE );
+		}
+
+		for ( i = 0; i < (size_t)width * height; i++ ) {
+			depth[ i ] = (float)rank;
+		}
+
+		generate_image ( rank, width, height, image_ID, image );
+
+		Do_234ZComposition ( rank, nnodes, width, height, image_ID, merge_ID, image, depth, MPI_COMM_WORLD );
+
+		different_pixels = 0;
+		if ( rank == ROOT_NODE ) {
+			different_pixels = count_different_pixels ( image, reference_image, 0, checked_pixels, pixel_size );
+		}
+		if ( report_check ( rank, "Do_234ZComposition", different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+			result = EXIT_FAILURE;
+		}
+
+		free ( depth );
+	}
+
+	Destroy_234Composition ( image_ID );
+
+	free ( reference_image );
+	free ( image );
+	free ( output_image );
+
+	MPI_Finalize();
+	return ( result );
+}
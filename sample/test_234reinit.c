@@ -0,0 +1,220 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234reinit.c
+
+// @brief  Test program for 234Compositor
+//         Repeat Init_234Composition, Do_234Composition and
+//         Destroy_234Composition with other image sizes and pixel
+//         types ( Communicators reused ), and with a hierarchical
+//         composition in between ( Communicators rebuilt ). Every
+//         image is compared with the image of a new context.
+//         Then check that a second Init_234Composition and
+//         Destroy_234Composition cycle gets the temporary buffers
+//         of the first one back from the memory pool
+//         mpicc -o test_234reinit test_234reinit.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define ROUNDS 2
+#define CONFIGURATIONS 3
+#define HIERARCHICAL   1	// RGBAZ64: DEPTH does not depend on the blending order
+#define POOL_RADIX     4	// Radix-k: Do_234Composition grows the temporary buffer
+
+#include "test_234check.h"
+
+// Temporary buffers of the context ( Library internals )
+#include "context.h"
+
+// Width, height, pixel type and merging mode of each Init_234Composition
+static const unsigned int configuration[ CONFIGURATIONS ][ 4 ] = {
+	{ 37, 23, ID_RGBA32,  ALPHA },
+	{ 64, 48, ID_RGBAZ64, DEPTH },
+	{ 29, 31, ID_RGBA128, ALPHA }
+};
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height;
+	unsigned int image_ID;
+	unsigned int merge_ID;
+	unsigned int rounds;
+	unsigned int round;
+	unsigned int k;
+	unsigned int c;
+
+	size_t output_size;
+	size_t pixel_size;
+	size_t different_pixels;
+	size_t checked_pixels;
+	size_t different_buffers;
+
+	BYTE* reference_image[ CONFIGURATIONS ];
+	BYTE* image;
+
+	BYTE* init_buffer[ 2 ];	// Temporary buffer after Init_234Composition
+	BYTE* comp_buffer[ 2 ];	// Temporary buffer after Do_234Composition
+
+	Compositor234_Context* context;
+
+	char test_name[ 64 ];
+
+	//=====================================
+	rounds = ROUNDS;
+
+	if ( argc > 2 ) {
+		printf ("\n Usage: %s [ Rounds ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc == 2 ) {
+		rounds = atoi(argv[1]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	result = EXIT_SUCCESS;
+
+	//=====================================
+	// Reference: Image of a new context
+	//=====================================
+	for ( k = 0; k < CONFIGURATIONS; k++ )
+	{
+		width    = configuration[ k ][ 0 ];
+		height   = configuration[ k ][ 1 ];
+		image_ID = configuration[ k ][ 2 ];
+		merge_ID = configuration[ k ][ 3 ];
+
+		Init_234Composition_Context ( &context, rank, nnodes, width, height, image_ID );
+
+		// my_image also holds the blank pixels added for MPI_Gather
+		if (( reference_image[ k ] = allocate_byte_memory_region( \
+			Get_234Composition_Output_Size_Context ( context ) )) == NULL ) {
+			MPI_Finalize();
+			exit ( EXIT_FAILURE );
+		}
+
+		generate_image ( rank, width, height, image_ID, reference_image[ k ] );
+
+		Do_234Composition_Context ( context, rank, nnodes, width, height, image_ID, merge_ID, \
+					    reference_image[ k ], MPI_COMM_WORLD );
+		Destroy_234Composition_Context ( context, image_ID );
+	}
+
+	//=====================================
+	// Init_234Composition of every configuration,
+	// then a hierarchical composition
+	//=====================================
+	for ( round = 0; round < rounds; round++ )
+	{
+		for ( k = 0; k <= CONFIGURATIONS; k++ )
+		{
+			// Last: Hierarchical composition
+			c = ( k == CONFIGURATIONS ) ? HIERARCHICAL : k;
+
+			width    = configuration[ c ][ 0 ];
+			height   = configuration[ c ][ 1 ];
+			image_ID = configuration[ c ][ 2 ];
+			merge_ID = configuration[ c ][ 3 ];
+
+			pixel_size = get_pixel_size ( image_ID );
+
+			if ( k == CONFIGURATIONS ) {
+				Init_234Composition_Hierarchical ( rank, nnodes, width, height, image_ID );
+				sprintf ( test_name, "Init_234Composition_Hierarchical [%u]", round );
+			}
+			else {
+				Init_234Composition ( rank, nnodes, width, height, image_ID );
+				sprintf ( test_name, "Init_234Composition [%u] ( ID %u )", round, image_ID );
+			}
+
+			// my_image also holds the blank pixels added for MPI_Gather
+			output_size = Get_234Composition_Output_Size ( );
+			if ( output_size < (size_t)width * height * pixel_size ) {
+				output_size = (size_t)width * height * pixel_size;
+			}
+
+			if (( image = allocate_byte_memory_region( output_size )) == NULL ) {
+				MPI_Finalize();
+				exit ( EXIT_FAILURE );
+			}
+
+			generate_image ( rank, width, height, image_ID, image );
+
+			Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, image, MPI_COMM_WORLD );
+			Destroy_234Composition ( image_ID );
+
+			checked_pixels   = ( rank == ROOT_NODE ) ? (size_t)width * height : 0;
+			different_pixels = 0;
+			if ( rank == ROOT_NODE ) {
+				different_pixels = count_different_pixels ( image, reference_image[ c ], 0, checked_pixels, pixel_size );
+			}
+			if ( report_check ( rank, test_name, different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+			}
+
+			free ( image );
+		}
+	}
+
+	//=====================================
+	// Memory pool: the temporary buffers of the first cycle 
+	// ( also the one replaced when it grew ) come back in the 
+	// second cycle
+	//=====================================
+	width    = configuration[ 0 ][ 0 ];
+	height   = configuration[ 0 ][ 1 ];
+	image_ID = configuration[ 0 ][ 2 ];
+	merge_ID = configuration[ 0 ][ 3 ];
+
+	Release_234Composition_Memory ( );
+
+	for ( round = 0; round < 2; round++ )
+	{
+		Init_234Composition ( rank, nnodes, width, height, image_ID );
+		init_buffer[ round ] = temp_image_rgba32;
+
+		// Sized for Binary-Swap by Init_234Composition
+		Set_234Composition_Radix ( POOL_RADIX );
+
+		if (( image = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) )) == NULL ) {
+			MPI_Finalize();
+			exit ( EXIT_FAILURE );
+		}
+
+		generate_image ( rank, width, height, image_ID, image );
+
+		Do_234Composition ( rank, nnodes, width, height, image_ID, merge_ID, image, MPI_COMM_WORLD );
+		comp_buffer[ round ] = temp_image_rgba32;
+
+		Set_234Composition_Radix ( 0 );
+		Destroy_234Composition ( image_ID );
+
+		free ( image );
+	}
+
+	different_buffers = ( init_buffer[ 0 ] != init_buffer[ 1 ] ) + ( comp_buffer[ 0 ] != comp_buffer[ 1 ] );
+	if ( report_check ( rank, "Init_234Composition ( Memory pool )", different_buffers, 2 ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	for ( k = 0; k < CONFIGURATIONS; k++ ) {
+		free ( reference_image[ k ] );
+	}
+
+	MPI_Finalize();
+	return ( result );
+}
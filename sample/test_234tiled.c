@@ -0,0 +1,208 @@
+/**********************************************************/
+/**
+ * 234Compositor - Image data merging library
+ *
+ * Copyright (c) 2013-2015 Advanced Institute for Computational Science, RIKEN.
+ * All rights reserved.
+ *
+ **/
+/**********************************************************/
+
+// @file   test_234tiled.c
+
+// @brief  Test program for 234Compositor
+//         Compare Do_234Composition_Tiled with Do_234Composition.
+//         The default tile height does not divide the image
+//         height ( Smaller last tile )
+//         mpicc -o test_234tiled test_234tiled.c -lm lib234comp.a
+
+// @author Jorji Nonaka (jorji@riken.jp)
+
+#define WIDTH       64
+#define HEIGHT      48
+#define TILE_HEIGHT 7
+
+#include "test_234check.h"
+
+// Images read and written by the tile functions
+typedef struct
+{
+	BYTE* input_image;	// Image of my node
+	BYTE* output_image;	// Composited image ( ROOT_NODE )
+	size_t pixel_size;
+} Tile_Images;
+
+int load_image_tile  ( void*, unsigned int, unsigned int, unsigned int, void* );
+int store_image_tile ( void*, unsigned int, unsigned int, unsigned int, void* );
+
+int main( int argc, char* argv[] )
+{
+	int rank;
+	int nnodes;
+	int result;
+
+	unsigned int width, height, tile_height;
+	unsigned int image_ID;
+	unsigned int merge_ID;
+
+	size_t image_size;
+	size_t pixel_size;
+	size_t different_pixels;
+	size_t checked_pixels;
+
+	BYTE* reference_image;
+	BYTE* image;
+	BYTE* input_image;
+	BYTE* output_image;
+
+	Tile_Images tile_images;
+
+	//=====================================
+	width       = WIDTH;
+	height      = HEIGHT;
+	tile_height = TILE_HEIGHT;
+	image_ID    = ID_RGBA32;
+	merge_ID    = ALPHA;
+
+	if (( argc != 1 ) && ( argc < 4 )) {
+		printf ("\n Usage: %s Width Height Tile_Height [ Pixel_ID [ Merge_ID ] ]\n\n", argv[0] );
+		exit( EXIT_FAILURE );
+	}
+	if ( argc >= 4 ) {
+		width       = atoi(argv[1]);
+		height      = atoi(argv[2]);
+		tile_height = atoi(argv[3]);
+	}
+	if ( argc >= 5 ) {
+		image_ID = atoi(argv[4]);
+	}
+	if ( argc >= 6 ) {
+		merge_ID = atoi(argv[5]);
+	}
+
+	//=====================================
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &nnodes);
+
+	if (( pixel_size = get_pixel_size ( image_ID )) == 0 ) {
+		printf ("<<< ERROR >>> Pixel ID %u is not an interleaved pixel type \n", image_ID );
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	image_size = (size_t)width * height * pixel_size;
+
+	//=====================================
+	// Reference: Whole image
+	//=====================================
+	Init_234Composition ( rank, nnodes, width, height, image_ID );
+
+	// my_image also holds the blank pixels added for MPI_Gather
+	reference_image = allocate_byte_memory_region( Get_234Composition_Output_Size ( ) );
+	image           = allocate_byte_memory_region( image_size );
+	input_image     = allocate_byte_memory_region( image_size );
+	output_image    = allocate_byte_memory_region( image_size );
+
+	if (( reference_image == NULL ) || ( image == NULL ) || \
+	    ( input_image == NULL ) || ( output_image == NULL )) {
+		MPI_Finalize();
+		exit ( EXIT_FAILURE );
+	}
+
+	checked_pixels = ( rank == ROOT_NODE ) ? (size_t)width * height : 0;
+
+	generate_image ( rank, width, height, image_ID, reference_image );
+
+	Do_234Composition   ( rank, nnodes, width, height, image_ID, merge_ID, reference_image, MPI_COMM_WORLD );
+	Destroy_234Composition ( image_ID );
+
+	//=====================================
+	// Tiles copied from and into my_image
+	//=====================================
+	generate_image ( rank, width, height, image_ID, image );
+
+	Init_234Composition     ( rank, nnodes, width, tile_height, image_ID );
+	Do_234Composition_Tiled ( rank, nnodes, width, height, tile_height, image_ID, merge_ID, \
+				  image, NULL, NULL, NULL, MPI_COMM_WORLD );
+
+	different_pixels = 0;
+	if ( rank == ROOT_NODE ) {
+		different_pixels = count_different_pixels ( image, reference_image, 0, checked_pixels, pixel_size );
+	}
+	result = report_check ( rank, "Do_234Composition_Tiled", different_pixels, checked_pixels );
+
+	//=====================================
+	// Tiles read and written by the tile functions
+	//=====================================
+	generate_image ( rank, width, height, image_ID, input_image );
+	memset ( output_image, 0, image_size );
+
+	tile_images.input_image  = input_image;
+	tile_images.output_image = output_image;
+	tile_images.pixel_size   = pixel_size;
+
+	Do_234Composition_Tiled ( rank, nnodes, width, height, tile_height, image_ID, merge_ID, \
+				  NULL, load_image_tile, store_image_tile, &tile_images, MPI_COMM_WORLD );
+	Destroy_234Composition ( image_ID );
+
+	different_pixels = 0;
+	if ( rank == ROOT_NODE ) {
+		different_pixels = count_different_pixels ( output_image, reference_image, 0, checked_pixels, pixel_size );
+	}
+	if ( report_check ( rank, "Do_234Composition_Tiled ( Tile functions )", different_pixels, checked_pixels ) == EXIT_FAILURE ) {
+		result = EXIT_FAILURE;
+	}
+
+	free ( reference_image );
+	free ( image );
+	free ( input_image );
+	free ( output_image );
+
+	MPI_Finalize();
+	return ( result );
+}
+
+/*========================================================*/
+/**
+ *  @brief Read a tile of my image
+ *
+ *  @param  tile_image  [out] Tile
+ *  @param  tile_y      [in]  First row of the tile
+ *  @param  width       [in]  Image width
+ *  @param  tile_height [in]  Rows of the tile
+ *  @param  user_data   [in]  Tile_Images
+ */
+/*========================================================*/
+int load_image_tile ( void* tile_image, unsigned int tile_y, \
+		      unsigned int width, unsigned int tile_height, void* user_data )
+{
+	Tile_Images* tile_images = (Tile_Images *)user_data;
+
+	memcpy ( tile_image, tile_images->input_image + (size_t)tile_y * width * tile_images->pixel_size, \
+		 (size_t)width * tile_height * tile_images->pixel_size );
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Write a composited tile to the output image
+ *
+ *  @param  tile_image  [in] Composited tile
+ *  @param  tile_y      [in] First row of the tile
+ *  @param  width       [in] Image width
+ *  @param  tile_height [in] Rows of the tile
+ *  @param  user_data   [in] Tile_Images
+ */
+/*========================================================*/
+int store_image_tile ( void* tile_image, unsigned int tile_y, \
+		       unsigned int width, unsigned int tile_height, void* user_data )
+{
+	Tile_Images* tile_images = (Tile_Images *)user_data;
+
+	memcpy ( tile_images->output_image + (size_t)tile_y * width * tile_images->pixel_size, tile_image, \
+		 (size_t)width * tile_height * tile_images->pixel_size );
+
+	return EXIT_SUCCESS;
+}
@@ -35,483 +35,3416 @@
 	#define COMPOSITOR234_MERGE_H_INCLUDE
 #endif
 
+#ifndef COMPOSITOR234_CONTEXT_H_INCLUDE
+	#include "context.h"
+	#define COMPOSITOR234_CONTEXT_H_INCLUDE
+#endif
+
+// ======================================
+//	    COMPOSITING CONTEXT
+// ======================================
+
+// Context used by Init_234Composition, Do_234Composition, ...
+static Compositor234_Context default_context;
+
+// Context in use by the calling thread
+COMPOSITOR234_THREAD_LOCAL Compositor234_Context* compositor_context = &default_context;
+
+// Communicator of the 234 + Binary-Swap ( Node leaders: See Init_234Composition_Hierarchical )
+#define MPI_COMM_234BASE ( ( use_hierarchy == true ) ? MPI_COMM_LEADERS : MPI_COMM_WORLD )
+
+struct RankDepth {
+	int   rank;
+	float depth;
+} ;
+
+int MyQSortComparator(const void* a , const void* b)
+{
+	struct RankDepth *x, *y;
+
+	x = (struct RankDepth *)a;
+	y = (struct RankDepth *)b;
+
+	// Closest in Front ( Ties in rank order )
+	if ( x -> depth < y -> depth ) return -1;
+	if ( x -> depth > y -> depth ) return  1;
+
+	return ( x -> rank ) - ( y -> rank );
+}
+
+/*========================================================*/
+/**
+ *  @brief Create the communicators derived from the 
+ *         compositing communicator: bit-reversed ranks 
+ *         (Binary-Swap) or the 2-3-4 groups and the 2nd 
+ *         stage Binary-Swap nodes (2-3-4 Decomposition)
+ *         
+ *  @param  my_rank [in] Rank (comm)
+ *  @param  nnodes  [in] Number of nodes (comm)
+ *  @param  comm    [in] MPI Communicator
+*/
+/*========================================================*/
+static int create_234_communicators ( unsigned int my_rank, unsigned int nnodes, MPI_Comm comm )
+{
+	unsigned int i;
+
+	MPI_COMM_BITREV        = MPI_COMM_NULL;
+	MPI_COMM_234           = MPI_COMM_NULL;
+	MPI_COMM_STAGE2_BSWAP  = MPI_COMM_NULL;
+	MPI_COMM_STAGE2_BITREV = MPI_COMM_NULL;
+	group_bswap = NULL;
+
+	if ( check_pow2 ( nnodes ) == true ) 
+ 	{
+		// =======================================  
+		// 	TRADITIONAL BINARY-SWAP
+		// =======================================  
+		is_power_of_two = true; 	// Power-of-two number of nodes 
+
+		// =======================================  
+		// 	Prepare bit-reverse order communicator
+		//  for MPI_Gather without reconstruction
+		// =======================================  
+		bitrev_my_rank  = bitrevorder ( my_rank, nnodes ); // Get new Rank (Bit-reversed order)
+		bitrev_my_group = 1; // Color for new MPI communicator 
+							 // 1 unique color = 1 group of communicator		
+
+		// Generate a new MPI communicator with bit-reversed ranks
+		MPI_Comm_split ( comm, bitrev_my_group, bitrev_my_rank, &MPI_COMM_BITREV ); 
+		MPI_Comm_rank  ( MPI_COMM_BITREV, (int *)&bitrev_my_rank );	// New Rank inside MPI_COMM_BITREV
+		MPI_Comm_size  ( MPI_COMM_BITREV, (int *)&bitrev_nnodes  );	// NUmber of nodes in MPI_COMM_BITREV
+	}
+	else  
+	{
+		// =======================================  
+		// 	 2-3-4 DECOMPOSIITON
+		// =======================================  
+		is_power_of_two = false; 	// Non-power-of-two number of nodes 
+
+		// GROUPS of (2 and 3) or (3 and 4)
+		//
+		// 2-3 : 2^n < m < 2^n + 2^(n-1)
+		// 3-3 : 2^n + 2^(n-1)
+		// 3-4 : 2^n + 2^(n-1) < m < 2^(n+1)
+		//
+		// Example: n = 2
+		//	        2-3: m = 5 (4 < m < 6)
+		//			3-3: m = 6
+		//			3-4: m = 7 (6 < m < 8)
+
+		// =======================================  
+		// 	Number of nodes != Power-of-two (2^n)
+		// =======================================  
+
+		// Obtain the nearest power of two, that is,  2^(n+1) 
+		// Should be smaller than number of nodes
+		near_pow2 = get_nearest_pow2 ( nnodes ); 
+										
+		// Obtain the value of 2^(n) 				 
+		ngroups_234 = near_pow2 * 0.5;  
+
+		base_234 = floor ( nnodes / ngroups_234 );
+		over_234 = nnodes % ngroups_234;			
+
+		// Calculate threshold for choosing 2-3 or 3-4
+		// 2^(n) + 2^(n-1) 
+ 		threshold_234 = nnodes - ( over_234 * ( base_234 + 1 ) ); 
+
+		if ( my_rank < threshold_234 ) 
+		{
+			// 2-3 (GROUPS of 2 and 3)
+			my_group_234 = floor ( my_rank / base_234 ); 		
+		} 
+		else  
+		{
+			// 3-4 (GROUPS of 3 and 4)
+			my_group_234 = ( ngroups_234 - over_234 ) +	(( my_rank - threshold_234 ) / ( base_234 + 1 ));
+		}
+
+		// Generate new MPI communciators for each of the 2-3-4 groups
+		MPI_Comm_split ( comm, my_group_234, my_rank, &MPI_COMM_234 ); 
+		MPI_Comm_rank ( MPI_COMM_234, &my_rank_234 ); 
+		MPI_Comm_size ( MPI_COMM_234, &nnodes_234 ); 
+
+		// =======================================
+		// 	2nd stage Binary-Swap
+		// =======================================
+
+		// List of nodes (2nd stage Binary-Swap) 
+		// Local root node (n) and its neighbor (n+1)
+		group_bswap = (int *)malloc( sizeof(int) * ngroups_234 * 2 );
+		memset( group_bswap, 0x00, sizeof(int) * ngroups_234 * 2 );
+		group_bswap_ptr = group_bswap;
+
+		// Smaller than 2-3-4 decomposition threshold
+		// 2 of 2-3 ; 3 of 3-3 ; 3 of 3-4
+		for ( i = 0; i < ( ngroups_234 - over_234 ); i++ )
+		{
+			*group_bswap_ptr++ = (int)(  i * base_234 );
+			*group_bswap_ptr++ = (int)(( i * base_234 ) + 1 );
+		}
+	
+		// Larger than 2-3-4 decomposition threshold  
+		// 3 of 2-3 ; 4 of 3-4
+		for ( i = 0; i < over_234; i++ )
+		{
+			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ));
+			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ) + 1 );
+		}
+
+		// Generate new MPI communcator for 2nd stage Binary-Swap
+		MPI_Comm_group ( comm, &MPI_GROUP_WORLD ); 
+		MPI_Group_incl ( MPI_GROUP_WORLD, ngroups_234 * 2, group_bswap, &MPI_GROUP_STAGE2_BSWAP ); 
+		MPI_Comm_create( comm, MPI_GROUP_STAGE2_BSWAP, &MPI_COMM_STAGE2_BSWAP ); 
+		MPI_Group_rank ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_my_rank ); 
+		MPI_Group_size ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_nnodes ); 
+
+		if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
+		{ 	
+			bitrev_my_rank  = bitrevorder ( stage2_bswap_my_rank, stage2_bswap_nnodes ); // Get new Rank (Bit-reversed order)
+			bitrev_my_group = 1; // Color for new MPI communicator 
+								 // 1 unique color = 1 group of communicator		
+
+			// Generate a new MPI communicator with bit-reversed ranks
+			MPI_Comm_split ( MPI_COMM_STAGE2_BSWAP, bitrev_my_group, bitrev_my_rank, &MPI_COMM_STAGE2_BITREV ); 
+			MPI_Comm_rank  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_my_rank ); // New Rank inside MPI_COMM_BITREV
+			MPI_Comm_size  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_nnodes  );	 // NUmber of nodes in MPI_COMM_BITREV
+		}
+	}
+
+	// Kept for the next Init_234Composition ( See prepare_234_communicators )
+	MPI_Comm_group ( comm, &MPI_GROUP_PLAN );
+	has_234_communicators = true;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Free the communicators created by 
+ *         create_234_communicators
+*/
+/*========================================================*/
+static void free_234_communicators ( void )
+{
+	// Persistent requests on these communicators
+	free_exchange_schedule ( );
+
+	if ( has_234_communicators == false ) return;
+
+	if ( MPI_COMM_BITREV != MPI_COMM_NULL )
+		MPI_Comm_free ( &MPI_COMM_BITREV );
+
+	if ( MPI_COMM_234 != MPI_COMM_NULL )
+		MPI_Comm_free ( &MPI_COMM_234 );
+
+	if ( MPI_COMM_STAGE2_BITREV != MPI_COMM_NULL )
+		MPI_Comm_free ( &MPI_COMM_STAGE2_BITREV );
+
+	if ( MPI_COMM_STAGE2_BSWAP != MPI_COMM_NULL )
+		MPI_Comm_free ( &MPI_COMM_STAGE2_BSWAP );
+
+	if ( group_bswap != NULL ) {
+		MPI_Group_free ( &MPI_GROUP_STAGE2_BSWAP );
+		MPI_Group_free ( &MPI_GROUP_WORLD );
+		free ( group_bswap );
+		group_bswap = NULL;
+	}
+
+	MPI_Group_free ( &MPI_GROUP_PLAN );
+	has_234_communicators = false;
+}
+
+/*========================================================*/
+/**
+ *  @brief Make the communicators of create_234_communicators 
+ *         available. The communicators of the previous 
+ *         Init_234Composition are reused when they were derived 
+ *         from the same nodes in the same order ( e.g. only the 
+ *         image size or the pixel type changed ), so that the 
+ *         collective communicator creation is skipped. 
+ *         Every node must take the same decision: the nodes 
+ *         left out of the previous Init ( e.g. the ranks other 
+ *         than the node leaders of Init_234Composition_Hierarchical ) 
+ *         still hold older communicators.
+ *         
+ *  @param  my_rank [in] Rank (comm)
+ *  @param  nnodes  [in] Number of nodes (comm)
+ *  @param  comm    [in] MPI Communicator
+*/
+/*========================================================*/
+static int prepare_234_communicators ( unsigned int my_rank, unsigned int nnodes, MPI_Comm comm )
+{
+	MPI_Group comm_group;
+	int       result;
+	int       my_reuse;	// My communicators can be reused
+	int       all_reuse;	// Communicators of every node can be reused
+
+	my_reuse = 0;
+	if ( has_234_communicators == true ) 
+	{
+		MPI_Comm_group ( comm, &comm_group );
+		MPI_Group_compare ( comm_group, MPI_GROUP_PLAN, &result );
+		MPI_Group_free ( &comm_group );
+
+		my_reuse = ( result == MPI_IDENT );
+	}
+
+	MPI_Allreduce ( &my_reuse, &all_reuse, 1, MPI_INT, MPI_LAND, comm );
+
+	if ( all_reuse != 0 ) {
+		return EXIT_SUCCESS;
+	}
+
+	free_234_communicators ( );
+
+	return create_234_communicators ( my_rank, nnodes, comm );
+}
+
+/*========================================================*/
+/**
+ *  @brief Select the rank order of the next composition.
+ *         The nodes keep their images: the compositing 
+ *         communicator is split in the given order and the 
+ *         derived communicators are rebuilt, only when the 
+ *         order differs from the previous composition.
+ *         
+ *  @param  my_rank    [in]  Rank (comm)
+ *  @param  nnodes     [in]  Number of nodes (comm)
+ *  @param  order      [in]  Rank of each position, closest first
+ *                           ( NULL: Rank order )
+ *  @param  comm       [in]  MPI Communicator
+ *  @param  order_rank [out] My Rank in the selected order
+ *  @param  order_comm [out] MPI Communicator in the selected order
+*/
+/*========================================================*/
+static int select_composition_order ( unsigned int my_rank, unsigned int nnodes, const int* order, \
+				      MPI_Comm comm, unsigned int* order_rank, MPI_Comm* order_comm )
+{
+	unsigned int i;
+
+	if ( order != NULL ) 
+	{
+		for ( i = 0; i < nnodes; i++ ) {
+			if ( order[ i ] != (int)i ) break;
+		}
+
+		if ( i == nnodes ) order = NULL; // Rank order
+	}
+
+	if ( order == NULL ) 
+	{
+		// Restore the communicators of Init_234Composition
+		if ( order_list != NULL ) 
+		{
+			free_234_communicators ( );
+			MPI_Comm_free ( &MPI_COMM_ORDER );
+			free ( order_list );
+			order_list = NULL;
+
+			if ( create_234_communicators ( my_rank, nnodes, MPI_COMM_234BASE ) == EXIT_FAILURE ) {
+				return EXIT_FAILURE;
+			}
+		}
+
+		*order_rank = my_rank;
+		*order_comm = comm;
+		return EXIT_SUCCESS;
+	}
+
+	// Order changed since the previous composition
+	if (( order_list == NULL ) || ( memcmp ( order_list, order, nnodes * sizeof(int) ) != 0 )) 
+	{
+		free_234_communicators ( );
+
+		if ( order_list == NULL ) 
+		{
+			if (( order_list = (int *)malloc ( nnodes * sizeof(int) )) == NULL ) {
+				printf( "<<< ERROR >> Cannot allocate memory for the visibility order \n" );
+				create_234_communicators ( my_rank, nnodes, MPI_COMM_234BASE );
+				return EXIT_FAILURE;
+			}
+		}
+		else 
+		{
+			MPI_Comm_free ( &MPI_COMM_ORDER );
+		}
+
+		memcpy ( order_list, order, nnodes * sizeof(int) );
+
+		for ( i = 0; i < nnodes; i++ ) {
+			if ( order_list[ i ] == (int)my_rank ) order_my_rank = i;
+		}
+
+		MPI_Comm_split ( comm, 0, order_my_rank, &MPI_COMM_ORDER );
+
+		if ( create_234_communicators ( order_my_rank, nnodes, MPI_COMM_ORDER ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	*order_rank = order_my_rank;
+	*order_comm = MPI_COMM_ORDER;
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Sort the nodes by the minimum depth of their 
+ *         images (closest first) and select this order 
+ *         for the next composition. When the domains and 
+ *         the view direction are set, their cached order 
+ *         is used instead and my_depth is not read.
+ *         
+ *  @param  my_rank    [in]  Rank (comm)
+ *  @param  nnodes     [in]  Number of nodes (comm)
+ *  @param  my_depth   [in]  Depth values of my image
+ *  @param  image_size [in]  Number of pixels
+ *  @param  comm       [in]  MPI Communicator
+ *  @param  order_rank [out] My Rank in visibility order
+ *  @param  order_comm [out] MPI Communicator in visibility order
+*/
+/*========================================================*/
+static int select_visibility_order ( unsigned int my_rank, unsigned int nnodes, \
+				     const float* my_depth, unsigned int image_size, \
+				     MPI_Comm comm, unsigned int* order_rank, MPI_Comm* order_comm )
+{
+	unsigned int i;
+
+	float min_depth;
+	float* depth_list;
+
+	struct RankDepth* BtoF_List;
+	int* order;
+
+	int result;
+
+	// Order of the domains ( Set_234Composition_Domain and _View )
+	if (( domain_bounds != NULL ) && 
+	    (( view_direction[ 0 ] != 0.0f ) || ( view_direction[ 1 ] != 0.0f ) || ( view_direction[ 2 ] != 0.0f ))) 
+	{
+		if ( view_order_valid == false ) 
+		{
+			if ( get_visibility_order ( nnodes, domain_bounds, view_direction, view_order ) == EXIT_FAILURE ) {
+				return EXIT_FAILURE;
+			}
+			view_order_valid = true;
+		}
+
+		return select_composition_order ( my_rank, nnodes, view_order, comm, order_rank, order_comm );
+	}
+
+	min_depth = my_depth[ 0 ];
+	for ( i = 1; i < image_size; i++ ) {
+		if ( my_depth[ i ] < min_depth ) {	
+			min_depth = my_depth[ i ]; 
+		}
+	}
+
+	#ifdef _234DEBUG
+		printf ("[%d of %d] MIN_DEPTH = %f \n", my_rank, nnodes, min_depth );
+	#endif
+
+	depth_list = (float *)malloc ( nnodes * sizeof(float) );
+	BtoF_List  = (struct RankDepth *)malloc ( nnodes * sizeof(struct RankDepth) );
+	order      = (int *)malloc ( nnodes * sizeof(int) );
+
+	if (( depth_list == NULL ) || ( BtoF_List == NULL ) || ( order == NULL )) {
+		printf( "<<< ERROR >> Cannot allocate memory for the visibility order \n" );
+		free ( depth_list );
+		free ( BtoF_List );
+		free ( order );
+		return EXIT_FAILURE;
+	}
+
+	MPI_Allgather( &min_depth, 1, MPI_FLOAT, depth_list, 1, MPI_FLOAT, comm );
+
+	for ( i = 0; i < nnodes; i++ ) {
+		BtoF_List[i].rank  = i;			
+		BtoF_List[i].depth = depth_list[i];			
+	}
+
+	qsort( BtoF_List, nnodes, sizeof(struct RankDepth), MyQSortComparator );
+
+	for ( i = 0; i < nnodes; i++ ) {
+		order[i] = BtoF_List[i].rank;
+
+		#ifdef _234DEBUG
+			printf ("[%d of %d] RANK[%d] DEPTH[%f] \n", my_rank, nnodes, BtoF_List[i].rank, BtoF_List[i].depth );
+		#endif
+	}
+
+	result = select_composition_order ( my_rank, nnodes, order, comm, order_rank, order_comm );
+
+	free ( depth_list );
+	free ( BtoF_List );
+	free ( order );
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Send the image gathered on the closest node 
+ *         (Rank 0 of MPI_COMM_ORDER) to the ROOT_NODE
+ *         
+ *  @param  my_rank    [in]  Rank (comm)
+ *  @param  order_rank [in]  My Rank in visibility order
+ *  @param  image      [in]  Gathered image (Closest node)
+ *  @param  my_image   [out] Composited image (ROOT_NODE)
+ *  @param  count      [in]  Number of elements
+ *  @param  type       [in]  MPI Datatype
+ *  @param  comm       [in]  MPI Communicator
+*/
+/*========================================================*/
+static void send_to_root_node ( unsigned int my_rank, unsigned int order_rank, \
+				void* image, void* my_image, size_t count, \
+				MPI_Datatype type, MPI_Comm comm )
+{
+	#ifndef _NOGATHER
+	if (( order_list == NULL ) || ( order_list[ ROOT_NODE ] == ROOT_NODE )) return;
+
+	if ( order_rank == ROOT_NODE ) {
+		send_large( image, count, type, ROOT_NODE, SEND_TAG, comm );
+	}
+	else if ( my_rank == ROOT_NODE ) {
+		recv_large( my_image, count, type, order_list[ ROOT_NODE ], SEND_TAG, comm );
+	}
+	#endif
+}
+
+/*========================================================*/
+/**
+ *  @brief Destination of the final image gathering: the 
+ *         output buffer registered by Set_234Composition_Output 
+ *         during Do_234Composition, otherwise the temporary 
+ *         image buffer.
+ *         
+ *  @param  temp_image [in] Temporary image buffer
+*/
+/*========================================================*/
+static void* gather_destination ( void* temp_image )
+{
+	return ( gather_buffer != NULL ) ? gather_buffer : temp_image;
+}
+
+/*========================================================*/
+/**
+ *  @brief Keep the composited region of my node for 
+ *         Do_234Composition_Distributed and 
+ *         Do_234Composition_File. Blank pixels added for 
+ *         MPI_Gather are not part of the region.
+ *         
+ *  @param  my_rank    [in]  Rank (comm)
+ *  @param  nnodes     [in]  Number of nodes (comm)
+ *  @param  width      [in]  Image width
+ *  @param  height     [in]  Image height
+ *  @param  my_image   [in]  Input and Blended Image
+ *  @param  image      [in]  Composited region of my node ( or NULL )
+ *  @param  offset     [in]  Offset of the region ( pixels )
+ *  @param  counts     [in]  Number of pixels of the region
+*/
+/*========================================================*/
+static void set_composited_region ( unsigned int my_rank, unsigned int nnodes, \
+				    unsigned int width, unsigned int height, void* my_image, \
+				    void* image, size_t offset, size_t counts )
+{
+	size_t image_size;
+
+	image_size = (size_t)width * height;
+
+	// Single node: my image is the composited image ( No Binary-Swap stage )
+	if ( nnodes == 1 ) {
+		image  = my_image;
+		offset = 0;
+		counts = image_size;
+	}
+	// 3-node Composition: the ROOT_NODE holds the whole image
+	else if (( nnodes == 3 ) && ( image == NULL ) && ( my_rank == ROOT_NODE )) {
+		image  = my_image;
+		offset = 0;
+		counts = image_size;
+	}
+
+	// Blank pixels ( MPI_Gather )
+	if (( image == NULL ) || ( offset >= image_size )) {
+		counts = 0;
+	}
+	else if ( offset + counts > image_size ) {
+		counts = image_size - offset;
+	}
+
+	region_image  = ( counts > 0 ) ? image : NULL;
+	region_offset = offset;
+	region_counts = counts;
+}
+
+/*========================================================*/
+/**
+ *  @brief Write the composited region of every node to the 
+ *         output file ( MPI-IO collective write ) instead of 
+ *         gathering the image on the ROOT_NODE. The ROOT_NODE 
+ *         writes the header.
+ *         
+ *  @param  my_rank    [in]  Rank (comm)
+ *  @param  width      [in]  Image width
+ *  @param  height     [in]  Image height
+ *  @param  pixel_ID   [in]  Pixel type
+ *  @param  comm       [in]  MPI Communicator
+*/
+/*========================================================*/
+static int write_image_file ( unsigned int my_rank, unsigned int width, unsigned int height, \
+			      unsigned int pixel_ID, MPI_Comm comm )
+{
+	char header[ 64 ];
+	int  header_size;
+
+	size_t i;
+	size_t image_size;
+	size_t counts;
+	size_t file_pixel_size;	// Bytes per pixel in the file
+
+	unsigned int endian_test;
+
+	BYTE* image;
+	BYTE* file_image;
+	BYTE* image_ptr;
+	BYTE* file_image_ptr;
+
+	MPI_File     file;
+	MPI_Datatype file_pixel;
+	MPI_Status   status;
+
+	int result;
+
+	image_size = (size_t)width * height;
+
+	// Composited region of my node
+	image  = (BYTE *)region_image;
+	counts = region_counts;
+
+	if ( output_file_format == FILE_PNM ) 
+	{
+		if (( pixel_ID == ID_RGBA128 ) || ( pixel_ID == ID_RGBAZ160 )) {
+			// PFM ( Negative scale: Little endian )
+			endian_test = 1;
+			header_size = snprintf ( header, sizeof(header), "PF\n%u %u\n%s\n", width, height, \
+						 ( *(BYTE *)&endian_test == 1 ) ? "-1.0" : "1.0" );
+			file_pixel_size = RGB * sizeof(float);
+		}
+		else {
+			// PPM
+			header_size = snprintf ( header, sizeof(header), "P6\n%u %u\n255\n", width, height );
+			file_pixel_size = RGB;
+		}
+	}
+	else 
+	{
+		header_size = snprintf ( header, sizeof(header), "234C\n%u %u %u\n", width, height, pixel_ID );
+		file_pixel_size = global_image_type;
+	}
+
+	if ( MPI_File_open ( comm, (char *)output_file_name, MPI_MODE_CREATE | MPI_MODE_WRONLY, \
+			     MPI_INFO_NULL, &file ) != MPI_SUCCESS ) {
+		printf( "<<< ERROR >> Cannot open the output file %s \n", output_file_name );
+		return EXIT_FAILURE;
+	}
+
+	MPI_File_set_size ( file, (MPI_Offset)header_size + (MPI_Offset)( image_size * file_pixel_size ) );
+
+	if ( my_rank == ROOT_NODE ) {
+		MPI_File_write_at ( file, 0, header, header_size, MPI_BYTE, &status );
+	}
+
+	result = EXIT_SUCCESS;
+
+	// RGB components of PPM and PFM ( first 3 components of every pixel type )
+	file_image = image;
+	if (( file_pixel_size != global_image_type ) && ( counts > 0 )) 
+	{
+		if (( file_image = allocate_byte_memory_region ( counts * file_pixel_size )) == NULL ) {
+			result = EXIT_FAILURE;
+			counts = 0;
+		}
+		else {
+			image_ptr      = image;
+			file_image_ptr = file_image;
+			for ( i = 0; i < counts; i++ ) {
+				memcpy ( file_image_ptr, image_ptr, file_pixel_size );
+				image_ptr      += global_image_type;
+				file_image_ptr += file_pixel_size;
+			}
+		}
+	}
+
+	if ( counts > INT_MAX ) {
+		printf( "<<< ERROR >> Too many pixels to be written by one node \n" );
+		result = EXIT_FAILURE;
+		counts = 0;
+	}
+
+	MPI_Type_contiguous ( (int)file_pixel_size, MPI_BYTE, &file_pixel );
+	MPI_Type_commit ( &file_pixel );
+
+	if ( MPI_File_write_at_all ( file, (MPI_Offset)header_size + (MPI_Offset)( region_offset * file_pixel_size ), \
+				     file_image, (int)counts, file_pixel, &status ) != MPI_SUCCESS ) {
+		printf( "<<< ERROR >> Cannot write the output file %s \n", output_file_name );
+		result = EXIT_FAILURE;
+	}
+
+	MPI_Type_free ( &file_pixel );
+	MPI_File_close ( &file );
+
+	if (( file_image != image ) && ( file_image != NULL )) {
+		free ( file_image );
+	}
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Set the number of pixels of the image to be 
+ *         composited. For MPI_Gather, blank pixels are added 
+ *         to get a number of pixels divisible by the number 
+ *         of Binary-Swap nodes.
+ *         
+ *  @param  nnodes     [in] MPI number of nodes
+ *  @param  num_pixels [in] Number of pixels ( width * height )
+*/
+/*========================================================*/
+static void set_global_num_pixels ( unsigned int nnodes, size_t num_pixels )
+{
+#if !defined _GATHERV
+	unsigned int i;
+#endif
+
+	global_num_pixels = num_pixels;
+	global_add_pixels = 0;
+
+	#if !defined _GATHERV // MPI_GATHER
+		if ( check_pow2 ( nnodes ) == false ) { // Non-power-of-two number of nodes
+			i = get_nearest_pow2 ( nnodes );
+		}
+		else {
+			i = nnodes;
+		}
+		
+		global_mod_pixels = global_num_pixels % i;
+	
+		if ( global_mod_pixels != 0 ) 
+		{
+			global_add_pixels = i - global_mod_pixels;
+			global_num_pixels += global_add_pixels;
+		}
+	#endif
+}
+
+/*========================================================*/
+/**
+ *  @brief Number of pixels of the temporary image buffer 
+ *         needed by my node: the largest partial image 
+ *         received by the compositing algorithm, or the 
+ *         whole image on the gather root (ROOT_NODE).
+ *         
+ *  @param  my_rank  [in] Rank (Composition order)
+ *  @param  nnodes   [in] MPI number of nodes
+ *  @param  pixel_ID [in] Pixel type
+ *  @param  merge_ID [in] Pixel merging mode
+ *  @return Number of pixels
+*/
+/*========================================================*/
+static size_t get_temp_image_pixels ( unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int pixel_ID, unsigned int merge_ID )
+{
+	size_t num_pixels;	// Whole image ( + global_add_pixels )
+	size_t half_pixels;	// Larger half of the image
+	size_t radix;
+
+	num_pixels  = (size_t)global_num_pixels;
+	half_pixels = num_pixels - ( num_pixels / 2 );
+
+	// Gathered image and Direct-Send (3 nodes)
+	if (( my_rank == ROOT_NODE ) || ( nnodes == 3 )) {
+		return num_pixels;
+	}
+
+	// Planar pixels: whole image of the neighbour (Non-power-of-two)
+	if (( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+		return ( check_pow2 ( nnodes ) == true ) ? half_pixels : num_pixels;
+	}
+
+	// 2-3-4 Decomposition: half of the image. The right nodes of the 
+	// float images composite into the temporary buffer
+	if ( check_pow2 ( nnodes ) == false ) {
+		if (( pixel_ID == ID_RGBA128 ) || ( pixel_ID == ID_RGBAZ160 )) {
+			return num_pixels;
+		}
+		return half_pixels;
+	}
+
+	// Radix-k: one piece from each of the other k-1 nodes of the group
+	if (( bswap_radix > 2 ) && (( merge_ID == ALPHA ) || ( merge_ID == DEPTH ))) {
+		radix = ( bswap_radix < nnodes ) ? bswap_radix : nnodes;
+		return ( radix - 1 ) * (( num_pixels + radix - 1 ) / radix );
+	}
+
+	// Binary-Swap: half of the image. The right nodes composite into 
+	// the temporary buffer when blank pixels were added (MPI_Gather)
+	if ((( my_rank % 2 ) == 1 ) && ( global_add_pixels > 0 )) {
+		return num_pixels;
+	}
+
+	return half_pixels;
+}
+
+/*========================================================*/
+/**
+ *  @brief Make sure the temporary image buffer of the pixel 
+ *         type holds at least num_pixels pixels. The buffer 
+ *         only grows, and the gathered image returned by 
+ *         Do_234Composition_Ptr moves when it grows.
+ *         
+ *  @param  pixel_ID   [in] Pixel type
+ *  @param  num_pixels [in] Number of pixels
+*/
+/*========================================================*/
+static int reserve_temp_image ( unsigned int pixel_ID, size_t num_pixels )
+{
+	BYTE**  temp_image_byte;
+	float** temp_image_float;
+
+	if ( num_pixels <= temp_image_pixels ) {
+		return EXIT_SUCCESS;
+	}
+
+	temp_image_byte  = NULL;
+	temp_image_float = NULL;
+
+	switch ( pixel_ID ) {
+		case ID_RGBA32:  temp_image_byte = &temp_image_rgba32;
+				 break;
+		case ID_RGBA56:  temp_image_byte = &temp_image_rgba56;
+				 break;
+		case ID_RGBA64:  temp_image_byte = &temp_image_rgba64;
+				 break;
+		case ID_RGBAZ64: temp_image_byte = &temp_image_rgbaz64;
+				 break;
+		case ID_RGBAZ88: temp_image_byte = &temp_image_rgbaz88;
+				 break;
+		case ID_RGBAZ96: temp_image_byte = &temp_image_rgbaz96;
+				 break;
+		case ID_RGBA128:
+		case ID_RGBA128_PLANAR:
+				 temp_image_float = &temp_image_rgba128;
+				 break;
+		case ID_RGBAZ160:
+		case ID_RGBAZ160_PLANAR:
+				 temp_image_float = &temp_image_rgbaz160;
+				 break;
+		default:
+			printf ("Image type NOT VALID !!!! \n");	
+			return EXIT_FAILURE;
+	}
+
+	// Buffers released by Destroy_234Composition are reused ( Memory pool ). 
+	// The old buffer goes back to the pool with its size
+	if ( temp_image_byte != NULL ) {
+		release_pooled_memory_region ( memory_pool, *temp_image_byte, \
+					       temp_image_pixels * global_image_type );
+		temp_image_pixels = 0;
+		if ( ( *temp_image_byte = (BYTE *)allocate_pooled_memory_region ( memory_pool, 
+			num_pixels * global_image_type )) == NULL ) {
+			return EXIT_FAILURE;
+		}
+	}
+	else {
+		// RGBA128: 4 floats, RGBAZ160: 5 floats
+		release_pooled_memory_region ( memory_pool, *temp_image_float, \
+					       temp_image_pixels * global_image_type );
+		temp_image_pixels = 0;
+		if ( ( *temp_image_float = (float *)allocate_pooled_memory_region ( memory_pool, 
+			num_pixels * global_image_type )) == NULL ) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	temp_image_pixels = num_pixels;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Depth segment of Do_234ZComposition: the depth 
+ *         values of my image, composited together with the 
+ *         RGBA values of my_image. Kept by the context and 
+ *         reused by the next compositions.
+ *         
+ *  @param  image_size [in] Number of pixels
+ *  @return Depth segment ( NULL: Not enough memory )
+*/
+/*========================================================*/
+static float* reserve_zcomp_depth ( size_t image_size )
+{
+	size_t depth_bytes;
+
+	depth_bytes = image_size * sizeof(float);
+
+	if ( zcomp_depth_size < depth_bytes ) 
+	{
+		release_pooled_memory_region ( memory_pool, zcomp_depth, zcomp_depth_size );
+
+		zcomp_depth_size = 0;
+
+		if (( zcomp_depth = (float *)allocate_pooled_memory_region ( memory_pool, depth_bytes )) == NULL ) {
+			return NULL;
+		}
+
+		zcomp_depth_size = depth_bytes;
+	}
+
+	return zcomp_depth;
+}
+
+/*========================================================*/
+/**
+ *  @brief Initialize variables and image buffer for 
+ *	 	   234 Image  Compositing 
+ *         
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  width   [in] Image width
+ *  @param  height  [in] Image size
+ *  @param  height  [in] Pixel type
+*/
+/*========================================================*/
+int Init_234Composition ( unsigned int my_rank, unsigned int nnodes, unsigned int width, unsigned int height, unsigned int pixel_ID )
+{
+	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+			Init_234Composition_BYTE ( my_rank, nnodes, width, height, pixel_ID );
+	}
+	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 ) || \
+		 ( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+			Init_234Composition_FLOAT ( my_rank, nnodes, width, height, pixel_ID );
+	}
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Initialize variables and image buffer for 
+ *	 	   Hierarchical 234 Image Compositing
+ *         The ranks of every node composite their images 
+ *         in a shared memory window, and only the first 
+ *         rank of every node ( node leader ) takes part in 
+ *         the 234 + Binary-Swap composition.
+ *         The ranks of every node must be consecutive in 
+ *         MPI_COMM_WORLD, otherwise Init_234Composition is used.
+ *         
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  width   [in] Image width
+ *  @param  height  [in] Image size
+ *  @param  height  [in] Pixel type
+*/
+/*========================================================*/
+int Init_234Composition_Hierarchical ( unsigned int my_rank, unsigned int nnodes, \
+				       unsigned int width, unsigned int height, unsigned int pixel_ID )
+{
+	unsigned int pixel_size;
+
+	int first_rank;		// First rank of my node
+	int is_consecutive;	// Ranks of my node are consecutive
+	int all_consecutive;	// Ranks of every node are consecutive
+
+	BYTE*    my_shared_image;
+	MPI_Aint shared_size;
+	int      shared_disp;
+	int      k;
+
+	switch ( pixel_ID ) {
+		case ID_RGBA32:    pixel_size = RGBA32;
+				   break;
+		case ID_RGBAZ64:   pixel_size = RGBAZ64;
+				   break;
+		case ID_RGBA56:    pixel_size = RGBA56;
+				   break;
+		case ID_RGBAZ88:   pixel_size = RGBAZ88;
+				   break;
+		case ID_RGBA64:    pixel_size = RGBA64;
+				   break;
+		case ID_RGBAZ96:   pixel_size = RGBAZ96;
+				   break;
+		case ID_RGBA128:   pixel_size = RGBA128;
+				   break;
+		case ID_RGBAZ160:  pixel_size = RGBAZ160;
+				   break;
+		default:
+			printf( "<<< ERROR >> Hierarchical composition of pixel type %d is not supported \n", pixel_ID );
+			return EXIT_FAILURE;
+	}
+
+	// Ranks of my node
+	MPI_Comm_split_type ( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, (int)my_rank, \
+			      MPI_INFO_NULL, &MPI_COMM_SHARED );
+	MPI_Comm_rank ( MPI_COMM_SHARED, &shared_my_rank );
+	MPI_Comm_size ( MPI_COMM_SHARED, &shared_nnodes );
+
+	// Images are blended in rank order: the ranks of my node 
+	// must be consecutive to be composited before the others
+	first_rank = (int)my_rank;
+	MPI_Bcast ( &first_rank, 1, MPI_INT, 0, MPI_COMM_SHARED );
+
+	is_consecutive = ( (int)my_rank == first_rank + shared_my_rank );
+	MPI_Allreduce ( &is_consecutive, &all_consecutive, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD );
+
+	if ( all_consecutive == 0 ) 
+	{
+		if ( my_rank == ROOT_NODE ) {
+			printf( "<<< ERROR >> Ranks of a node are not consecutive: no hierarchical composition \n" );
+		}
+		MPI_Comm_free ( &MPI_COMM_SHARED );
+		return Init_234Composition ( my_rank, nnodes, width, height, pixel_ID );
+	}
+
+	// First rank of every node ( Node leaders )
+	MPI_Comm_split ( MPI_COMM_WORLD, ( shared_my_rank == 0 ) ? 0 : MPI_UNDEFINED, \
+			 (int)my_rank, &MPI_COMM_LEADERS );
+
+	if ( shared_my_rank == 0 ) {
+		MPI_Comm_rank ( MPI_COMM_LEADERS, &leader_my_rank );
+		MPI_Comm_size ( MPI_COMM_LEADERS, &leader_nnodes );
+	}
+	MPI_Bcast ( &leader_nnodes, 1, MPI_INT, 0, MPI_COMM_SHARED );
+
+	use_hierarchy = true;
+
+	// Inter-node composition ( MPI_COMM_LEADERS )
+	if ( shared_my_rank == 0 ) {
+		Init_234Composition ( leader_my_rank, leader_nnodes, width, height, pixel_ID );
+	}
+	else {
+		global_image_type = pixel_size;
+		set_global_num_pixels ( leader_nnodes, (size_t)width * height );
+
+		// Compositing routines of the intra-node composition
+		Select_AlphaBlend_SIMD( );
+		if ( pixel_ID == ID_RGBA32 ) Create_AlphaBlend_LUT( );
+	}
+
+	// Image of every rank of my node ( + Blank pixels of the 
+	// inter-node composition ) in a shared memory window
+	if ( MPI_Win_allocate_shared ( (MPI_Aint)( global_num_pixels * pixel_size ), 1, MPI_INFO_NULL, \
+				       MPI_COMM_SHARED, &my_shared_image, &shared_window ) != MPI_SUCCESS ) {
+		printf( "<<< ERROR >> Cannot allocate the shared memory window \n" );
+		return EXIT_FAILURE;
+	}
+
+	if (( shared_images = (BYTE **)malloc ( shared_nnodes * sizeof(BYTE *) )) == NULL ) {
+		printf( "<<< ERROR >> Cannot allocate memory for the shared images \n" );
+		return EXIT_FAILURE;
+	}
+
+	for ( k = 0; k < shared_nnodes; k++ ) {
+		MPI_Win_shared_query ( shared_window, k, &shared_size, &shared_disp, &shared_images[ k ] );
+	}
+
+	memset ( my_shared_image, 0, global_num_pixels * pixel_size );
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Get my image buffer in the shared memory window 
+ *         ( See Init_234Composition_Hierarchical )
+ *         Rendering directly into this buffer avoids the 
+ *         copy of my_image in Do_234Composition.
+ *
+ *  @return Image buffer ( NULL: No hierarchical composition )
+*/
+/*========================================================*/
+void* Get_234Composition_Shared_Image ( void )
+{
+	if ( use_hierarchy == false ) return NULL;
+
+	return (void *)shared_images[ shared_my_rank ];
+}
+
+/*========================================================*/
+/**
+ *  @brief Hierarchical 234 Composition
+ *         ( See Init_234Composition_Hierarchical )
+ *         Intra-node composition in the shared memory window, 
+ *         then 234 + Binary-Swap of the node leaders.
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Merge type
+ *  @param  my_image       [in,out]  Input and Blended Image
+ */
+/*========================================================*/
+static int hierarchical_composition ( unsigned int my_rank, \
+				      unsigned int width, unsigned int height, \
+				      unsigned int pixel_ID, unsigned int merge_ID, \
+				      void *my_image )
+{
+	size_t image_size;
+	BYTE*  my_shared_image;
+	void*  comp_image;
+	void*  result_image;
+
+	int result;
+
+	image_size = (size_t)width * height;
+	my_shared_image = shared_images[ shared_my_rank ];
+
+	// My image in the shared memory window ( + Blank pixels )
+	if ( (BYTE *)my_image != my_shared_image ) {
+		memcpy ( my_shared_image, my_image, image_size * global_image_type );
+	}
+	memset ( my_shared_image + image_size * global_image_type, 0, \
+		 ( global_num_pixels - image_size ) * global_image_type );
+
+	// ====== Intra-node composition ======
+	MPI_Win_fence ( 0, shared_window );
+	shared_composite_image ( shared_my_rank, shared_nnodes, image_size, pixel_ID, \
+				 global_image_type, shared_images );
+	MPI_Win_fence ( 0, shared_window );
+
+	if ( shared_my_rank != 0 ) return EXIT_SUCCESS;
+
+	// ====== Inter-node composition ( Node leaders ) ======
+	result = EXIT_SUCCESS;
+	comp_image = shared_images[ 0 ];
+
+	// The final gathering lands in the registered output buffer ( See Set_234Composition_Output )
+	result_image  = ( output_image != NULL ) ? output_image : my_image;
+	gather_buffer = output_image;
+
+	if ( leader_nnodes > 1 ) 
+	{
+		if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+		    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+			result = Do_234Composition_Core_BYTE ( leader_my_rank, leader_nnodes, \
+							       width, height, pixel_ID, merge_ID, \
+							       shared_images[ 0 ], MPI_COMM_LEADERS );
+			if ( leader_nnodes != 3 ) comp_image = gather_destination ( temp_image_byte_ptr );
+		}
+		else if ( pixel_ID == ID_RGBA128 ) {
+			result = Do_234Composition_Core_FLOAT ( leader_my_rank, leader_nnodes, \
+								width, height, pixel_ID, merge_ID, \
+								(float *)shared_images[ 0 ], MPI_COMM_LEADERS );
+			if ( leader_nnodes != 3 ) comp_image = gather_destination ( temp_image_rgba128 );
+		}
+		else if ( pixel_ID == ID_RGBAZ160 ) {
+			result = Do_234Composition_Core_FLOAT ( leader_my_rank, leader_nnodes, \
+								width, height, pixel_ID, merge_ID, \
+								(float *)shared_images[ 0 ], MPI_COMM_LEADERS );
+			if ( leader_nnodes != 3 ) comp_image = gather_destination ( temp_image_rgbaz160 );
+		}
+	}
+
+	gather_buffer = NULL;
+
+	// Copy the composited image to my_image ( or the output buffer )
+	if (( result == EXIT_SUCCESS ) && ( my_rank == ROOT_NODE ) && ( comp_image != result_image )) {
+		memcpy ( result_image, comp_image, image_size * global_image_type );
+	}
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition 
+ *		   (BYTE image pixel: RGBA32)
+ *         The ROOT_NODE gets the image in my_image, or in the 
+ *         output buffer of Set_234Composition_Output ( No copy )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  rgba_image     [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_234BS [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition ( unsigned int my_rank, unsigned int nnodes, \
+			 unsigned int width, unsigned int height, \
+			 unsigned int pixel_ID, unsigned int merge_ID, \
+			 void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int order_rank;
+	MPI_Comm     order_comm;
+	int*         order;
+
+	size_t image_size;
+
+	void* result_image;	// Composited image ( ROOT_NODE )
+	void* gathered_image;	// Gathered image ( First node in placement order )
+
+	int result;
+
+	// Intra-node, then inter-node composition ( See Init_234Composition_Hierarchical )
+	if ( use_hierarchy == true ) {
+		return hierarchical_composition ( my_rank, width, height, pixel_ID, merge_ID, my_image );
+	}
+
+	image_size = (size_t)width * height;
+
+	// Placement order for RGBAZ64 ( Depth sorting only ), otherwise 
+	// rank order ( See Set_234Composition_Placement )
+	order = NULL;
+	if (( placement_order != NULL ) && ( placement_nnodes == nnodes ) && ( pixel_ID == ID_RGBAZ64 )) {
+		order = placement_order;
+	}
+
+	if ( select_composition_order ( my_rank, nnodes, order, MPI_COMM_COMPOSITION, \
+					&order_rank, &order_comm ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	// The final gathering lands in the registered output buffer 
+	// ( See Set_234Composition_Output ), otherwise in my_image
+	result_image  = ( output_image != NULL ) ? output_image : my_image;
+	gather_buffer = output_image;
+
+	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+		result = Do_234Composition_Core_BYTE ( order_rank, nnodes, \
+						       width, height, pixel_ID, merge_ID, \
+						       (BYTE *)my_image, order_comm );
+
+		// Direct-Send (3 nodes) composites into my_image ( Single node: nothing to composite )
+		gathered_image = (( nnodes != 3 ) && ( nnodes != 1 )) ? gather_destination ( temp_image_byte_ptr ) : my_image;
+		gather_buffer  = NULL;
+
+		if ( result == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered image to my_image_byte ( or the output buffer )
+		if (( my_rank == ROOT_NODE ) && ( order_rank == ROOT_NODE ) && ( gathered_image != result_image )) {
+			memcpy ( result_image, gathered_image, image_size * global_image_type * sizeof(BYTE) );
+		}
+
+		// The first node in placement order gathered the image
+		send_to_root_node ( my_rank, order_rank, gathered_image, \
+				    result_image, image_size * global_image_type, MPI_BYTE, MPI_COMM_COMPOSITION );
+	}
+	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
+		result = Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
+							width, height, pixel_ID, merge_ID, \
+							(float *)my_image, MPI_COMM_COMPOSITION );
+
+		// Direct-Send (3 nodes) composites into my_image ( Single node: nothing to composite )
+		if (( nnodes == 3 ) || ( nnodes == 1 )) {
+			gathered_image = my_image;
+		}
+		else if ( pixel_ID == ID_RGBA128 ) {
+			gathered_image = gather_destination ( temp_image_rgba128 );
+		}
+		else {
+			gathered_image = gather_destination ( temp_image_rgbaz160 );
+		}
+		gather_buffer = NULL;
+
+		if ( result == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered image to my_image_byte ( or the output buffer )
+		if (( my_rank == ROOT_NODE ) && ( gathered_image != result_image )) {
+			memcpy ( result_image, gathered_image, image_size * global_image_type );
+		}
+	}
+	else if (( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+		result = Do_234Composition_Core_PLANAR ( my_rank, nnodes, \
+							 width, height, pixel_ID, \
+							 NULL, (float *)my_image, MPI_COMM_COMPOSITION );
+
+		// Single node: nothing to composite
+		if ( nnodes == 1 ) {
+			gathered_image = my_image;
+		}
+		else if ( pixel_ID == ID_RGBA128_PLANAR ) {
+			gathered_image = gather_destination ( temp_image_rgba128 );
+		}
+		else {
+			gathered_image = gather_destination ( temp_image_rgbaz160 );
+		}
+		gather_buffer = NULL;
+
+		if ( result == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered planes to my_image ( or the output buffer )
+		if (( my_rank == ROOT_NODE ) && ( gathered_image != result_image )) {
+			memcpy ( result_image, gathered_image, image_size * global_image_type );
+		}
+	}
+	else {
+		gather_buffer = NULL;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Depth composition of the RGBA values of my_image 
+ *         and of the depth values ( RGBAZ64 and RGBAZ160 of 
+ *         Do_234ZComposition ). Same 2-3-4 + Binary-Swap stages 
+ *         as Do_234Composition, the RGBA and depth segments of 
+ *         a pixel range being exchanged together ( one derived 
+ *         datatype ) without interleaving them. Only the RGBA 
+ *         values are gathered, in my_image of the ROOT_NODE.
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  RGBAZ64 or RGBAZ160
+ *  @param  my_image       [in,out]  RGBA values ( RGBA32 or RGBA128 )
+ *  @param  my_depth       [in]  Depth values
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator
+ */
+/*========================================================*/
+static int composite_split_depth ( unsigned int my_rank, unsigned int nnodes, \
+				   unsigned int width, unsigned int height, unsigned int pixel_ID, \
+				   void *my_image, const float *my_depth, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int recv_pixels;
+
+	Compositor234_Request split_request;
+
+	// The gathered image is lent ( See Do_234Composition_View )
+	if ( view_image != NULL ) {
+		printf( "<<< ERROR >> Release_234Composition_View must be called before the next composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	memset ( &split_request, 0x00, sizeof(Compositor234_Request) );
+
+	split_request.my_rank    = my_rank;
+	split_request.nnodes     = nnodes;
+	split_request.pixel_ID   = pixel_ID;
+	split_request.color_size = ( pixel_ID == ID_RGBAZ64 ) ? RGBA32 : RGBA128;
+	split_request.pixel_size = split_request.color_size + sizeof(float);
+	split_request.image_size = width * height;
+	split_request.my_image   = (BYTE *)my_image;
+	split_request.my_depth   = my_depth;
+	split_request.comm       = MPI_COMM_COMPOSITION;
+	split_request.tag        = PAIR_TAG;
+	split_request.record_stats = true;
+
+	// Time and bytes of each stage ( See Get_234Composition_Stats )
+	begin_composition_stats ( );
+
+	// Received RGBA and depth values ( One or two pixel ranges )
+	recv_pixels = icomp_schedule ( &split_request );
+
+	if ( reserve_temp_image ( pixel_ID, recv_pixels ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	split_request.recv_image = ( pixel_ID == ID_RGBAZ64 ) ? temp_image_rgbaz64 : (BYTE *)temp_image_rgbaz160;
+
+	// The depth values are composited in the depth segment 
+	// of the context ( my_depth is not modified )
+	if (( split_request.blnd_depth = reserve_zcomp_depth ( split_request.image_size )) == NULL ) {
+		return EXIT_FAILURE;
+	}
+
+	if (( split_request.requests = (MPI_Request *)malloc( ( nnodes + 4 ) * sizeof(MPI_Request) )) == NULL ) {
+		printf( "<<< ERROR >> Cannot allocate memory for the MPI requests \n" );
+		return EXIT_FAILURE;
+	}
+
+	// ====================================================================
+	//	2-3-4 + BINARY-SWAP and Final Image Gathering
+	// ====================================================================
+	icomp_begin ( &split_request );
+	icomp_progress ( &split_request, true );
+
+	free ( split_request.requests );
+
+	end_composition_stats ( );
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition 
+ *		   (BYTE image pixel: RGBA32)
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  rgba_image     [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_234BS [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+
+int  Do_234ZComposition ( unsigned int my_rank, unsigned int nnodes, \
+						 unsigned int width, unsigned int height, \
+						 unsigned int pixel_ID, unsigned int merge_ID, \
+						 void *my_image, const float *my_depth, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int order_rank;	// My Rank in visibility order
+	MPI_Comm     order_comm;	// MPI Communicator in visibility order
+
+	size_t image_size;
+
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Do_234ZComposition is not supported by the hierarchical composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	if (( pixel_ID == ID_RGBA32 ) && (( merge_ID == ALPHA ) || ( merge_ID == ALPHA_COMPRESS ) || ( merge_ID == ALPHA_SPARSE ))) 
+	{
+		image_size = (size_t)width * height;
+
+		// Visibility order of the nodes: 
+		// the images stay on their nodes
+		if ( select_visibility_order ( my_rank, nnodes, my_depth, image_size, MPI_COMM_COMPOSITION, \
+					       &order_rank, &order_comm ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		if ( Do_234Composition_Core_BYTE ( order_rank, nnodes, \
+			  	   		width, height, pixel_ID, merge_ID, \
+				  	     	(BYTE *)my_image, order_comm ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered image to my_image_byte ( 1 and 3 nodes: already in my_image )
+		if (( nnodes != 3 ) && ( nnodes != 1 ) && ( my_rank == ROOT_NODE ) && ( order_rank == ROOT_NODE )) {
+			memcpy ( my_image, temp_image_byte_ptr, (size_t)width * height * global_image_type * sizeof(BYTE) );
+		}
+
+		// The closest node gathered the image
+		send_to_root_node ( my_rank, order_rank, (( nnodes != 3 ) && ( nnodes != 1 )) ? (void *)temp_image_byte_ptr : my_image, \
+				    my_image, image_size * global_image_type, MPI_BYTE, MPI_COMM_COMPOSITION );
+	}
+	else if (( pixel_ID == ID_RGBAZ64 ) && (( merge_ID == DEPTH ) || ( merge_ID == DEPTH_COMPRESS ))) 
+	{
+		// RGBA values of my_image and depth values: no interleaving
+		if ( composite_split_depth ( my_rank, nnodes, width, height, pixel_ID, \
+					     my_image, my_depth, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+	}
+	else if (( pixel_ID == ID_RGBA128 ) && (( merge_ID == ALPHA ) || ( merge_ID == ALPHA_COMPRESS ))) 
+	{
+		image_size = (size_t)width * height;
+
+		// Visibility order of the nodes: 
+		// the images stay on their nodes
+		if ( select_visibility_order ( my_rank, nnodes, my_depth, image_size, MPI_COMM_COMPOSITION, \
+					       &order_rank, &order_comm ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		if ( Do_234Composition_Core_FLOAT ( order_rank, nnodes, \
+			  	   		width, height, pixel_ID, merge_ID, \
+				  	     	(float *)my_image, order_comm ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered image to my_image_byte ( 1 and 3 nodes: already in my_image )
+		if (( nnodes != 3 ) && ( nnodes != 1 ) && ( my_rank == ROOT_NODE ) && ( order_rank == ROOT_NODE )) {
+			memcpy ( my_image, temp_image_rgba128, (size_t)width * height * RGBA * sizeof(float) );
+		}
+
+		// The closest node gathered the image
+		send_to_root_node ( my_rank, order_rank, (( nnodes != 3 ) && ( nnodes != 1 )) ? (void *)temp_image_rgba128 : my_image, \
+				    my_image, image_size * RGBA, MPI_FLOAT, MPI_COMM_COMPOSITION );
+	}
+	else if (( pixel_ID == ID_RGBAZ160 ) && (( merge_ID == DEPTH ) || ( merge_ID == DEPTH_COMPRESS ))) {
+
+		// RGBA values of my_image and depth values: no interleaving
+		if ( composite_split_depth ( my_rank, nnodes, width, height, pixel_ID, \
+					     my_image, my_depth, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+	}
+	else if (( pixel_ID == ID_RGBAZ160_PLANAR ) && (( merge_ID == DEPTH ) || ( merge_ID == DEPTH_COMPRESS ))) {
+
+		image_size = (size_t)width * height;
+
+		// The depth values are used as the Z plane: 
+		// no interleaving of the RGBA and Z values
+		memcpy ( planar_depth_image, my_depth, image_size * sizeof(float) );
+
+		if ( Do_234Composition_Core_PLANAR ( my_rank, nnodes, \
+						width, height, pixel_ID, \
+						planar_depth_image, (float *)my_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+			return EXIT_FAILURE;
+		}
+
+		// Copy the gathered R, G, B and A planes to my_image
+		if ( my_rank == ROOT_NODE ) {
+			memcpy ( my_image, temp_image_rgbaz160, image_size * RGBA * sizeof(float) );
+		}
+	}
+	else 
+	{
+		printf ("Image type NOT VALID !!!! ( Pixel_ID = %d merge_ID = %d ) \n", pixel_ID, merge_ID );	
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition without copying the gathered 
+ *         image to my_image: it stays in the temporary image 
+ *         buffer ( or in my_image for 3 nodes, composited by 
+ *         the Direct-Send ). Rank order.
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  gathered_image [out] Gathered image ( ROOT_NODE, otherwise NULL )
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+static int composite_in_place ( unsigned int my_rank, unsigned int nnodes, \
+				unsigned int width, unsigned int height, \
+				unsigned int pixel_ID, unsigned int merge_ID, \
+				void *my_image, void **gathered_image, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int order_rank;
+	MPI_Comm     order_comm;
+
+	*gathered_image = NULL;
+
+	// Rank order ( See Do_234ZComposition )
+	if ( select_composition_order ( my_rank, nnodes, NULL, MPI_COMM_COMPOSITION, \
+					&order_rank, &order_comm ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+
+			if ( Do_234Composition_Core_BYTE ( my_rank, nnodes, \
+						  	   width, height, pixel_ID, merge_ID, \
+						  	   (BYTE *)my_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+				return EXIT_FAILURE;
+			}
+
+			// Pointer of the gathered image
+			if ( my_rank == ROOT_NODE ) {
+				*gathered_image = (( nnodes != 3 ) && ( nnodes != 1 )) ? (void *)temp_image_byte_ptr : my_image;
+			}
+	}
+	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
+
+			if ( Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
+						  	   		  width, height, pixel_ID, merge_ID, \
+						  	     	  (float *)my_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+				return EXIT_FAILURE;
+			}
+
+			// Pointer of the gathered image
+			if ((( nnodes == 3 ) || ( nnodes == 1 )) && ( my_rank == ROOT_NODE )) {
+				*gathered_image = my_image;
+			}
+			else if ( my_rank == ROOT_NODE ) {
+				switch ( pixel_ID ) {
+					case ID_RGBA128 : *gathered_image = temp_image_rgba128;
+							  break;
+					case ID_RGBAZ160: *gathered_image = temp_image_rgbaz160;
+							  break;
+				}
+			}
+	}
+	else if (( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+
+			if ( Do_234Composition_Core_PLANAR ( my_rank, nnodes, \
+							width, height, pixel_ID, \
+							NULL, (float *)my_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+				return EXIT_FAILURE;
+			}
+
+			// Pointer of the gathered planes
+			if (( nnodes == 1 ) && ( my_rank == ROOT_NODE )) {
+				*gathered_image = my_image;
+			}
+			else if ( my_rank == ROOT_NODE ) {
+				switch ( pixel_ID ) {
+					case ID_RGBA128_PLANAR : *gathered_image = temp_image_rgba128;
+								 break;
+					case ID_RGBAZ160_PLANAR: *gathered_image = temp_image_rgbaz160;
+								 break;
+				}
+			}
+	}
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition_Ptr 
+ *		   (Returns the pointer of Temporary Buffer)
+ *         (Avoids costly memory copy to my_image) 
+ *         The returned image belongs to the library: it is 
+ *         valid until the next composition or 
+ *         Destroy_234Composition, and must not be freed. 
+ *         For 1 and 3 nodes it is my_image. 
+ *         ( See Do_234Composition_View for an explicit release )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  rgba_image     [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ *  @return Gathered image ( ROOT_NODE ), NULL on the other 
+ *          nodes or on error
+ */
+/*========================================================*/
+void*  Do_234Composition_Ptr ( unsigned int my_rank, unsigned int nnodes, \
+	  					       unsigned int width, unsigned int height, \
+						 	   unsigned int pixel_ID, unsigned int merge_ID, \
+						 	   void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	void* gathered_image;
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Do_234Composition_Ptr is not supported by the hierarchical composition \n" );
+		return NULL;
+	}
+
+	if ( composite_in_place ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+				  my_image, &gathered_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+		return NULL;
+	}
+
+	return gathered_image;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition and lend the gathered image 
+ *         ( No copy to my_image ). The view stays valid until 
+ *         Release_234Composition_View: the compositions of 
+ *         this context fail until then. For 1 and 3 nodes the view 
+ *         is my_image.
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  view           [out] Gathered image ( ROOT_NODE, otherwise NULL )
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_View ( unsigned int my_rank, unsigned int nnodes, \
+			      unsigned int width, unsigned int height, \
+			      unsigned int pixel_ID, unsigned int merge_ID, \
+			      void *my_image, void **view, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	*view = NULL;
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Do_234Composition_View is not supported by the hierarchical composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	if ( composite_in_place ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+				  my_image, view, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	view_image = *view;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Give back the image lent by Do_234Composition_View 
+ *         ( NULL on the nodes without a view )
+ *
+ *  @param  view [in] Gathered image
+ */
+/*========================================================*/
+int Release_234Composition_View ( void *view )
+{
+	if ( view != view_image ) {
+		printf( "<<< ERROR >> Not the image lent by Do_234Composition_View \n" );
+		return EXIT_FAILURE;
+	}
+
+	view_image = NULL;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Register the output buffer of Do_234Composition: 
+ *         the final image gathering of the ROOT_NODE lands 
+ *         in it directly, instead of the temporary buffer 
+ *         followed by a copy to my_image ( my_image then 
+ *         keeps its partial result ). The buffer must hold 
+ *         Get_234Composition_Output_Size bytes, which 
+ *         include the blank pixels added for MPI_Gather. 
+ *
+ *  @param  image [in] Output buffer ( NULL: my_image )
+ *  @param  size  [in] Size of the output buffer in bytes
+ */
+/*========================================================*/
+int Set_234Composition_Output ( void *image, size_t size )
+{
+	if (( image != NULL ) && ( size < Get_234Composition_Output_Size ( ) )) {
+		printf( "<<< ERROR >> The output buffer must hold %zu bytes \n", Get_234Composition_Output_Size ( ) );
+		return EXIT_FAILURE;
+	}
+
+	output_image = image;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Size in bytes of the output buffer of 
+ *         Set_234Composition_Output: width * height pixels 
+ *         and the blank pixels added for MPI_Gather
+ */
+/*========================================================*/
+size_t Get_234Composition_Output_Size ( void )
+{
+	return (size_t)global_num_pixels * global_image_type;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition tile by tile. The image is 
+ *         split into bands of tile_height rows, which are 
+ *         composited one after the other, so the temporary 
+ *         buffers only hold one tile ( Init_234Composition 
+ *         with width and tile_height ). 
+ *         Each finished tile is passed to store_tile on the 
+ *         ROOT_NODE before the next one is composited, or 
+ *         copied into my_image when store_tile is NULL. 
+ *         Every node copies each tile into a tile buffer, 
+ *         either from my_image or, when load_tile is given, 
+ *         by calling load_tile ( my_image can then be NULL ).
+ *         ( Interleaved pixel types )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  tile_height    [in]  Rows per tile ( 0: whole image )
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  load_tile      [in]  Fills a tile of my image ( or NULL )
+ *  @param  store_tile     [in]  Receives a composited tile ( or NULL )
+ *  @param  user_data      [in]  Passed to load_tile and store_tile
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_Tiled ( unsigned int my_rank, unsigned int nnodes, \
+			       unsigned int width, unsigned int height, unsigned int tile_height, \
+			       unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+			       Compositor234_TileFunc load_tile, Compositor234_TileFunc store_tile, \
+			       void *user_data, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int order_rank;
+	MPI_Comm     order_comm;
+
+	unsigned int tile_y;
+	unsigned int tile_rows;
+	size_t tile_bytes;
+
+	size_t saved_num_pixels;
+	unsigned int saved_mod_pixels;
+	unsigned int saved_add_pixels;
+	int saved_roi[ 4 ];
+
+	BYTE* tile_buffer;
+	BYTE* tile_image;
+	void* comp_tile;
+
+	int result;
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Tiled composition is not supported by the hierarchical composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	if (( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+		printf( "<<< ERROR >> Tiled composition of planar pixels is not supported \n" );
+		return EXIT_FAILURE;
+	}
+
+	if (( tile_height == 0 ) || ( tile_height > height )) {
+		tile_height = height;
+	}
+
+	// Rank order ( See Do_234ZComposition )
+	if ( select_composition_order ( my_rank, nnodes, NULL, MPI_COMM_COMPOSITION, \
+					&order_rank, &order_comm ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	// Number of pixels and ROI of the whole tiles 
+	saved_num_pixels = global_num_pixels;
+	saved_mod_pixels = global_mod_pixels;
+	saved_add_pixels = global_add_pixels;
+	memcpy ( saved_roi, global_roi, 4 * sizeof(int) );
+
+	// Tile buffer ( + global_add_pixels Blank Pixels )
+	set_global_num_pixels ( nnodes, (size_t)width * tile_height );
+	if ( ( tile_buffer = allocate_byte_memory_region ( 
+		global_num_pixels * global_image_type )) == NULL ) {
+		global_num_pixels = saved_num_pixels;
+		global_mod_pixels = saved_mod_pixels;
+		global_add_pixels = saved_add_pixels;
+		return EXIT_FAILURE;
+	}
+
+	result = EXIT_SUCCESS;
+
+	for ( tile_y = 0; tile_y < height; tile_y += tile_rows ) 
+	{
+		tile_rows  = (( height - tile_y ) < tile_height ) ? ( height - tile_y ) : tile_height;
+		tile_bytes = (size_t)width * tile_rows * global_image_type;
+
+		// The last tile can be smaller
+		set_global_num_pixels ( nnodes, (size_t)width * tile_rows );
+
+		// The composition reads and writes the blank pixels 
+		// after the tile, so the tile is never composited in place
+		tile_image = tile_buffer;
+		if ( load_tile != NULL ) {
+			if ( load_tile ( tile_image, tile_y, width, tile_rows, user_data ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+			}
+		}
+		else {
+			memcpy ( tile_image, (BYTE *)my_image + (size_t)tile_y * width * global_image_type, tile_bytes );
+		}
+		memset ( tile_image + tile_bytes, 0, global_num_pixels * global_image_type - tile_bytes );
+
+		// ROI given by Set_234Composition_ROI ( Tile coordinates )
+		if ( global_roi_defined == true ) {
+			global_roi[ 0 ] = saved_roi[ 0 ];
+			global_roi[ 1 ] = saved_roi[ 1 ] - (int)tile_y;
+			global_roi[ 2 ] = saved_roi[ 2 ];
+			global_roi[ 3 ] = saved_roi[ 3 ] - (int)tile_y;
+
+			if (( global_roi[ 3 ] <= 0 ) || ( global_roi[ 1 ] >= (int)tile_rows )) {
+				global_roi[ 1 ] = 0;
+				global_roi[ 3 ] = 0;
+			}
+		}
+
+		comp_tile = tile_image;
+
+		if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+		    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+			if ( Do_234Composition_Core_BYTE ( my_rank, nnodes, \
+						      width, tile_rows, pixel_ID, merge_ID, \
+						      tile_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+				break;
+			}
+
+			// Direct-Send (3 nodes) composites in place ( Single node: nothing to composite )
+			if (( nnodes != 3 ) && ( nnodes != 1 )) comp_tile = temp_image_byte_ptr;
+		}
+		else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
+			if ( Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
+						       width, tile_rows, pixel_ID, merge_ID, \
+						       (float *)tile_image, MPI_COMM_COMPOSITION ) == EXIT_FAILURE ) {
+				result = EXIT_FAILURE;
+				break;
+			}
+
+			if (( nnodes != 3 ) && ( nnodes != 1 )) {
+				comp_tile = ( pixel_ID == ID_RGBA128 ) ? (void *)temp_image_rgba128 : (void *)temp_image_rgbaz160;
+			}
+		}
+		else {
+			printf ("Image type NOT VALID !!!! \n");	
+			result = EXIT_FAILURE;
+			break;
+		}
+
+		// Write or copy the finished tile before the next one 
+		if ( my_rank == ROOT_NODE ) {
+			if ( store_tile != NULL ) {
+				if ( store_tile ( comp_tile, tile_y, width, tile_rows, user_data ) == EXIT_FAILURE ) {
+					result = EXIT_FAILURE;
+				}
+			}
+			else if ( my_image != NULL ) {
+				memcpy ( (BYTE *)my_image + (size_t)tile_y * width * global_image_type, comp_tile, tile_bytes );
+			}
+		}
+	}
+
+	global_num_pixels = saved_num_pixels;
+	global_mod_pixels = saved_mod_pixels;
+	global_add_pixels = saved_add_pixels;
+	memcpy ( global_roi, saved_roi, 4 * sizeof(int) );
+
+	free ( tile_buffer );
+
+	return result;
+}
+	
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition without the final image 
+ *         gathering: every node keeps its composited region 
+ *         ( See set_composited_region ). When an output file 
+ *         is set, the regions are written to it.
+ *         ( Interleaved pixel types )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+static int composite_without_gather ( unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int width, unsigned int height, \
+				      unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+				      MPI_Comm MPI_COMM_COMPOSITION )
+{
+	unsigned int order_rank;
+	MPI_Comm     order_comm;
+
+	int result;
+
+	region_image  = NULL;
+	region_offset = 0;
+	region_counts = 0;
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Distributed result is not supported by the hierarchical composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	if (( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+		printf( "<<< ERROR >> Distributed result of planar pixels is not supported \n" );
+		return EXIT_FAILURE;
+	}
+
+	// Rank order ( See Do_234ZComposition )
+	if ( select_composition_order ( my_rank, nnodes, NULL, MPI_COMM_COMPOSITION, \
+					&order_rank, &order_comm ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	skip_final_gather = true;
+
+	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+		result = Do_234Composition_Core_BYTE ( my_rank, nnodes, \
+						       width, height, pixel_ID, merge_ID, \
+						       (BYTE *)my_image, MPI_COMM_COMPOSITION );
+	}
+	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
+		result = Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
+							width, height, pixel_ID, merge_ID, \
+							(float *)my_image, MPI_COMM_COMPOSITION );
+	}
+	else {
+		printf ("Image type NOT VALID !!!! \n");	
+		result = EXIT_FAILURE;
+	}
+
+	skip_final_gather = false;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition and write the composited 
+ *         image to a file. Every node writes its own region 
+ *         of the image ( MPI-IO collective write ), so the 
+ *         final image gathering on the ROOT_NODE is skipped 
+ *         and my_image of the ROOT_NODE is not updated. 
+ *         The rows are written in memory order.
+ *         ( Interleaved pixel types )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input Image
+ *  @param  file_name      [in]  Output file
+ *  @param  file_format    [in]  FILE_RAW or FILE_PNM
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_File ( unsigned int my_rank, unsigned int nnodes, \
+			      unsigned int width, unsigned int height, \
+			      unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+			      const char *file_name, unsigned int file_format, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	int result;
+
+	if (( file_format != FILE_RAW ) && ( file_format != FILE_PNM )) {
+		printf( "<<< ERROR >> Undefined output file format %d \n", file_format );
+		return EXIT_FAILURE;
+	}
+
+	output_file_name   = file_name;
+	output_file_format = file_format;
+
+	result = composite_without_gather ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+					    my_image, MPI_COMM_COMPOSITION );
+
+	output_file_name = NULL;
+
+	return result;
+}
+	
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition without the final image 
+ *         gathering ( Runtime equivalent of _NOGATHER ) and 
+ *         return the composited region of my node: pixels 
+ *         [ region_offset, region_offset + region_counts ) 
+ *         of the image. Nodes without a region get NULL and 
+ *         zero pixels. The region is valid until the next 
+ *         composition. ( Interleaved pixel types )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input Image
+ *  @param  my_region      [out] Composited region of my node
+ *  @param  my_offset      [out] Offset of the region ( pixels )
+ *  @param  my_counts      [out] Number of pixels of the region
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_Distributed ( unsigned int my_rank, unsigned int nnodes, \
+				     unsigned int width, unsigned int height, \
+				     unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+				     void **my_region, size_t *my_offset, size_t *my_counts, \
+				     MPI_Comm MPI_COMM_COMPOSITION )
+{
+	int result;
+
+	result = composite_without_gather ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+					    my_image, MPI_COMM_COMPOSITION );
+
+	*my_region = region_image;
+	*my_offset = region_offset;
+	*my_counts = region_counts;
+
+	return result;
+}
+	
+/*========================================================*/
+/**
+ *  @brief Set the ROI (Region of Interest) of my image 
+ *         for the next composition (ALPHA_ROI and DEPTH_ROI). 
+ *         Pixels outside the ROI must be empty. Without this 
+ *         call the ROI is computed from the non-zero alpha 
+ *         pixels of my image.
+ *
+ *  @param  x          [in] Left side of the ROI
+ *  @param  y          [in] Top side of the ROI
+ *  @param  roi_width  [in] Width of the ROI
+ *  @param  roi_height [in] Height of the ROI
+*/
+/*========================================================*/
+int Set_234Composition_ROI ( unsigned int x, unsigned int y, \
+			     unsigned int roi_width, unsigned int roi_height )
+{
+	global_roi[ 0 ] = (int)x;
+	global_roi[ 1 ] = (int)y;
+	global_roi[ 2 ] = (int)( x + roi_width );
+	global_roi[ 3 ] = (int)( y + roi_height );
+
+	global_roi_defined = true;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Set the number of pixels per message of the 
+ *         pipelined Binary-Swap exchange. Each message is 
+ *         composited as soon as it arrives, while the next 
+ *         ones are still in transit. Every node must use 
+ *         the same value.
+ *
+ *  @param  pixel_ID     [in] Pixel type
+ *  @param  chunk_pixels [in] Pixels per message 
+ *                            ( 0: BSWAP_CHUNK_SIZE bytes )
+*/
+/*========================================================*/
+int Set_234Composition_Chunk ( unsigned int pixel_ID, unsigned int chunk_pixels )
+{
+	if ( pixel_ID >= NUM_PIXEL_IDS )
+	{
+		printf( "<<< ERROR >> Invalid pixel ID \n" );
+		return EXIT_FAILURE;
+	}
+
+	bswap_chunk_pixels[ pixel_ID ] = chunk_pixels;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Use Radix-k instead of Binary-Swap for the next 
+ *         compositions (ALPHA and DEPTH merging modes), 
+ *         both for power-of-two number of nodes and for the 
+ *         2nd stage after the 2-3-4 Decomposition. 
+ *         Each round exchanges the image inside groups of 
+ *         "radix" nodes, so log_radix( nnodes ) rounds are 
+ *         needed instead of log2( nnodes ). The last round 
+ *         takes the remaining factor when nnodes is not a 
+ *         power of radix. Every node must use the same value.
+ *
+ *  @param  radix [in] Nodes per group ( power-of-two; 
+ *                     0 or 2: Binary-Swap )
+*/
+/*========================================================*/
+int Set_234Composition_Radix ( unsigned int radix )
+{
+	if (( radix != 0 ) && ( check_pow2 ( radix ) == false ))
+	{
+		printf( "<<< ERROR >> Radix must be a power-of-two \n" );
+		return EXIT_FAILURE;
+	}
+
+	bswap_radix = radix;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Set the bounding box of the domain rendered by 
+ *         each node. Do_234ZComposition then composites 
+ *         the ALPHA images in the visibility order of the 
+ *         domains for the view direction given by 
+ *         Set_234Composition_View, instead of sorting the 
+ *         nodes by the minimum depth of their images. 
+ *         The order and its communicators are kept until 
+ *         the domains or the view direction change.
+ *         Collective: every node gives its own domain.
+ *
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  bounds  [in] Bounding box of my domain ( x, y, z min 
+ *                       and x, y, z max; NULL: Minimum depth )
+ *  @param  MPI_COMM_COMPOSITION [in] MPI Communicator
+*/
+/*========================================================*/
+int Set_234Composition_Domain ( unsigned int my_rank, unsigned int nnodes, \
+				const float* bounds, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	view_order_valid = false;
+
+	if ( domain_bounds != NULL ) {
+		free ( domain_bounds );
+		free ( view_order );
+		domain_bounds = NULL;
+		view_order = NULL;
+	}
+
+	if ( bounds == NULL ) return EXIT_SUCCESS;
+
+	domain_bounds = (float *)malloc ( 6 * nnodes * sizeof(float) );
+	view_order    = (int *)malloc ( nnodes * sizeof(int) );
+
+	if (( domain_bounds == NULL ) || ( view_order == NULL )) {
+		printf( "<<< ERROR >> Cannot allocate memory for the domain bounds \n" );
+		free ( domain_bounds );
+		free ( view_order );
+		domain_bounds = NULL;
+		view_order = NULL;
+		return EXIT_FAILURE;
+	}
+
+	MPI_Allgather( (void *)bounds, 6, MPI_FLOAT, domain_bounds, 6, MPI_FLOAT, MPI_COMM_COMPOSITION );
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Set the view direction used with the domains of 
+ *         Set_234Composition_Domain. Every node must give 
+ *         the same direction.
+ *
+ *  @param  direction [in] View direction ( x, y, z; 
+ *                         0, 0, 0: Minimum depth )
+*/
+/*========================================================*/
+int Set_234Composition_View ( const float* direction )
+{
+	if (( view_direction[ 0 ] != direction[ 0 ] ) || \
+	    ( view_direction[ 1 ] != direction[ 1 ] ) || \
+	    ( view_direction[ 2 ] != direction[ 2 ] )) 
+	{
+		view_direction[ 0 ] = direction[ 0 ];
+		view_direction[ 1 ] = direction[ 1 ];
+		view_direction[ 2 ] = direction[ 2 ];
+		view_order_valid = false;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Set the placement of each node in the network. 
+ *         The nodes are then ordered along the Z-order 
+ *         curve of their coordinates, so that the 2-3-4 
+ *         groups and the partners of the first ( largest ) 
+ *         Binary-Swap stages are close in the network. 
+ *         Only RGBAZ64 pixels of Do_234Composition use this 
+ *         order: they are merged by depth sorting alone, 
+ *         which does not depend on the order of the nodes 
+ *         ( The other pixel types are alpha-blended ).
+ *         Collective: every node gives its own coordinates.
+ *
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  coords  [in] Network coordinates of my node ( e.g. Torus 
+ *                       coordinates; NULL: Shared memory node )
+ *  @param  ndims   [in] Number of coordinates
+ *  @param  MPI_COMM_COMPOSITION [in] MPI Communicator
+*/
+/*========================================================*/
+int Set_234Composition_Placement ( unsigned int my_rank, unsigned int nnodes, \
+				   const int* coords, unsigned int ndims, \
+				   MPI_Comm MPI_COMM_COMPOSITION )
+{
+	MPI_Comm node_comm;
+	int node_rank;		// Lowest rank of my shared memory node
+	int* coords_list;
+
+	if ( placement_order != NULL ) {
+		free ( placement_order );
+		placement_order = NULL;
+	}
+
+	if ( ndims > PLACEMENT_MAX_DIMS ) {
+		printf( "<<< ERROR >> Number of coordinates must be at most %d \n", PLACEMENT_MAX_DIMS );
+		return EXIT_FAILURE;
+	}
+
+	if (( coords == NULL ) || ( ndims == 0 )) 
+	{
+		MPI_Comm_split_type ( MPI_COMM_COMPOSITION, MPI_COMM_TYPE_SHARED, (int)my_rank, \
+				      MPI_INFO_NULL, &node_comm );
+
+		node_rank = (int)my_rank;
+		MPI_Bcast ( &node_rank, 1, MPI_INT, 0, node_comm );
+		MPI_Comm_free ( &node_comm );
+
+		coords = &node_rank;
+		ndims  = 1;
+	}
+
+	coords_list     = (int *)malloc ( nnodes * ndims * sizeof(int) );
+	placement_order = (int *)malloc ( nnodes * sizeof(int) );
+
+	if (( coords_list == NULL ) || ( placement_order == NULL )) {
+		printf( "<<< ERROR >> Cannot allocate memory for the placement order \n" );
+		free ( coords_list );
+		free ( placement_order );
+		placement_order = NULL;
+		return EXIT_FAILURE;
+	}
+
+	MPI_Allgather( (void *)coords, (int)ndims, MPI_INT, coords_list, (int)ndims, MPI_INT, MPI_COMM_COMPOSITION );
+
+	if ( get_placement_order ( nnodes, coords_list, ndims, placement_order ) == EXIT_FAILURE ) {
+		free ( coords_list );
+		free ( placement_order );
+		placement_order = NULL;
+		return EXIT_FAILURE;
+	}
+
+	placement_nnodes = nnodes;
+
+	free ( coords_list );
+
+	return EXIT_SUCCESS;
+}
+	
+/*========================================================*/
+/**
+ *  @brief Destroy variables and image buffer for 
+ *	 	   234 Image  Compositing 
+ *         
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  width   [in] Image width
+ *  @param  height  [in] Image size
+ *  @param  height  [in] Pixel type 
+*/
+/*========================================================*/
+int Destroy_234Composition ( unsigned int pixel_ID )
+{
+	// Communicator in visibility order ( See Do_234ZComposition )
+	if ( order_list != NULL ) {
+		MPI_Comm_free ( &MPI_COMM_ORDER );
+		free ( order_list );
+		order_list = NULL;
+	}
+
+	// Domains of the nodes ( See Set_234Composition_Domain )
+	if ( domain_bounds != NULL ) {
+		free ( domain_bounds );
+		free ( view_order );
+		domain_bounds = NULL;
+		view_order = NULL;
+		view_order_valid = false;
+	}
+
+	// Placement of the nodes ( See Set_234Composition_Placement )
+	if ( placement_order != NULL ) {
+		free ( placement_order );
+		placement_order = NULL;
+	}
+
+	// Output buffer and lent image ( See Set_234Composition_Output 
+	// and Do_234Composition_View )
+	output_image = NULL;
+	view_image   = NULL;
+
+	// Depth segment ( See Do_234ZComposition )
+	if ( zcomp_depth != NULL ) {
+		release_pooled_memory_region ( memory_pool, zcomp_depth, zcomp_depth_size );
+		zcomp_depth = NULL;
+		zcomp_depth_size = 0;
+	}
+
+	// Hierarchical composition ( See Init_234Composition_Hierarchical )
+	if ( use_hierarchy == true ) 
+	{
+		MPI_Win_free ( &shared_window );
+		free ( shared_images );
+		shared_images = NULL;
+		MPI_Comm_free ( &MPI_COMM_SHARED );
+
+		// Only the node leaders take part in the inter-node composition
+		if ( MPI_COMM_LEADERS == MPI_COMM_NULL ) {
+			use_hierarchy = false;
+			return EXIT_SUCCESS;
+		}
+	}
+
+	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
+	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
+			Destroy_234Composition_BYTE ( pixel_ID );
+	}
+	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 ) || \
+		 ( pixel_ID == ID_RGBA128_PLANAR ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) {
+			Destroy_234Composition_FLOAT ( pixel_ID );
+	}
+
+	if ( use_hierarchy == true ) {
+		MPI_Comm_free ( &MPI_COMM_LEADERS );
+		use_hierarchy = false;
+	}
+	return EXIT_SUCCESS;
+}
+
 /*========================================================*/
 /**
- *  @brief Initialize variables and image buffer for 
- *	 	   234 Image  Compositing 
+ *  @brief Free the image buffers that Destroy_234Composition 
+ *         keeps for the next Init_234Composition 
+*/
+/*========================================================*/
+int Release_234Composition_Memory ( void )
+{
+	free_memory_pool ( memory_pool );
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Get the timings and transferred bytes of the 
+ *         last composition of my node 
+ *         
+ *  @param  stats [out] Statistics of the last composition
+*/
+/*========================================================*/
+int Get_234Composition_Stats ( Compositor234_Stats* stats )
+{
+	if ( stats == NULL ) {
+		printf( "<<< ERROR >> Get_234Composition_Stats: NULL stats \n" );
+		return EXIT_FAILURE;
+	}
+
+	*stats = composition_stats;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Reduce the statistics of the last composition over 
+ *         the nodes of comm, field by field ( Collective ) 
+ *         
+ *  @param  stats [out] Reduced statistics ( All nodes )
+ *  @param  op    [in]  MPI_SUM, MPI_MAX or MPI_MIN
+ *  @param  comm  [in]  MPI communicator
+*/
+/*========================================================*/
+int Reduce_234Composition_Stats ( Compositor234_Stats* stats, MPI_Op op, MPI_Comm comm )
+{
+	double values[ STATS_MAX_STAGES + 11 ];
+	unsigned int i, n;
+
+	if ( stats == NULL ) {
+		printf( "<<< ERROR >> Reduce_234Composition_Stats: NULL stats \n" );
+		return EXIT_FAILURE;
+	}
+
+	// Byte counters are reduced as double ( Exact up to 2^53 )
+	n = 0;
+	values[ n++ ] = composition_stats.total_time;
+	values[ n++ ] = composition_stats.partial_time;
+	values[ n++ ] = composition_stats.gather_time;
+	values[ n++ ] = composition_stats.blend_time;
+	values[ n++ ] = composition_stats.wait_time;
+	values[ n++ ] = (double)composition_stats.num_stages;
+	values[ n++ ] = (double)composition_stats.bytes_sent;
+	values[ n++ ] = (double)composition_stats.bytes_received;
+	values[ n++ ] = (double)composition_stats.compress_raw_bytes;
+	values[ n++ ] = (double)composition_stats.compress_bytes;
+	for ( i = 0; i < STATS_MAX_STAGES; i++ ) {
+		values[ n++ ] = composition_stats.stage_time[ i ];
+	}
+
+	if ( MPI_Allreduce ( MPI_IN_PLACE, values, (int)n, MPI_DOUBLE, op, comm ) != MPI_SUCCESS ) {
+		printf( "<<< ERROR >> Reduce_234Composition_Stats: MPI_Allreduce failed \n" );
+		return EXIT_FAILURE;
+	}
+
+	n = 0;
+	stats->total_time   = values[ n++ ];
+	stats->partial_time = values[ n++ ];
+	stats->gather_time  = values[ n++ ];
+	stats->blend_time   = values[ n++ ];
+	stats->wait_time    = values[ n++ ];
+	stats->num_stages         = (unsigned int)values[ n++ ];
+	stats->bytes_sent         = (unsigned long long)values[ n++ ];
+	stats->bytes_received     = (unsigned long long)values[ n++ ];
+	stats->compress_raw_bytes = (unsigned long long)values[ n++ ];
+	stats->compress_bytes     = (unsigned long long)values[ n++ ];
+	for ( i = 0; i < STATS_MAX_STAGES; i++ ) {
+		stats->stage_time[ i ] = values[ n++ ];
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Create a compositing context and initialize its 
+ *	 	   variables and image buffer for 234 Image Compositing 
  *         
+ *  @param  context [out] Compositing context
  *  @param  my_rank [in] MPI Rank
  *  @param  nnodes  [in] MPI number of nodes
  *  @param  width   [in] Image width
  *  @param  height  [in] Image size
- *  @param  height  [in] Pixel type
+ *  @param  pixel_ID [in] Pixel type
 */
 /*========================================================*/
-int Init_234Composition ( unsigned int my_rank, unsigned int nnodes, unsigned int width, unsigned int height, unsigned int pixel_ID )
+int Init_234Composition_Context ( Compositor234_Context** context, \
+				  unsigned int my_rank, unsigned int nnodes, \
+				  unsigned int width, unsigned int height, unsigned int pixel_ID )
 {
-	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
-	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
-			Init_234Composition_BYTE ( my_rank, nnodes, width, height, pixel_ID );
+	Compositor234_Context* saved_context;
+	int result;
+
+	*context = (Compositor234_Context *)calloc( 1, sizeof(Compositor234_Context) );
+	if ( *context == NULL )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the compositing context \n" );
+		return EXIT_FAILURE;
 	}
-	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
-			Init_234Composition_FLOAT ( my_rank, nnodes, width, height, pixel_ID );
+
+	saved_context = compositor_context;
+	compositor_context = *context;
+
+	result = Init_234Composition ( my_rank, nnodes, width, height, pixel_ID );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Create a compositing context and initialize its 
+ *	 	   variables and image buffer for Hierarchical 
+ *	 	   234 Image Compositing
+ *		   ( See Init_234Composition_Hierarchical )
+ *
+ *  @param  context [out] Compositing context
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  width   [in] Image width
+ *  @param  height  [in] Image size
+ *  @param  height  [in] Pixel type
+*/
+/*========================================================*/
+int Init_234Composition_Hierarchical_Context ( Compositor234_Context** context, \
+					       unsigned int my_rank, unsigned int nnodes, \
+					       unsigned int width, unsigned int height, unsigned int pixel_ID )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	*context = (Compositor234_Context *)calloc( 1, sizeof(Compositor234_Context) );
+	if ( *context == NULL )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the compositing context \n" );
+		return EXIT_FAILURE;
 	}
-	return EXIT_SUCCESS;
+
+	saved_context = compositor_context;
+	compositor_context = *context;
+
+	result = Init_234Composition_Hierarchical ( my_rank, nnodes, width, height, pixel_ID );
+
+	compositor_context = saved_context;
+
+	return result;
 }
 
 /*========================================================*/
 /**
- *  @brief Do 234 Composition 
- *		   (BYTE image pixel: RGBA32)
+ *  @brief Get my image buffer in the shared memory window 
+ *		   of the given context
+ *		   ( See Get_234Composition_Shared_Image )
+ *
+ *  @param  context [in] Compositing context
+*/
+/*========================================================*/
+void* Get_234Composition_Shared_Image_Context ( Compositor234_Context* context )
+{
+	Compositor234_Context* saved_context;
+	void* result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Get_234Composition_Shared_Image ( );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition using the given context 
+ *		   ( See Do_234Composition )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_Context ( Compositor234_Context* context, \
+				 unsigned int my_rank, unsigned int nnodes, \
+				 unsigned int width, unsigned int height, \
+				 unsigned int pixel_ID, unsigned int merge_ID, \
+				 void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234Composition ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+				     my_image, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition with depth buffer using the 
+ *		   given context ( See Do_234ZComposition )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  my_depth       [in]  Depth buffer
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234ZComposition_Context ( Compositor234_Context* context, \
+				  unsigned int my_rank, unsigned int nnodes, \
+				  unsigned int width, unsigned int height, \
+				  unsigned int pixel_ID, unsigned int merge_ID, \
+				  void *my_image, const float *my_depth, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234ZComposition ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+				      my_image, my_depth, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition using the given context and 
+ *		   return the pointer of the gathered image 
+ *		   ( See Do_234Composition_Ptr )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+void*  Do_234Composition_Ptr_Context ( Compositor234_Context* context, \
+				      unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int width, unsigned int height, \
+				      unsigned int pixel_ID, unsigned int merge_ID, \
+				      void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	void* result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234Composition_Ptr ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+					 my_image, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition using the given context and 
+ *		   lend the gathered image ( See Do_234Composition_View )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  view           [out] Gathered image ( ROOT_NODE, otherwise NULL )
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_View_Context ( Compositor234_Context* context, \
+				      unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int width, unsigned int height, \
+				      unsigned int pixel_ID, unsigned int merge_ID, \
+				      void *my_image, void **view, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234Composition_View ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+					  my_image, view, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Give back the image lent by the given context 
+ *		   ( See Release_234Composition_View )
+ *
+ *  @param  context [in] Compositing context
+ *  @param  view    [in] Gathered image
+ */
+/*========================================================*/
+int Release_234Composition_View_Context ( Compositor234_Context* context, void *view )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Release_234Composition_View ( view );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Register the output buffer of the given context 
+ *		   ( See Set_234Composition_Output )
+ *
+ *  @param  context [in] Compositing context
+ *  @param  image   [in] Output buffer ( NULL: my_image )
+ *  @param  size    [in] Size of the output buffer in bytes
+ */
+/*========================================================*/
+int Set_234Composition_Output_Context ( Compositor234_Context* context, void *image, size_t size )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Set_234Composition_Output ( image, size );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Size in bytes of the output buffer of the given 
+ *		   context ( See Get_234Composition_Output_Size )
+ *
+ *  @param  context [in] Compositing context
+ */
+/*========================================================*/
+size_t Get_234Composition_Output_Size_Context ( Compositor234_Context* context )
+{
+	Compositor234_Context* saved_context;
+	size_t result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Get_234Composition_Output_Size ( );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition tile by tile using the given 
+ *		   context ( See Do_234Composition_Tiled )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  tile_height    [in]  Rows per tile ( 0: whole image )
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image
+ *  @param  load_tile      [in]  Fills a tile of my image ( or NULL )
+ *  @param  store_tile     [in]  Receives a composited tile ( or NULL )
+ *  @param  user_data      [in]  Passed to load_tile and store_tile
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_Tiled_Context ( Compositor234_Context* context, \
+				       unsigned int my_rank, unsigned int nnodes, \
+				       unsigned int width, unsigned int height, unsigned int tile_height, \
+				       unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+				       Compositor234_TileFunc load_tile, Compositor234_TileFunc store_tile, \
+				       void *user_data, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234Composition_Tiled ( my_rank, nnodes, width, height, tile_height, \
+					   pixel_ID, merge_ID, my_image, load_tile, store_tile, \
+					   user_data, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition and write the composited 
+ *         image to a file using the given context
+ *         ( See Do_234Composition_File )
+ *
+ *  @param  context        [in]  Compositing context
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input Image
+ *  @param  file_name      [in]  Output file
+ *  @param  file_format    [in]  FILE_RAW or FILE_PNM
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ */
+/*========================================================*/
+int  Do_234Composition_File_Context ( Compositor234_Context* context, \
+				      unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int width, unsigned int height, \
+				      unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+				      const char *file_name, unsigned int file_format, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
+
+	saved_context = compositor_context;
+	compositor_context = context;
+
+	result = Do_234Composition_File ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+					  my_image, file_name, file_format, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition without the final image 
+ *         gathering using the given context
+ *         ( See Do_234Composition_Distributed )
  *
+ *  @param  context        [in]  Compositing context
  *  @param  my_rank        [in]  MPI rank number
  *  @param  nnodes         [in]  MPI number of nodes
  *  @param  width          [in]  Image width
  *  @param  height         [in]  Image height
  *  @param  pixel_ID       [in]  Pixel type
- *  @param  rgba_image     [in,out]  Input and Blended Image
- *  @param  MPI_COMM_234BS [in]  MPI Communicator for 234 + Binary-Swap
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input Image
+ *  @param  my_region      [out] Composited region of my node
+ *  @param  my_offset      [out] Offset of the region ( pixels )
+ *  @param  my_counts      [out] Number of pixels of the region
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
  */
 /*========================================================*/
-int  Do_234Composition ( unsigned int my_rank, unsigned int nnodes, \
-			 unsigned int width, unsigned int height, \
-			 unsigned int pixel_ID, unsigned int merge_ID, \
-			 void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+int  Do_234Composition_Distributed_Context ( Compositor234_Context* context, \
+					     unsigned int my_rank, unsigned int nnodes, \
+					     unsigned int width, unsigned int height, \
+					     unsigned int pixel_ID, unsigned int merge_ID, void *my_image, \
+					     void **my_region, size_t *my_offset, size_t *my_counts, \
+					     MPI_Comm MPI_COMM_COMPOSITION )
 {
-	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
-	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
-		Do_234Composition_Core_BYTE ( my_rank, nnodes, \
-					      width, height, pixel_ID, merge_ID, \
-					      (BYTE *)my_image, MPI_COMM_COMPOSITION );
+	Compositor234_Context* saved_context;
+	int result;
 
-		// Copy the gathered image to my_image_byte
-		if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-			memcpy ( my_image, temp_image_byte_ptr, width * height * global_image_type * sizeof(BYTE) );
-		}
-	}
-	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
-		Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
-					       width, height, pixel_ID, merge_ID, \
-					       (float *)my_image, MPI_COMM_COMPOSITION );
-
-		// Copy the gathered image to my_image_byte
-		if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-			if ( pixel_ID == ID_RGBA128  ) {
-				memcpy ( my_image, temp_image_rgba128, width * height * RGBA * sizeof(float));
-			}
-			else if ( pixel_ID == ID_RGBAZ160 ) {
-				memcpy ( my_image, temp_image_rgbaz160, width * height * RGBAZ * sizeof(float));
-			}
-		}
-	}
+	saved_context = compositor_context;
+	compositor_context = context;
 
-	return EXIT_SUCCESS;
+	result = Do_234Composition_Distributed ( my_rank, nnodes, width, height, pixel_ID, merge_ID, \
+						 my_image, my_region, my_offset, my_counts, MPI_COMM_COMPOSITION );
+
+	compositor_context = saved_context;
+
+	return result;
 }
 
 /*========================================================*/
 /**
- *  @brief Do 234 Composition 
- *		   (BYTE image pixel: RGBA32)
+ *  @brief Set the ROI of my image for the next composition 
+ *		   using the given context ( See Set_234Composition_ROI )
  *
- *  @param  my_rank        [in]  MPI rank number
- *  @param  nnodes         [in]  MPI number of nodes
- *  @param  width          [in]  Image width
- *  @param  height         [in]  Image height
- *  @param  pixel_ID       [in]  Pixel type
- *  @param  rgba_image     [in,out]  Input and Blended Image
- *  @param  MPI_COMM_234BS [in]  MPI Communicator for 234 + Binary-Swap
+ *  @param  context    [in] Compositing context
+ *  @param  x          [in] Left side of the ROI
+ *  @param  y          [in] Top side of the ROI
+ *  @param  roi_width  [in] ROI width
+ *  @param  roi_height [in] ROI height
  */
 /*========================================================*/
+int Set_234Composition_ROI_Context ( Compositor234_Context* context, \
+				     unsigned int x, unsigned int y, \
+				     unsigned int roi_width, unsigned int roi_height )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-struct RankDepth {
-	int   rank;
-	float depth;
-} ;
+	saved_context = compositor_context;
+	compositor_context = context;
 
-int MyQSortComparator(const void* a , const void* b)
-{
-	struct RankDepth *x, *y;
+	result = Set_234Composition_ROI ( x, y, roi_width, roi_height );
 
-	x = (struct RankDepth *)a;
-	y = (struct RankDepth *)b;
+	compositor_context = saved_context;
 
-	return ( x -> depth ) - ( y -> depth ); // Closest in Front
-//	return ( y -> depth ) - ( x -> depth ); // Closest at Back
+	return result;
 }
 
-int  Do_234ZComposition ( unsigned int my_rank, unsigned int nnodes, \
-						 unsigned int width, unsigned int height, \
-						 unsigned int pixel_ID, unsigned int merge_ID, \
-						 void *my_image, const float *my_depth, MPI_Comm MPI_COMM_COMPOSITION )
+/*========================================================*/
+/**
+ *  @brief Set the number of pixels per message of the 
+ *		   pipelined Binary-Swap exchange of the given context 
+ *		   ( See Set_234Composition_Chunk )
+ *
+ *  @param  context      [in] Compositing context
+ *  @param  pixel_ID     [in] Pixel type
+ *  @param  chunk_pixels [in] Pixels per message
+ */
+/*========================================================*/
+int Set_234Composition_Chunk_Context ( Compositor234_Context* context, \
+				       unsigned int pixel_ID, unsigned int chunk_pixels )
 {
-	unsigned int send_rank;
-	unsigned int recv_rank;
+	Compositor234_Context* saved_context;
+	int result;
 
-	unsigned int i, j;
-	unsigned int image_size;
+	saved_context = compositor_context;
+	compositor_context = context;
 
-	BYTE*  my_BYTE_image_ptr; 
-	float* my_FLOAT_image_ptr; 
+	result = Set_234Composition_Chunk ( pixel_ID, chunk_pixels );
 
-	float *my_depth_ptr;
-	float min_depth, depth;
+	compositor_context = saved_context;
 
-	float *depth_list;
-	float send_depth[1];
-	
-	struct RankDepth BtoF_List[82944];
+	return result;
+}
 
-	BYTE*   rgbaz64_img; 
-	BYTE*   rgbaz64_byte_ptr; 
-	float*  rgbaz64_float_ptr; 
+/*========================================================*/
+/**
+ *  @brief Use Radix-k instead of Binary-Swap for the 
+ *		   compositions of the given context 
+ *		   ( See Set_234Composition_Radix )
+ *
+ *  @param  context [in] Compositing context
+ *  @param  radix   [in] Nodes per group
+ */
+/*========================================================*/
+int Set_234Composition_Radix_Context ( Compositor234_Context* context, unsigned int radix )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-	float*  rgbaz160_img; 
-	float*  rgbaz160_float_ptr; 
+	saved_context = compositor_context;
+	compositor_context = context;
 
+	result = Set_234Composition_Radix ( radix );
 
-	if (( pixel_ID == ID_RGBA32 ) && ( merge_ID == ALPHA )) 
-	{
+	compositor_context = saved_context;
 
-		image_size   = width * height;
-		my_depth_ptr = (float *)my_depth;
-		min_depth    = (float)*my_depth_ptr++;
+	return result;
+}
 
-		for ( i = 1; i < image_size; i++ ) {
-			depth = (float)*my_depth_ptr++;
-			if ( depth < min_depth ) {	
-				min_depth = depth; 
-			}
-		}
+/*========================================================*/
+/**
+ *  @brief Set the bounding box of the domain of each node 
+ *		   for the given context
+ *		   ( See Set_234Composition_Domain )
+ *
+ *  @param  context [in] Compositing context
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  bounds  [in] Bounding box of my domain
+ *  @param  MPI_COMM_COMPOSITION [in] MPI Communicator
+ */
+/*========================================================*/
+int Set_234Composition_Domain_Context ( Compositor234_Context* context, \
+					unsigned int my_rank, unsigned int nnodes, \
+					const float* bounds, MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-		#ifdef _234DEBUG
-			printf ("[%d of %d] MIN_DEPTH = %f \n", my_rank, nnodes, min_depth );
-		#endif
+	saved_context = compositor_context;
+	compositor_context = context;
 
-		send_depth[0] = min_depth;
-		depth_list = (float *)malloc ( nnodes * sizeof(float));
-		MPI_Allgather( send_depth, 1, MPI_FLOAT, depth_list, 1, MPI_FLOAT, MPI_COMM_COMPOSITION );
+	result = Set_234Composition_Domain ( my_rank, nnodes, bounds, MPI_COMM_COMPOSITION );
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] DEPTH[%d] = %f \n", my_rank, nnodes, i, depth_list[i] );
-		#endif
+	compositor_context = saved_context;
 
-		for ( i = 0; i < nnodes; i++ ) {
-			BtoF_List[i].rank  = i;			
-			BtoF_List[i].depth = depth_list[i];			
-		}
+	return result;
+}
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] RANK[%d] DEPTH[%f] \n", my_rank, nnodes, BtoF_List[i].rank, BtoF_List[i].depth );
-		#endif
+/*========================================================*/
+/**
+ *  @brief Set the view direction of the given context
+ *		   ( See Set_234Composition_View )
+ *
+ *  @param  context   [in] Compositing context
+ *  @param  direction [in] View direction
+ */
+/*========================================================*/
+int Set_234Composition_View_Context ( Compositor234_Context* context, const float* direction )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-		qsort( BtoF_List, nnodes, sizeof(struct RankDepth), MyQSortComparator );
+	saved_context = compositor_context;
+	compositor_context = context;
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] RANK[%d] DEPTH[%f] \n", my_rank, nnodes, BtoF_List[i].rank, BtoF_List[i].depth );
-		#endif
+	result = Set_234Composition_View ( direction );
 
-		i = 0;
-		while ( my_rank != BtoF_List[i].rank ) {
-			i++; 
-		}
+	compositor_context = saved_context;
 
-		send_rank = i;
-		recv_rank = BtoF_List[my_rank].rank;
+	return result;
+}
 
-		if ( my_rank != send_rank ) {
+/*========================================================*/
+/**
+ *  @brief Set the placement of each node in the network 
+ *         for the given context
+ *		   ( See Set_234Composition_Placement )
+ *
+ *  @param  context [in] Compositing context
+ *  @param  my_rank [in] MPI Rank
+ *  @param  nnodes  [in] MPI number of nodes
+ *  @param  coords  [in] Network coordinates of my node
+ *  @param  ndims   [in] Number of coordinates
+ *  @param  MPI_COMM_COMPOSITION [in] MPI Communicator
+*/
+/*========================================================*/
+int Set_234Composition_Placement_Context ( Compositor234_Context* context, \
+					   unsigned int my_rank, unsigned int nnodes, \
+					   const int* coords, unsigned int ndims, \
+					   MPI_Comm MPI_COMM_COMPOSITION )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-			#ifdef _234DEBUG
-				printf ("[%d of %d] SEND TO %d ; RECV FROM %d \n", my_rank, nnodes, send_rank, recv_rank);
-			#endif
-			
-			MPI_Irecv( temp_image_rgba32, image_size * RGBA32, MPI_BYTE, recv_rank, RECV_TAG, MPI_COMM_COMPOSITION, &global_irecv );
-			MPI_Isend( my_image,  image_size * RGBA32, MPI_BYTE, send_rank, RECV_TAG, MPI_COMM_COMPOSITION, &global_isend );
-			MPI_Wait( &global_irecv, &global_status );
-			MPI_Wait( &global_isend, &global_status );
+	saved_context = compositor_context;
+	compositor_context = context;
 
-			memcpy ( my_image, temp_image_rgba32, width * height * global_image_type * sizeof(BYTE) );
-		}
+	result = Set_234Composition_Placement ( my_rank, nnodes, coords, ndims, MPI_COMM_COMPOSITION );
 
-		Do_234Composition_Core_BYTE ( my_rank, nnodes, \
-			  	   		width, height, pixel_ID, merge_ID, \
-				  	     	(BYTE *)my_image, MPI_COMM_COMPOSITION );
+	compositor_context = saved_context;
 
-		// Copy the gathered image to my_image_byte
-		if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-			memcpy ( my_image, temp_image_byte_ptr, width * height * global_image_type * sizeof(BYTE) );
-		}
-	}
-	else if (( pixel_ID == ID_RGBAZ64 ) && ( merge_ID == DEPTH )) 
-	{
-		image_size   = width * height;
+	return result;
+}
 
-		// Generate RGBAZ Image Buffer
-		if ( ( rgbaz64_img = (BYTE *)allocate_byte_memory_region ( 
-					(unsigned int)( image_size * RGBAZ64 ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
+/*========================================================*/
+/**
+ *  @brief Destroy variables and image buffer of the given 
+ *	 	   context and release the context itself
+ *         
+ *  @param  context  [in] Compositing context
+ *  @param  pixel_ID [in] Pixel type 
+*/
+/*========================================================*/
+int Destroy_234Composition_Context ( Compositor234_Context* context, unsigned int pixel_ID )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-		my_BYTE_image_ptr = (BYTE  *)my_image;
-		my_depth_ptr      = (float *)my_depth;
+	if ( context == NULL ) return EXIT_SUCCESS;
 
-		rgbaz64_byte_ptr  = (BYTE  *)rgbaz64_img;
-		rgbaz64_float_ptr = (float *)rgbaz64_img;
+	saved_context = compositor_context;
+	compositor_context = context;
 
-		for ( i = 0; i < height; i++ ) {
-	              	for ( j = 0; j < width; j++ ) {
-				*rgbaz64_byte_ptr++ = (unsigned char)*my_BYTE_image_ptr++; // R		
-				*rgbaz64_byte_ptr++ = (unsigned char)*my_BYTE_image_ptr++; // G		
-				*rgbaz64_byte_ptr++ = (unsigned char)*my_BYTE_image_ptr++; // B		
-				*rgbaz64_byte_ptr++ = (unsigned char)*my_BYTE_image_ptr++; // A		
+	result = Destroy_234Composition ( pixel_ID );
 
-				 rgbaz64_float_ptr++;
-				*rgbaz64_float_ptr++ = (float)*my_depth_ptr++; // Z		
+	free_memory_pool ( memory_pool );
+	free_234_communicators ( );
 
-				rgbaz64_byte_ptr += 4;
-			}
-		}
+	compositor_context = saved_context;
 
-		Do_234Composition_Core_BYTE ( my_rank, nnodes, \
-			  		 	width, height, pixel_ID, merge_ID, \
-				     	 	(BYTE *)rgbaz64_img, MPI_COMM_COMPOSITION );
+	free( context );
 
-		if ( my_rank == ROOT_NODE ) {
+	return result;
+}
 
-			my_BYTE_image_ptr = (BYTE  *)my_image;
+/*========================================================*/
+/**
+ *  @brief Free the image buffers kept by the given context 
+ *         ( See Release_234Composition_Memory )
+ *         
+ *  @param  context  [in] Compositing context
+*/
+/*========================================================*/
+int Release_234Composition_Memory_Context ( Compositor234_Context* context )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-			if ( nnodes != 3 ) 
-			{
-				rgbaz64_byte_ptr  = (BYTE  *)temp_image_rgbaz64;
-			}
-			else  // nnodes == 3
-			{ 
-				rgbaz64_byte_ptr  = (BYTE  *)rgbaz64_img;
-			}
-		
-			for ( i = 0; i < height; i++ ) {
-				for ( j = 0; j < width; j++ ) {
-					*my_BYTE_image_ptr++ = (unsigned char)*rgbaz64_byte_ptr++; // R		
-					*my_BYTE_image_ptr++ = (unsigned char)*rgbaz64_byte_ptr++; // G		
-					*my_BYTE_image_ptr++ = (unsigned char)*rgbaz64_byte_ptr++; // B		
-					*my_BYTE_image_ptr++ = (unsigned char)*rgbaz64_byte_ptr++; // A		
-
-					rgbaz64_byte_ptr += 4; // SKIP Z
-				}
-			}
-		}
+	saved_context = compositor_context;
+	compositor_context = context;
 
-	}
-	else if (( pixel_ID == ID_RGBA128 ) && ( merge_ID == ALPHA )) 
-	{
-		image_size   = width * height;
-		my_depth_ptr = (float *)my_depth;
-		min_depth    = (float)*my_depth_ptr++;
+	result = Release_234Composition_Memory ( );
 
-		for ( i = 1; i < image_size; i++ ) {
-			depth = (float)*my_depth_ptr++;
-			if ( depth < min_depth ) {	
-				min_depth = depth; 
-			}
-		}
+	compositor_context = saved_context;
 
-		#ifdef _234DEBUG
-			printf ("[%d of %d] MIN_DEPTH = %f \n", my_rank, nnodes, min_depth );
-		#endif
+	return result;
+}
 
-		send_depth[0] = min_depth;
-		depth_list = (float *)malloc ( nnodes * sizeof(float));
-		MPI_Allgather( send_depth, 1, MPI_FLOAT, depth_list, 1, MPI_FLOAT, MPI_COMM_COMPOSITION );
+/*========================================================*/
+/**
+ *  @brief Get the statistics of the last composition of 
+ *         the given context ( See Get_234Composition_Stats )
+ *         
+ *  @param  context  [in]  Compositing context
+ *  @param  stats    [out] Statistics of the last composition
+*/
+/*========================================================*/
+int Get_234Composition_Stats_Context ( Compositor234_Context* context, Compositor234_Stats* stats )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] DEPTH[%d] = %f \n", my_rank, nnodes, i, depth_list[i] );
-		#endif
+	saved_context = compositor_context;
+	compositor_context = context;
 
-		for ( i = 0; i < nnodes; i++ ) {
-			BtoF_List[i].rank  = i;			
-			BtoF_List[i].depth = depth_list[i];			
-		}
+	result = Get_234Composition_Stats ( stats );
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] RANK[%d] DEPTH[%f] \n", my_rank, nnodes, BtoF_List[i].rank, BtoF_List[i].depth );
-		#endif
+	compositor_context = saved_context;
 
-		qsort( BtoF_List, nnodes, sizeof(struct RankDepth), MyQSortComparator );
+	return result;
+}
 
-		#ifdef _234DEBUG
-			for ( i = 0; i < nnodes; i++ )
-				printf ("[%d of %d] RANK[%d] DEPTH[%f] \n", my_rank, nnodes, BtoF_List[i].rank, BtoF_List[i].depth );
-		#endif
+/*========================================================*/
+/**
+ *  @brief Reduce the statistics of the given context over 
+ *         the nodes of comm ( See Reduce_234Composition_Stats )
+ *         
+ *  @param  context  [in]  Compositing context
+ *  @param  stats    [out] Reduced statistics
+ *  @param  op       [in]  MPI reduction operation
+ *  @param  comm     [in]  MPI communicator
+*/
+/*========================================================*/
+int Reduce_234Composition_Stats_Context ( Compositor234_Context* context, Compositor234_Stats* stats, \
+					  MPI_Op op, MPI_Comm comm )
+{
+	Compositor234_Context* saved_context;
+	int result;
 
-		i = 0;
-		while ( my_rank != BtoF_List[i].rank ) {
-			i++; 
-		}
+	saved_context = compositor_context;
+	compositor_context = context;
 
-		send_rank = i;
-		recv_rank = BtoF_List[my_rank].rank;
+	result = Reduce_234Composition_Stats ( stats, op, comm );
 
-		if ( my_rank != send_rank ) {
+	compositor_context = saved_context;
 
-			#ifdef _234DEBUG
-				printf ("[%d of %d] SEND TO %d ; RECV FROM %d \n", my_rank, nnodes, send_rank, recv_rank);
-			#endif
-			
-			MPI_Irecv( temp_image_rgba128, image_size * RGBA, MPI_FLOAT, recv_rank, RECV_TAG, MPI_COMM_COMPOSITION, &global_irecv );
-			MPI_Isend( my_image,  image_size * RGBA, MPI_FLOAT, send_rank, RECV_TAG, MPI_COMM_COMPOSITION, &global_isend );
-			MPI_Wait( &global_irecv, &global_status );
-			MPI_Wait( &global_isend, &global_status );
+	return result;
+}
 
-			memcpy ( my_image, temp_image_rgba128, width * height * RGBA * sizeof(float) );
-		}
+#ifdef _PROGRESS_THREAD
+/*========================================================*/
+/**
+ *  @brief Progress thread of a non-blocking composition
+ *
+ *  @param  arg [in] Non-blocking composition
+*/
+/*========================================================*/
+static void* icomposition_progress_thread ( void* arg )
+{
+	Compositor234_Request* request;
 
-		Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
-			  	   		width, height, pixel_ID, merge_ID, \
-				  	     	(float *)my_image, MPI_COMM_COMPOSITION );
+	request = (Compositor234_Request *)arg;
 
-		// Copy the gathered image to my_image_byte
-		if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-			memcpy ( my_image, temp_image_rgba128, width * height * global_image_type * sizeof(float) );
-		}
+	// Context of the caller of Ibegin_234Composition
+	compositor_context = request->context;
+
+	icomp_progress ( request, true );
+
+	return NULL;
+}
+#endif
 
+/*========================================================*/
+/**
+ *  @brief Release a completed non-blocking composition
+ *
+ *  @param  request [in,out] Non-blocking composition
+*/
+/*========================================================*/
+static void icomposition_free ( Compositor234_Request** request )
+{
+	#ifdef _PROGRESS_THREAD
+	if ( (*request)->has_progress_thread == true )
+	{
+		pthread_join( (*request)->progress_thread, NULL );
 	}
-	else if (( pixel_ID == ID_RGBAZ160 ) && ( merge_ID == DEPTH )) {
+	#endif
 
-		image_size   = width * height;
+	if ( (*request)->recv_image )
+		free ( (*request)->recv_image );
 
-		// Generate RGBAZ Image Buffer
-		if ( ( rgbaz160_img = (float *)allocate_float_memory_region ( 
-					(unsigned int)( image_size * RGBAZ160 ))) == NULL ) {
-			MPI_Finalize();
+	if ( (*request)->requests )
+		free ( (*request)->requests );
+
+	free ( *request );
+	*request = NULL;
+}
+
+/*========================================================*/
+/**
+ *  @brief Start a non-blocking 234 Composition 
+ *		   ( Interleaved pixel types. Same 2-3-4 + Binary-Swap 
+ *		     stages as Do_234Composition )
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  merge_ID       [in]  Pixel merging mode
+ *  @param  my_image       [in,out]  Input and Blended Image 
+ *                                   (Not to be used until completed)
+ *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator
+ *  @param  request        [out] Non-blocking composition
+ */
+/*========================================================*/
+int  Ibegin_234Composition ( unsigned int my_rank, unsigned int nnodes, \
+			     unsigned int width, unsigned int height, \
+			     unsigned int pixel_ID, unsigned int merge_ID, \
+			     void *my_image, MPI_Comm MPI_COMM_COMPOSITION, \
+			     Compositor234_Request** request )
+{
+	static unsigned int icomposition_counter = 0;
+
+	unsigned int pixel_size;
+	unsigned int recv_pixels;
+
+	_Bool alpha_merge;
+
+	#ifdef _PROGRESS_THREAD
+	int thread_level;
+	#endif
+
+	*request = NULL;
+
+	if ( use_hierarchy == true ) {
+		printf( "<<< ERROR >> Non-blocking composition is not supported by the hierarchical composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	switch ( pixel_ID ) {
+		case ID_RGBA32:    pixel_size = RGBA32;
+				   break;
+		case ID_RGBAZ64:   pixel_size = RGBAZ64;
+				   break;
+		case ID_RGBA56:    pixel_size = RGBA56;
+				   break;
+		case ID_RGBAZ88:   pixel_size = RGBAZ88;
+				   break;
+		case ID_RGBA64:    pixel_size = RGBA64;
+				   break;
+		case ID_RGBAZ96:   pixel_size = RGBAZ96;
+				   break;
+		case ID_RGBA128:   pixel_size = RGBA128;
+				   break;
+		case ID_RGBAZ160:  pixel_size = RGBAZ160;
+				   break;
+		default:
+			printf ("MPI Rank [%d of %d]: Undefined Pixel ID !!! \n", my_rank, nnodes );
 			return EXIT_FAILURE;
-		} ;
+	}
+
+	// ROI, COMPRESS and SPARSE give the same image as ALPHA or DEPTH 
+	// ( Alpha-blending of the RGBA pixels, depth sorting of the RGBAZ pixels )
+	alpha_merge = (( pixel_ID == ID_RGBA32 ) || ( pixel_ID == ID_RGBA56 ) || \
+		       ( pixel_ID == ID_RGBA64 ) || ( pixel_ID == ID_RGBA128 ));
+
+	if ((( alpha_merge == true ) && ( merge_ID != ALPHA ) && ( merge_ID != ALPHA_ROI ) && \
+	     ( merge_ID != ALPHA_COMPRESS ) && ( merge_ID != ALPHA_SPARSE )) || \
+	    (( alpha_merge == false ) && ( merge_ID != DEPTH ) && ( merge_ID != DEPTH_ROI ) && \
+	     ( merge_ID != DEPTH_COMPRESS ))) 
+	{
+		printf ("Image type NOT VALID !!!! ( Pixel_ID = %d merge_ID = %d ) \n", pixel_ID, merge_ID );	
+		return EXIT_FAILURE;
+	}
 
-		my_FLOAT_image_ptr = (float *)my_image;
-		my_depth_ptr       = (float *)my_depth;
+	if (( *request = (Compositor234_Request *)calloc( 1, sizeof(Compositor234_Request) )) == NULL )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the non-blocking composition \n" );
+		return EXIT_FAILURE;
+	}
 
-		rgbaz160_float_ptr = (float *)rgbaz160_img;
+	(*request)->my_rank    = my_rank;
+	(*request)->nnodes     = nnodes;
+	(*request)->pixel_ID   = pixel_ID;
+	(*request)->pixel_size = pixel_size;
+	(*request)->color_size = pixel_size;
+	(*request)->image_size = width * height;
+	(*request)->my_image   = (BYTE *)my_image;
+	(*request)->comm       = MPI_COMM_COMPOSITION;
 
-		for ( i = 0; i < height; i++ ) {
-	              	for ( j = 0; j < width; j++ ) {
-				*rgbaz160_float_ptr++ = (float)*my_FLOAT_image_ptr++; // R		
-				*rgbaz160_float_ptr++ = (float)*my_FLOAT_image_ptr++; // G		
-				*rgbaz160_float_ptr++ = (float)*my_FLOAT_image_ptr++; // B		
-				*rgbaz160_float_ptr++ = (float)*my_FLOAT_image_ptr++; // A		
-				*rgbaz160_float_ptr++ = (float)*my_depth_ptr++; // Z		
-			}
-		}
+	// Not recorded in the statistics of the context 
+	// ( See Get_234Composition_Stats )
+	(*request)->record_stats = false;
 
-		Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
-			  		 	width, height, pixel_ID, merge_ID, \
-				     	 	(float *)rgbaz160_img, MPI_COMM_COMPOSITION );
+	// Different Tags for the compositions in progress
+	(*request)->tag = ICOMP_TAG + 2 * ( icomposition_counter % ICOMP_MAX_TAGS );
+	icomposition_counter++;
 
-		if ( my_rank == ROOT_NODE ) {
+	// Pixels received at a time ( One or two pixel ranges )
+	recv_pixels = icomp_schedule ( *request );
 
-			my_FLOAT_image_ptr = (float *)my_image;
-			rgbaz160_float_ptr  = (float *)temp_image_rgbaz160;
-		
-			for ( i = 0; i < height; i++ ) {
-				for ( j = 0; j < width; j++ ) {
-					*my_FLOAT_image_ptr++ = (float)*rgbaz160_float_ptr++; // R		
-					*my_FLOAT_image_ptr++ = (float)*rgbaz160_float_ptr++; // G		
-					*my_FLOAT_image_ptr++ = (float)*rgbaz160_float_ptr++; // B		
-					*my_FLOAT_image_ptr++ = (float)*rgbaz160_float_ptr++; // A		
-					rgbaz160_float_ptr++; // SKIP Z
-				}
-			}
+	if ( recv_pixels > 0 )
+	{
+		if (( (*request)->recv_image = (BYTE *)malloc( (size_t)recv_pixels * pixel_size )) == NULL )
+		{
+			printf( "<<< ERROR >> Cannot allocate memory for the received pixels \n" );
+			icomposition_free ( request );
+			return EXIT_FAILURE;
 		}
 	}
-	else 
+
+	if (( (*request)->requests = (MPI_Request *)malloc( ( nnodes + 4 ) * sizeof(MPI_Request) )) == NULL )
 	{
-		printf ("Image type NOT VALID !!!! ( Pixel_ID = %d merge_ID = %d ) \n", pixel_ID, merge_ID );	
+		printf( "<<< ERROR >> Cannot allocate memory for the MPI requests \n" );
+		icomposition_free ( request );
 		return EXIT_FAILURE;
 	}
 
+	icomp_begin ( *request );
+
+	#ifdef _PROGRESS_THREAD
+	(*request)->context = compositor_context;
+
+	MPI_Query_thread( &thread_level );
+	if ( thread_level == MPI_THREAD_MULTIPLE )
+	{
+		(*request)->has_progress_thread = \
+			( pthread_create( &(*request)->progress_thread, NULL, icomposition_progress_thread, *request ) == 0 );
+	}
+	#endif
+
 	return EXIT_SUCCESS;
 }
 
 /*========================================================*/
 /**
- *  @brief Do 234 Composition_Ptr 
- *		   (Returns the pointer of Temporary Buffer)
- *         (Avoids costly memory copy to my_image) 
+ *  @brief Advance a non-blocking 234 Composition and check 
+ *		   whether it is completed
  *
- *  @param  my_rank        [in]  MPI rank number
- *  @param  nnodes         [in]  MPI number of nodes
- *  @param  width          [in]  Image width
- *  @param  height         [in]  Image height
- *  @param  pixel_ID       [in]  Pixel type
- *  @param  rgba_image     [in,out]  Input and Blended Image
- *  @param  MPI_COMM_COMPOSITION [in]  MPI Communicator for 234 + Binary-Swap
+ *  @param  request [in,out] Non-blocking composition 
+ *                           (Released and set to NULL when completed)
+ *  @param  flag    [out] 1 when completed, 0 otherwise
  */
 /*========================================================*/
-void*  Do_234Composition_Ptr ( unsigned int my_rank, unsigned int nnodes, \
-	  					       unsigned int width, unsigned int height, \
-						 	   unsigned int pixel_ID, unsigned int merge_ID, \
-						 	   void *my_image, MPI_Comm MPI_COMM_COMPOSITION )
+int Test_234Composition ( Compositor234_Request** request, int* flag )
 {
-	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
-	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
-
-			Do_234Composition_Core_BYTE ( my_rank, nnodes, \
-						  	   width, height, pixel_ID, merge_ID, \
-						  	   (BYTE *)my_image, MPI_COMM_COMPOSITION );
+	if ( *request == NULL )
+	{
+		*flag = 1;
+		return EXIT_SUCCESS;
+	}
 
-			// Return the pointer of the gathered image
-			if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-				switch ( pixel_ID ) {
-					case ID_RGBA32 : return (BYTE *)temp_image_rgba32;
-					case ID_RGBA56 : return (BYTE *)temp_image_rgba56;
-					case ID_RGBA64 : return (BYTE *)temp_image_rgba64;
-					case ID_RGBAZ64: return (BYTE *)temp_image_rgbaz64;
-					case ID_RGBAZ88: return (BYTE *)temp_image_rgbaz88;
-					case ID_RGBAZ96: return (BYTE *)temp_image_rgbaz96;
-				}
-			}
+	#ifdef _PROGRESS_THREAD
+	if ( (*request)->has_progress_thread == true )
+	{
+		*flag = ( (*request)->state == ICOMP_DONE );
+	}
+	else
+	#endif
+	{
+		*flag = ( icomp_progress ( *request, false ) == true );
 	}
-	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
-
-			Do_234Composition_Core_FLOAT ( my_rank, nnodes, \
-						  	   		  width, height, pixel_ID, merge_ID, \
-						  	     	  (float *)my_image, MPI_COMM_COMPOSITION );
 
-			// Return the pointer of the gathered image
-			if (( nnodes != 3 ) && ( my_rank == ROOT_NODE )) {
-				switch ( pixel_ID ) {
-					case ID_RGBA128 : return (float *)temp_image_rgba128;
-					case ID_RGBAZ160: return (float *)temp_image_rgbaz160;
-				}
-			}
+	if ( *flag == 1 )
+	{
+		icomposition_free ( request );
 	}
+
 	return EXIT_SUCCESS;
 }
-	
+
 /*========================================================*/
 /**
- *  @brief Destroy variables and image buffer for 
- *	 	   234 Image  Compositing 
- *         
- *  @param  my_rank [in] MPI Rank
- *  @param  nnodes  [in] MPI number of nodes
- *  @param  width   [in] Image width
- *  @param  height  [in] Image size
- *  @param  height  [in] Pixel type 
-*/
+ *  @brief Complete a non-blocking 234 Composition
+ *
+ *  @param  request [in,out] Non-blocking composition 
+ *                           (Released and set to NULL)
+ */
 /*========================================================*/
-int Destroy_234Composition ( unsigned int pixel_ID )
+int Wait_234Composition ( Compositor234_Request** request )
 {
-	if (( pixel_ID == ID_RGBA32  ) || ( pixel_ID == ID_RGBA56  ) || ( pixel_ID == ID_RGBA64  ) || \
-	    ( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) {
-			Destroy_234Composition_BYTE ( pixel_ID );
+	if ( *request == NULL )
+	{
+		return EXIT_SUCCESS;
 	}
-	else if (( pixel_ID == ID_RGBA128  ) || ( pixel_ID == ID_RGBAZ160 )) {
-			Destroy_234Composition_FLOAT ( pixel_ID );
+
+	#ifdef _PROGRESS_THREAD
+	if ( (*request)->has_progress_thread == false )
+	#endif
+	{
+		icomp_progress ( *request, true );
 	}
+
+	icomposition_free ( request );
+
 	return EXIT_SUCCESS;
 }
 
@@ -537,52 +3470,11 @@ int Init_234Composition_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	// ID_RGBAZ160: RGBAZ160-bit	
 
 	// ====================================================================
-	unsigned int temp_buffer_size;
-	unsigned int i;
 
-	global_num_pixels = width * height;
-	global_add_pixels = 0;
-
-	#if !defined _GATHERV // MPI_GATHER
-		if ( check_pow2 ( nnodes ) == false ) { // Non-power-of-two number of nodes
-			i = get_nearest_pow2 ( nnodes );
-		}
-		else {
-			i = nnodes;
-		}
-		
-		global_mod_pixels = global_num_pixels % i;
-	
-		if ( global_mod_pixels != 0 ) 
-		{
-			global_add_pixels = i - global_mod_pixels;
-			global_num_pixels += global_add_pixels;
-		}
-	#endif
+	set_global_num_pixels ( nnodes, (size_t)width * height );
 
-	// Temporary Buffer Size for storing 
-	// half of the image image (Binary-Swap)
-	temp_buffer_size = 0;
-	if ( global_num_pixels <= MPIXELS_8 ) 
-	{
-		temp_buffer_size = MPIXELS_8;
-	}
-	else if ( global_num_pixels <= MPIXELS_16 ) 
-	{
-		temp_buffer_size = MPIXELS_16;
-	}
-	else if ( global_num_pixels <= MPIXELS_32 ) 
-	{
-		temp_buffer_size = MPIXELS_32;
-	}
-	else if ( global_num_pixels <= MPIXELS_64 ) 
-	{
-		temp_buffer_size = MPIXELS_64;
-	}
-	else if ( global_num_pixels <= MPIXELS_128 ) 
-	{
-		temp_buffer_size = MPIXELS_128;
-	}
+	// Select the compositing routines (Scalar or SIMD)
+	Select_AlphaBlend_SIMD( );
 
 	// =======================================  
 	// 	Prepare temporay image buffer
@@ -591,14 +3483,6 @@ int Init_234Composition_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	{
 		global_image_type = RGBA32;
 		global_image_size = global_num_pixels * RGBA32; // 8 BYTES RGBA(4)		
-		temp_buffer_size *= RGBA32;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgba32 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 
 		Create_AlphaBlend_LUT( );
 	}
@@ -606,66 +3490,26 @@ int Init_234Composition_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	{
 		global_image_type = RGBAZ64;
 		global_image_size = global_num_pixels * RGBAZ64; // 8 BYTES RGBA(4)+Z(4)					
-		temp_buffer_size *= RGBAZ64;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgbaz64 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
 	else if ( pixel_ID == ID_RGBA56 ) 
 	{
 		global_image_type = RGBA56;
 		global_image_size = global_num_pixels * RGBA56; // 7 BYTES RGB(3)+A(4)		
-		temp_buffer_size *= RGBA56;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgba56 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
 	else if ( pixel_ID == ID_RGBAZ88 ) 
 	{
 		global_image_type = RGBAZ88;
 		global_image_size = global_num_pixels * RGBAZ88; // 11 BYTES RGB(3)+A(4)+Z(4)			
-		temp_buffer_size *= RGBAZ88;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgbaz88 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
 	else if ( pixel_ID == ID_RGBA64 ) 
 	{
 		global_image_type = RGBA64;
 		global_image_size = global_num_pixels * RGBA64; // 8 BYTES RGBX(4)+A(4)		
-		temp_buffer_size *= RGBA64;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgba64 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
 	else if ( pixel_ID == ID_RGBAZ96 ) 
 	{
 		global_image_type = RGBAZ96;
 		global_image_size = global_num_pixels * RGBAZ96; // 12 BYTES RGBX(4)+A(4)+Z(4)			
-		temp_buffer_size *= RGBAZ96;
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgbaz96 = (BYTE *)allocate_byte_memory_region ( 
-			(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
 	else 
 	{
@@ -674,6 +3518,19 @@ int Init_234Composition_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		return EXIT_FAILURE;
 	}
 
+	// Temporary Image Buffer ( Partial images for Send and Receive stages)
+	// Sized for Binary-Swap, grows when needed ( See reserve_temp_image )
+	if ( reserve_temp_image ( pixel_ID, get_temp_image_pixels ( my_rank, nnodes, pixel_ID, ALPHA ) ) == EXIT_FAILURE ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	}
+
+	// One pixel as MPI datatype: the final image gathering uses 
+	// pixel counts and offsets, which stay within the int range 
+	// of MPI_Gather and MPI_Gatherv for large images
+	MPI_Type_contiguous ( (int)global_image_type, MPI_BYTE, &MPI_TYPE_PIXEL );
+	MPI_Type_commit ( &MPI_TYPE_PIXEL );
+
 	// ====================================================================
 
 	// =======================================  
@@ -697,125 +3554,26 @@ int Init_234Composition_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		return EXIT_FAILURE;
 	} ;
 
-	// ====================================================================
-	// ====================================================================
-
-	if ( check_pow2 ( nnodes ) == true ) 
- 	{
-		// =======================================  
-		// 	TRADITIONAL BINARY-SWAP
-		// =======================================  
-		is_power_of_two = true; 	// Power-of-two number of nodes 
-
-		// =======================================  
-		// 	Prepare bit-reverse order communicator
-		//  for MPI_Gather without reconstruction
-		// =======================================  
-		bitrev_my_rank  = bitrevorder ( my_rank, nnodes ); // Get new Rank (Bit-reversed order)
-		bitrev_my_group = 1; // Color for new MPI communicator 
-							 // 1 unique color = 1 group of communicator		
-
-		// Generate a new MPI communicator with bit-reversed ranks
-		MPI_Comm_split ( MPI_COMM_WORLD, bitrev_my_group, bitrev_my_rank, &MPI_COMM_BITREV ); 
-		MPI_Comm_rank  ( MPI_COMM_BITREV, (int *)&bitrev_my_rank );	// New Rank inside MPI_COMM_BITREV
-		MPI_Comm_size  ( MPI_COMM_BITREV, (int *)&bitrev_nnodes  );	// NUmber of nodes in MPI_COMM_BITREV
-	}
-	else  
-	{
-		// =======================================  
-		// 	 2-3-4 DECOMPOSIITON
-		// =======================================  
-		is_power_of_two = false; 	// Non-power-of-two number of nodes 
-
-		// GROUPS of (2 and 3) or (3 and 4)
-		//
-		// 2-3 : 2^n < m < 2^n + 2^(n-1)
-		// 3-3 : 2^n + 2^(n-1)
-		// 3-4 : 2^n + 2^(n-1) < m < 2^(n+1)
-		//
-		// Example: n = 2
-		//	        2-3: m = 5 (4 < m < 6)
-		//			3-3: m = 6
-		//			3-4: m = 7 (6 < m < 8)
-
-		// =======================================  
-		// 	Number of nodes != Power-of-two (2^n)
-		// =======================================  
-
-		// Obtain the nearest power of two, that is,  2^(n+1) 
-		// Should be smaller than number of nodes
-		near_pow2 = get_nearest_pow2 ( nnodes ); 
-										
-		// Obtain the value of 2^(n) 				 
-		ngroups_234 = near_pow2 * 0.5;  
-
-		base_234 = floor ( nnodes / ngroups_234 );
-		over_234 = nnodes % ngroups_234;			
-
-		// Calculate threshold for choosing 2-3 or 3-4
-		// 2^(n) + 2^(n-1) 
- 		threshold_234 = nnodes - ( over_234 * ( base_234 + 1 ) ); 
-
-		if ( my_rank < threshold_234 ) 
-		{
-			// 2-3 (GROUPS of 2 and 3)
-			my_group_234 = floor ( my_rank / base_234 ); 		
-		} 
-		else  
-		{
-			// 3-4 (GROUPS of 3 and 4)
-			my_group_234 = ( ngroups_234 - over_234 ) +	(( my_rank - threshold_234 ) / ( base_234 + 1 ));
-		}
-
-		// Generate new MPI communciators for each of the 2-3-4 groups
-		MPI_Comm_split ( MPI_COMM_WORLD, my_group_234, my_rank, &MPI_COMM_234 ); 
-		MPI_Comm_rank ( MPI_COMM_234, &my_rank_234 ); 
-		MPI_Comm_size ( MPI_COMM_234, &nnodes_234 ); 
-
-		// =======================================
-		// 	2nd stage Binary-Swap
-		// =======================================
-
-		// List of nodes (2nd stage Binary-Swap) 
-		// Local root node (n) and its neighbor (n+1)
-		group_bswap = (int *)malloc( sizeof(int) * ngroups_234 * 2 );
-		memset( group_bswap, 0x00, sizeof(int) * ngroups_234 * 2 );
-		group_bswap_ptr = group_bswap;
-
-		// Smaller than 2-3-4 decomposition threshold
-		// 2 of 2-3 ; 3 of 3-3 ; 3 of 3-4
-		for ( i = 0; i < ( ngroups_234 - over_234 ); i++ )
-		{
-			*group_bswap_ptr++ = (int)(  i * base_234 );
-			*group_bswap_ptr++ = (int)(( i * base_234 ) + 1 );
-		}
-	
-		// Larger than 2-3-4 decomposition threshold  
-		// 3 of 2-3 ; 4 of 3-4
-		for ( i = 0; i < over_234; i++ )
-		{
-			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ));
-			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ) + 1 );
-		}
-
-		// Generate new MPI communcator for 2nd stage Binary-Swap
-		MPI_Comm_group ( MPI_COMM_WORLD, &MPI_GROUP_WORLD ); 
-		MPI_Group_incl ( MPI_GROUP_WORLD, ngroups_234 * 2, group_bswap, &MPI_GROUP_STAGE2_BSWAP ); 
-		MPI_Comm_create( MPI_COMM_WORLD, MPI_GROUP_STAGE2_BSWAP, &MPI_COMM_STAGE2_BSWAP ); 
-		MPI_Group_rank ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_my_rank ); 
-		MPI_Group_size ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_nnodes ); 
+	// =======================================  
+	// 	Prepare lists for ROI
+	// =======================================  
+	if ( ( roi_list = (int *)allocate_int_memory_region ( 
+		(unsigned int)( 4 * nnodes ))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-		if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
-		{ 	
-			bitrev_my_rank  = bitrevorder ( stage2_bswap_my_rank, stage2_bswap_nnodes ); // Get new Rank (Bit-reversed order)
-			bitrev_my_group = 1; // Color for new MPI communicator 
-								 // 1 unique color = 1 group of communicator		
+	if ( ( roi_segments = (unsigned int *)allocate_int_memory_region ( 
+		(unsigned int)( 2 * ( height + 1 )))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-			// Generate a new MPI communicator with bit-reversed ranks
-			MPI_Comm_split ( MPI_COMM_STAGE2_BSWAP, bitrev_my_group, bitrev_my_rank, &MPI_COMM_STAGE2_BITREV ); 
-			MPI_Comm_rank  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_my_rank ); // New Rank inside MPI_COMM_BITREV
-			MPI_Comm_size  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_nnodes  );	 // NUmber of nodes in MPI_COMM_BITREV
-		}
+	// Derived communicators (Binary-Swap or 2-3-4 Decomposition)
+	// Reused from the previous Init_234Composition when possible
+	if ( prepare_234_communicators ( my_rank, nnodes, MPI_COMM_234BASE ) == EXIT_FAILURE ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
 	}
 	return EXIT_SUCCESS;
 }
@@ -843,35 +3601,51 @@ int Destroy_234Composition_BYTE ( unsigned int pixel_ID )
 	// ID_RGBAZ96: RGBAZ 96-bit	
 	// ====================================================================
 
+	// Persistent requests on the image buffers
+	free_exchange_schedule ( );
+
 	// =======================================  
 	// 	Destroy temporay image buffer
 	// =======================================  	
 	if ( pixel_ID == ID_RGBA32 ) 
 	{
-		if ( temp_image_rgba32 )
-			free ( temp_image_rgba32 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgba32, \
+					       temp_image_pixels * global_image_type );
+	}
+	else if ( pixel_ID == ID_RGBAZ64 ) 
+	{
+		release_pooled_memory_region ( memory_pool, temp_image_rgbaz64, \
+					       temp_image_pixels * global_image_type );
 	}
 	else if ( pixel_ID == ID_RGBA56 ) 
 	{
-		if ( temp_image_rgba56 )
-			free ( temp_image_rgba56 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgba56, \
+					       temp_image_pixels * global_image_type );
 	}
 	else if ( pixel_ID == ID_RGBA64 ) 
 	{
-		if ( temp_image_rgba64 )
-			free ( temp_image_rgba64 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgba64, \
+					       temp_image_pixels * global_image_type );
 	}
 	else if ( pixel_ID == ID_RGBAZ88 ) 
 	{
-		if ( temp_image_rgbaz88 )
-			free ( temp_image_rgbaz88 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgbaz88, \
+					       temp_image_pixels * global_image_type );
 	}
 	else if ( pixel_ID == ID_RGBAZ96 ) 
 	{
-		if ( temp_image_rgbaz96 )
-			free ( temp_image_rgbaz96 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgbaz96, \
+					       temp_image_pixels * global_image_type );
 	}
 
+	temp_image_rgba32  = NULL;
+	temp_image_rgba56  = NULL;
+	temp_image_rgba64  = NULL;
+	temp_image_rgbaz64 = NULL;
+	temp_image_rgbaz88 = NULL;
+	temp_image_rgbaz96 = NULL;
+	temp_image_pixels  = 0;
+
 	// =======================================  
 	// 	Destroy lists for MPI_Gatherv
 	// =======================================  
@@ -884,6 +3658,35 @@ int Destroy_234Composition_BYTE ( unsigned int pixel_ID )
 	if ( bs_gatherv_counts_offset )
 		free ( bs_gatherv_counts_offset );
 
+	if ( MPI_TYPE_PIXEL != MPI_DATATYPE_NULL )
+		MPI_Type_free ( &MPI_TYPE_PIXEL );
+
+	// =======================================  
+	// 	Destroy lists for ROI
+	// =======================================  
+	if ( roi_list )
+		free ( roi_list );
+
+	if ( roi_segments )
+		free ( roi_segments );
+
+	roi_list = NULL;
+	roi_segments = NULL;
+
+	// =======================================  
+	// 	Destroy buffers for RLE compression
+	// =======================================  
+	if ( compress_send_buffer )
+		free ( compress_send_buffer );
+
+	if ( compress_recv_buffer )
+		free ( compress_recv_buffer );
+
+	compress_send_buffer = NULL;
+	compress_recv_buffer = NULL;
+	compress_send_size = 0;
+	compress_recv_size = 0;
+
 	return EXIT_SUCCESS;
 }
 
@@ -911,8 +3714,47 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	unsigned int counter;          // Loop counter	
 #endif
 
+	unsigned int bs_counts;	// Data counts of my composited region
+	unsigned int bs_offset;	// Offset of my composited region
+
 	BYTE* comp_image_byte;
+
+	int result;		// Written image file
+
+	_Bool use_radixk;	// Radix-k instead of Binary-Swap
 	
+	// The gathered image is lent ( See Do_234Composition_View )
+	if ( view_image != NULL ) {
+		printf( "<<< ERROR >> Release_234Composition_View must be called before the next composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	global_merge_ID = merge_ID;
+
+	// Same exchanges as the previous composition ( Persistent requests )
+	restart_exchange_schedule ( );
+
+	// Time and bytes of each stage ( See Get_234Composition_Stats )
+	begin_composition_stats ( );
+
+	// Composited region of my node ( None: Not in the last stage )
+	comp_image_byte = NULL;
+	bs_offset = 0;
+	bs_counts = 0;
+
+	use_radixk = (( bswap_radix > 2 ) && (( merge_ID == ALPHA ) || ( merge_ID == DEPTH )));
+
+	// Temporary buffer for the received pixels ( and the gathered image )
+	if ( reserve_temp_image ( pixel_ID, get_temp_image_pixels ( my_rank, nnodes, pixel_ID, merge_ID ) ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	// Exchange the ROI of every node ( Binary-Swap only )
+	if ((( merge_ID == ALPHA_ROI ) || ( merge_ID == DEPTH_ROI )) && ( is_power_of_two == true ))
+	{
+		exchange_roi ( (void *)my_image_byte, width, height, pixel_ID, MPI_COMM_234BS );
+	}
+
 	if ( is_power_of_two == true )
 	{
 		// ====================================================================
@@ -935,59 +3777,69 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			}	
 			//=========================================	
 
-			bswap_rgba_BYTE ( my_rank, nnodes, width, height, pixel_ID, \
-					  my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			if ( use_radixk == true )
+			{
+				radixk_image ( my_rank, nnodes, width, height, pixel_ID, \
+					       my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
+			else
+			{
+				bswap_rgba_BYTE ( my_rank, nnodes, width, height, pixel_ID, \
+						  my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
 
 			// ============ Final Image Gathering ==============
-			#ifdef _NOGATHER
-				// NO FINAL IMAGE GATHERING
+			begin_stats_phase ( STATS_GATHER );
 
-			#elif _GATHERV
-				// ============ (BEGIN)  MPI_Gatherv =============== 
-				bs_counts *= global_image_type; // 4, 7 or 8 BYTES
-				bs_offset *= global_image_type; // 4, 7 or 8 BYTES
+			if ( skip_final_gather == false )
+			{
+				#ifdef _NOGATHER
+					// NO FINAL IMAGE GATHERING
 
-				#ifdef _GATHER_TWICE
-					MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-					MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+				#elif _GATHERV
+					// ============ (BEGIN)  MPI_Gatherv =============== 
+					// Pixel counts and offsets ( MPI_TYPE_PIXEL )
 
-					MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-							temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-							MPI_BYTE, ROOT_NODE, MPI_COMM_234BS );
-				#else
-					counts_offset[0] = bs_counts;
-					counts_offset[1] = bs_offset;
+					#ifdef _GATHER_TWICE
+						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
 
-					MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
-							ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+								MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#else
+						counts_offset[0] = bs_counts;
+						counts_offset[1] = bs_offset;
 
-					bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-					bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-					bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
+								ROOT_NODE, MPI_COMM_234BS );
 
-					for ( counter = 0; counter < nnodes; counter++ ) {
-						*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-					}
+						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
 
-					MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-							temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-							MPI_BYTE, ROOT_NODE, MPI_COMM_234BS );
-				#endif
-			// ============== (END) MPI_Gatherv =============== 
+						for ( counter = 0; counter < nnodes; counter++ ) {
+							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+						}
 
-			#else // #ifdef _NOGATHER #elif _GATHERV
+						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+								MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#endif
+				// ============== (END) MPI_Gatherv =============== 
 
-				// ============ (BEGIN) MPI_Gather ================ 
-				bs_counts *= global_image_type; // 4, 7 or 8 BYTES
+				#else // #ifdef _NOGATHER #elif _GATHERV
 
-				// Gather the composited partial images to TEMP_IMAGE
-				// since its size is larger than initial IMAGE_BUFFER
-				MPI_Gather ( comp_image_byte, bs_counts, MPI_BYTE, \
-						 temp_image_byte_ptr, bs_counts, MPI_BYTE, ROOT_NODE, MPI_COMM_BITREV );
-				// =============== (END) MPI_Gather ===============
+					// ============ (BEGIN) MPI_Gather ================ 
+					// Gather the composited partial images to TEMP_IMAGE
+					// since its size is larger than initial IMAGE_BUFFER
+					MPI_Gather ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+							 (BYTE *)gather_destination ( temp_image_byte_ptr ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_BITREV );
+					// =============== (END) MPI_Gather ===============
 
-			#endif // ifndef _GATHERV
+				#endif // ifndef _GATHERV
+			}
 		}
 		else if (( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 ))
 		{	
@@ -1006,60 +3858,70 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			}	
 			//=========================================	
 
-			bswap_rgbaz_BYTE ( my_rank, nnodes, width, height, pixel_ID, \
+			if ( use_radixk == true )
+			{
+				radixk_image ( my_rank, nnodes, width, height, pixel_ID, \
 					       my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
+			else
+			{
+				bswap_rgbaz_BYTE ( my_rank, nnodes, width, height, pixel_ID, \
+						       my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
 
 			// ============ Final Image Gathering ==============
-			#ifdef _NOGATHER
-				// NO FINAL IMAGE GATHERING
+			begin_stats_phase ( STATS_GATHER );
 
-			#elif _GATHERV
+			if ( skip_final_gather == false )
+			{
+				#ifdef _NOGATHER
+					// NO FINAL IMAGE GATHERING
 
-				// ============ (BEGIN)  MPI_Gatherv =============== 
-				bs_counts *= global_image_type; // 8, 11 or 12 BYTES
-				bs_offset *= global_image_type; // 8, 11 or 12 BYTES
+				#elif _GATHERV
 
-				#ifdef _GATHER_TWICE
-					MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-					MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+					// ============ (BEGIN)  MPI_Gatherv =============== 
+					// Pixel counts and offsets ( MPI_TYPE_PIXEL )
 
-					MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-							temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-							MPI_BYTE, ROOT_NODE, MPI_COMM_234BS );
-				#else
-					counts_offset[0] = bs_counts;
-					counts_offset[1] = bs_offset;
+					#ifdef _GATHER_TWICE
+						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
 
-					MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
-							ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+								MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#else
+						counts_offset[0] = bs_counts;
+						counts_offset[1] = bs_offset;
 
-					bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-					bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-					bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
+								ROOT_NODE, MPI_COMM_234BS );
 
-					for (counter = 0; counter < nnodes; counter++ ) {
-						*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-					}
+						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
 
-					MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-							temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-							MPI_BYTE, ROOT_NODE, MPI_COMM_234BS );
-				#endif
-				// ============== (END) MPI_Gatherv =============== 
+						for (counter = 0; counter < nnodes; counter++ ) {
+							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+						}
 
-			#else // #elif _GATHERV
+						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+								MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#endif
+					// ============== (END) MPI_Gatherv =============== 
 
-				// ============ (BEGIN) MPI_Gather ================ 
-				bs_counts *= global_image_type; // 8, 11 or 12 BYTES
+				#else // #elif _GATHERV
 
-				// Gather the composited partial images to TEMP_IMAGE
-				// since its size is larger than initial IMAGE_BUFFER
-				MPI_Gather ( comp_image_byte, bs_counts, MPI_BYTE, \
-						 temp_image_byte_ptr, bs_counts, MPI_BYTE, ROOT_NODE, MPI_COMM_BITREV );
-				// =============== (END) MPI_Gather ===============
+					// ============ (BEGIN) MPI_Gather ================ 
+					// Gather the composited partial images to TEMP_IMAGE
+					// since its size is larger than initial IMAGE_BUFFER
+					MPI_Gather ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+							 (BYTE *)gather_destination ( temp_image_byte_ptr ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_BITREV );
+					// =============== (END) MPI_Gather ===============
 
-			#endif // #ifdef _NOGATHER
+				#endif // #ifdef _NOGATHER
+			}
 
 		}
 		else 
@@ -1071,6 +3933,8 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	}
 	else if (( is_power_of_two == false ) && ( nnodes > 4 ))
 	{
+		begin_stats_phase ( STATS_PARTIAL );
+
 		// ====================================================================
 		//	  		234 Composition
 		// ====================================================================
@@ -1118,62 +3982,72 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
 			{ 		
 
-				stage2_bswap_rgba_BYTE ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
-							 my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				if ( use_radixk == true )
+				{
+					stage2_radixk_image ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+							      my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
+				else
+				{
+					stage2_bswap_rgba_BYTE ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+								 my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
 
 				// ============ Final Image Gathering ==============
-				#ifdef _NOGATHER
-					// NO FINAL IMAGE GATHERING
-
-				#elif _GATHERV
-		
-				// ============ (BEGIN)  MPI_Gatherv =============== 
-				bs_counts *= global_image_type; // 4, 7 or 8 BYTES
-				bs_offset *= global_image_type; // 4, 7 or 8 BYTES
+				begin_stats_phase ( STATS_GATHER );
 
-					#ifdef _GATHER_TWICE
-						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-
-						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-								temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-								MPI_BYTE, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#else
-						counts_offset[0] = bs_counts;
-						counts_offset[1] = bs_offset;
-
-						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, \
-								MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-
-						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
-
-						for (counter = 0; counter < nnodes; counter++ ) {
-							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						}
+				if ( skip_final_gather == false )
+				{
+					#ifdef _NOGATHER
+						// NO FINAL IMAGE GATHERING
 
-						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-								temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, \
-								MPI_BYTE, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#endif
-				// ============== (END) MPI_Gatherv =============== 
+					#elif _GATHERV
+		
+					// ============ (BEGIN)  MPI_Gatherv =============== 
+					// Pixel counts and offsets ( MPI_TYPE_PIXEL )
+
+						#ifdef _GATHER_TWICE
+							MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+
+							MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+									(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+									MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#else
+							counts_offset[0] = bs_counts;
+							counts_offset[1] = bs_offset;
+
+							MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, \
+									MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+
+							bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+							bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+							bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+
+							for (counter = 0; counter < nnodes; counter++ ) {
+								*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+								*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							}
+
+							MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+									(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, \
+									MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#endif
+					// ============== (END) MPI_Gatherv =============== 
 	
-				#else // #elif _GATHERV
-
-					// ============ (BEGIN) MPI_Gather ================ 
-					bs_counts *= global_image_type; // 8, 11 or 12 BYTES
+					#else // #elif _GATHERV
 
-					// Gather the composited partial images to TEMP_IMAGE
-					// since its size is larger than initial IMAGE_BUFFER
-					MPI_Gather ( comp_image_byte, bs_counts, MPI_BYTE, \
-							 temp_image_byte_ptr, bs_counts, MPI_BYTE, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
-					// =============== (END) MPI_Gather ===============
+						// ============ (BEGIN) MPI_Gather ================ 
+						// Gather the composited partial images to TEMP_IMAGE
+						// since its size is larger than initial IMAGE_BUFFER
+						MPI_Gather ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								 (BYTE *)gather_destination ( temp_image_byte_ptr ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
+						// =============== (END) MPI_Gather ===============
 
-				#endif // #ifdef _NOGATHER
+					#endif // #ifdef _NOGATHER
+				}
 			}					
 		}
 		else if (( pixel_ID == ID_RGBAZ64 ) || ( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 )) 
@@ -1219,60 +4093,69 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
 			{ 		
 
-				stage2_bswap_rgbaz_BYTE ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
-							 my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				if ( use_radixk == true )
+				{
+					stage2_radixk_image ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+							      my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
+				else
+				{
+					stage2_bswap_rgbaz_BYTE ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+								 my_image_byte, &comp_image_byte, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
 
 				// ============ Final Image Gathering ==============
-				#ifdef _NOGATHER
-					// NO FINAL IMAGE GATHERING
-
-				#elif _GATHERV
-				bs_counts *= global_image_type;  // 8, 11 or 12 BYTES
-				bs_offset *= global_image_type;  // 8, 11 or 12 BYTES
-
-					#ifdef _GATHER_TWICE
-						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-
-						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-								temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, MPI_BYTE, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#else
-						counts_offset[0] = bs_counts;
-						counts_offset[1] = bs_offset;
-
-						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-
-						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
-
-						for (counter = 0; counter < nnodes; counter++ ) {
-							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						}
-
-						MPI_Gatherv ( comp_image_byte, bs_counts, MPI_BYTE, \
-								temp_image_byte_ptr, bs_gatherv_counts, bs_gatherv_offset, MPI_BYTE, \
-								ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#endif
-				// ============== (END) MPI_Gatherv =============== 
+				begin_stats_phase ( STATS_GATHER );
+
+				if ( skip_final_gather == false )
+				{
+					#ifdef _NOGATHER
+						// NO FINAL IMAGE GATHERING
+
+					#elif _GATHERV
+
+						#ifdef _GATHER_TWICE
+							MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+
+							MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+									(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#else
+							counts_offset[0] = bs_counts;
+							counts_offset[1] = bs_offset;
+
+							MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+
+							bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+							bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+							bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+
+							for (counter = 0; counter < nnodes; counter++ ) {
+								*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+								*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							}
+
+							MPI_Gatherv ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+									(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, \
+									ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#endif
+					// ============== (END) MPI_Gatherv =============== 
 	
-				#else // #elif _GATHERV
-
-					// ============ (BEGIN) MPI_Gather ================ 
-					bs_counts *= global_image_type; // 8, 11 or 12 BYTES
+					#else // #elif _GATHERV
 
-					// Gather the composited partial images to TEMP_IMAGE
-					// since its size is larger than initial IMAGE_BUFFER
-					MPI_Gather ( comp_image_byte, bs_counts, MPI_BYTE, \
-							temp_image_byte_ptr, bs_counts, MPI_BYTE, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
-					// =============== (END) MPI_Gather ===============
+						// ============ (BEGIN) MPI_Gather ================ 
+						// Gather the composited partial images to TEMP_IMAGE
+						// since its size is larger than initial IMAGE_BUFFER
+						MPI_Gather ( comp_image_byte, bs_counts, MPI_TYPE_PIXEL, \
+								(BYTE *)gather_destination ( temp_image_byte_ptr ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
+						// =============== (END) MPI_Gather ===============
 
-				#endif // #ifdef _NOGATHER
+					#endif // #ifdef _NOGATHER
+				}
 			}					
 		}
 		else 
@@ -1286,6 +4169,7 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		// ====================================================================
 		//	  		3-node Composition
 		// ====================================================================
+		begin_stats_phase ( STATS_PARTIAL );
 		switch ( pixel_ID ) {
 			case ID_RGBA32 : dsend3_rgba_BYTE ( my_rank, nnodes, width, height, RGBA32, my_image_byte, temp_image_rgba32, MPI_COMM_234BS );
 					   break;
@@ -1311,6 +4195,19 @@ int  Do_234Composition_Core_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			printf("Nothing to do with only ONE IMAGE !!! \n");
 		}
 	}
+
+	// Composited region of my node
+	set_composited_region ( my_rank, nnodes, width, height, my_image_byte, comp_image_byte, bs_offset, bs_counts );
+
+	// Write my composited region instead of gathering it
+	if ( output_file_name != NULL ) {
+		begin_stats_phase ( STATS_GATHER );
+		result = write_image_file ( my_rank, width, height, pixel_ID, MPI_COMM_234BS );
+		end_composition_stats ( );
+		return result;
+	}
+
+	end_composition_stats ( );
 	return EXIT_SUCCESS;
 }
 
@@ -1336,81 +4233,34 @@ int Init_234Composition_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 	// ID_RGBAZ160: RGBAZ160-bit	
 
 	// ====================================================================
-	unsigned int temp_buffer_size;
-	unsigned int i;
-
-	global_num_pixels = width * height;
-	global_add_pixels = 0;
 
-	#if !defined _GATHERV // MPI_GATHER
-		if ( check_pow2 ( nnodes ) == false ) { // Non-power-of-two number of nodes
-			i = get_nearest_pow2 ( nnodes );
-		}
-		else {
-			i = nnodes;
-		}
-		
-		global_mod_pixels = global_num_pixels % i;
-	
-		if ( global_mod_pixels != 0 ) 
-		{
-			global_add_pixels = i - global_mod_pixels;
-			global_num_pixels += global_add_pixels;
-		}
-	#endif
+	set_global_num_pixels ( nnodes, (size_t)width * height );
 
-	// Temporary Buffer Size for storing 
-	// half of the image image (Binary-Swap)
-	temp_buffer_size = 0;
-	if ( global_num_pixels <= MPIXELS_8 ) 
-	{
-		temp_buffer_size = MPIXELS_8;
-	}
-	else if ( global_num_pixels <= MPIXELS_16 ) 
-	{
-		temp_buffer_size = MPIXELS_16;
-	}
-	else if ( global_num_pixels <= MPIXELS_32 ) 
-	{
-		temp_buffer_size = MPIXELS_32;
-	}
-	else if ( global_num_pixels <= MPIXELS_64 ) 
-	{
-		temp_buffer_size = MPIXELS_64;
-	}
-	else if ( global_num_pixels <= MPIXELS_128 ) 
-	{
-		temp_buffer_size = MPIXELS_128;
-	}
+	// Select the compositing routines (Scalar or SIMD)
+	Select_AlphaBlend_SIMD( );
 
 	// =======================================  
 	// 	Prepare temporay image buffer
 	// =======================================  	
-	if ( pixel_ID == ID_RGBA128 ) 
+	if (( pixel_ID == ID_RGBA128 ) || ( pixel_ID == ID_RGBA128_PLANAR )) 
 	{
 		global_image_type = RGBA128;
 		global_image_size = global_num_pixels * RGBA; // 4 elements RGBA		
-		temp_buffer_size *= RGBA; // 4 elements RGBA		
-
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgba128 = (float *)allocate_float_memory_region ( 
-										(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
 	}
-	else if ( pixel_ID == ID_RGBAZ160 ) 
+	else if (( pixel_ID == ID_RGBAZ160 ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) 
 	{
 		global_image_type = RGBAZ160;
 		global_image_size = global_num_pixels * RGBAZ;	// 5 elements RGBAZ	
-		temp_buffer_size *= RGBAZ; // 5 elements RGBAZ		
 
-		// Temporary Image Buffer ( Partial images for Send and Receive stages)
-		if ( ( temp_image_rgbaz160 = (float *)allocate_float_memory_region ( 
-										(unsigned int)( temp_buffer_size ))) == NULL ) {
-			MPI_Finalize();
-			return EXIT_FAILURE;
-		} ;
+		// Depth plane ( Do_234ZComposition )
+		if ( pixel_ID == ID_RGBAZ160_PLANAR )
+		{
+			if ( ( planar_depth_image = (float *)allocate_float_memory_region ( 
+											(size_t)width * height )) == NULL ) {
+				MPI_Finalize();
+				return EXIT_FAILURE;
+			} ;
+		}
 	}
 	else 
 	{
@@ -1419,149 +4269,62 @@ int Init_234Composition_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 		return EXIT_FAILURE;
 	}
 
-	// ====================================================================
-
-	// =======================================  
-	// 	Prepare lists for MPI_Gatherv
-	// =======================================  
-	if ( ( bs_gatherv_offset = (int *)allocate_int_memory_region ( 
-									(unsigned int)( nnodes ))) == NULL ) {
-		MPI_Finalize();
-		return EXIT_FAILURE;
-	} ;
-
-	if ( ( bs_gatherv_counts = (int *)allocate_int_memory_region ( 
-									(unsigned int)( nnodes ))) == NULL ) {
-		MPI_Finalize();
-		return EXIT_FAILURE;
-	} ;
-
-	if ( ( bs_gatherv_counts_offset = (int *)allocate_int_memory_region ( 
-									(unsigned int)( 2 * nnodes ))) == NULL ) {
+	// Temporary Image Buffer ( Partial images for Send and Receive stages)
+	// Sized for Binary-Swap, grows when needed ( See reserve_temp_image )
+	if ( reserve_temp_image ( pixel_ID, get_temp_image_pixels ( my_rank, nnodes, pixel_ID, ALPHA ) ) == EXIT_FAILURE ) {
 		MPI_Finalize();
 		return EXIT_FAILURE;
-	} ;
-
-	// ====================================================================
-	// ====================================================================
-	if ( check_pow2 ( nnodes ) == true ) 
- 	{
-		// =======================================  
-		// 	 TRADITIONAL BINARY-SWAP
-		// =======================================  
-
-		is_power_of_two = true; 	// Power-of-two number of nodes 
-
-		// =======================================  
-		// 	Prepare bit-reverse order communicator
-		//  for MPI_Gather without reconstruction
-		// =======================================  
-
-		bitrev_my_rank  = bitrevorder ( my_rank, nnodes ); // Get new Rank (Bit-reversed order)
-		bitrev_my_group = 1; // Color for new MPI communicator 
-							 // 1 unique color = 1 group of communicator		
-
-		// Generate a new MPI communicator with bit-reversed ranks
-		MPI_Comm_split ( MPI_COMM_WORLD, bitrev_my_group, bitrev_my_rank, &MPI_COMM_BITREV ); 
-		MPI_Comm_rank  ( MPI_COMM_BITREV, (int *)&bitrev_my_rank );	// New Rank inside MPI_COMM_BITREV
-		MPI_Comm_size  ( MPI_COMM_BITREV, (int *)&bitrev_nnodes  );	// NUmber of nodes in MPI_COMM_BITREV
 	}
-	else  
-	{
-		// =======================================  
-		// 	2-3-4 DECOMPOSIITON
-		// =======================================  
-		is_power_of_two = false; 	// Non-power-of-two number of nodes 
-
-		// GROUPS of (2 and 3) or (3 and 4)
-		//
-		// 2-3 : 2^n < m < 2^n + 2^(n-1)
-		// 3-3 : 2^n + 2^(n-1)
-		// 3-4 : 2^n + 2^(n-1) < m < 2^(n+1)
-		//
-		// Example: n = 2
-		//	        2-3: m = 5 (4 < m < 6)
-		//			3-3: m = 6
-		//			3-4: m = 7 (6 < m < 8)
-
-		// =======================================  
-		// 	Number of nodes != Power-of-two (2^n)
-		// =======================================  
-
-		// Obtain the nearest power of two, that is,  2^(n+1) 
-		// Should be smaller than number of nodes
-		near_pow2 = get_nearest_pow2 ( nnodes ); 
-										
-		// Obtain the value of 2^(n) 				 
-		ngroups_234 = near_pow2 * 0.5;  
 
-		base_234 = floor ( nnodes / ngroups_234 );
-		over_234 = nnodes % ngroups_234;			
-
-		// Calculate threshold for choosing 2-3 or 3-4
-		// 2^(n) + 2^(n-1) 
- 		threshold_234 = nnodes - ( over_234 * ( base_234 + 1 ) ); 
-
-		if ( my_rank < threshold_234 ) 
-		{
-			// 2-3 (GROUPS of 2 and 3)
-			my_group_234 = floor ( my_rank / base_234 ); 		
-		} 
-		else  
-		{
-			// 3-4 (GROUPS of 3 and 4)
-			my_group_234 = ( ngroups_234 - over_234 ) +	(( my_rank - threshold_234 ) / ( base_234 + 1 ));
-		}
+	// One pixel as MPI datatype: the final image gathering uses 
+	// pixel counts and offsets, which stay within the int range 
+	// of MPI_Gather and MPI_Gatherv for large images
+	MPI_Type_contiguous ( (int)global_image_type, MPI_BYTE, &MPI_TYPE_PIXEL );
+	MPI_Type_commit ( &MPI_TYPE_PIXEL );
 
-		// Generate new MPI communciators for each of the 2-3-4 groups
-		MPI_Comm_split ( MPI_COMM_WORLD, my_group_234, my_rank, &MPI_COMM_234 ); 
-		MPI_Comm_rank  ( MPI_COMM_234, &my_rank_234 ); 
-		MPI_Comm_size  ( MPI_COMM_234, &nnodes_234 ); 
+	// ====================================================================
 
-		// =======================================
-		// 			2nd stage Binary-Swap
-		// =======================================
+	// =======================================  
+	// 	Prepare lists for MPI_Gatherv
+	// =======================================  
+	if ( ( bs_gatherv_offset = (int *)allocate_int_memory_region ( 
+									(unsigned int)( nnodes ))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-		// List of nodes (2nd stage Binary-Swap) 
-		// Local root node (n) and its neighbor (n+1)
-		group_bswap = (int *)malloc( sizeof(int) * ngroups_234 * 2 );
-		memset( group_bswap, 0x00, sizeof(int) * ngroups_234 * 2 );
-		group_bswap_ptr = group_bswap;
+	if ( ( bs_gatherv_counts = (int *)allocate_int_memory_region ( 
+									(unsigned int)( nnodes ))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-		// Smaller than 2-3-4 decomposition threshold
-		// 2 of 2-3 ; 3 of 3-3 ; 3 of 3-4
-		for ( i = 0; i < ( ngroups_234 - over_234 ); i++ )
-		{
-			*group_bswap_ptr++ = (int)(  i * base_234 );
-			*group_bswap_ptr++ = (int)(( i * base_234 ) + 1 );
-		}
-	
-		// Larger than 2-3-4 decomposition threshold  
-		// 3 of 2-3 ; 4 of 3-4
-		for ( i = 0; i < over_234; i++ )
-		{
-			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ));
-			*group_bswap_ptr++ = (int)(( ngroups_234 - over_234 ) * base_234 ) + ( i * ( base_234 + 1 ) + 1 );
-		}
+	if ( ( bs_gatherv_counts_offset = (int *)allocate_int_memory_region ( 
+									(unsigned int)( 2 * nnodes ))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-		// Generate new MPI communciator for 2nd stage Binary-Swap
-		MPI_Comm_group ( MPI_COMM_WORLD, &MPI_GROUP_WORLD ); 
-		MPI_Group_incl ( MPI_GROUP_WORLD, ngroups_234 * 2, group_bswap, &MPI_GROUP_STAGE2_BSWAP ); 
-		MPI_Comm_create( MPI_COMM_WORLD, MPI_GROUP_STAGE2_BSWAP, &MPI_COMM_STAGE2_BSWAP ); 
-		MPI_Group_rank ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_my_rank ); 
-		MPI_Group_size ( MPI_GROUP_STAGE2_BSWAP, &stage2_bswap_nnodes ); 
+	// =======================================  
+	// 	Prepare lists for ROI
+	// =======================================  
+	if ( ( roi_list = (int *)allocate_int_memory_region ( 
+		(unsigned int)( 4 * nnodes ))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-		if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
-		{ 	
-			bitrev_my_rank  = bitrevorder ( stage2_bswap_my_rank, stage2_bswap_nnodes ); // Get new Rank (Bit-reversed order)
-			bitrev_my_group = 1; 	// Color for new MPI communicator 
-						// 1 unique color = 1 group of communicator		
+	if ( ( roi_segments = (unsigned int *)allocate_int_memory_region ( 
+		(unsigned int)( 2 * ( height + 1 )))) == NULL ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
+	} ;
 
-			// Generate a new MPI communicator with bit-reversed ranks
-			MPI_Comm_split ( MPI_COMM_STAGE2_BSWAP, bitrev_my_group, bitrev_my_rank, &MPI_COMM_STAGE2_BITREV ); 
-			MPI_Comm_rank  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_my_rank );	// New Rank inside MPI_COMM_BITREV
-			MPI_Comm_size  ( MPI_COMM_STAGE2_BITREV, &stage2_bitrev_nnodes  );	// NUmber of nodes in MPI_COMM_BITREV
-		}
+	// Derived communicators (Binary-Swap or 2-3-4 Decomposition)
+	// Reused from the previous Init_234Composition when possible
+	if ( prepare_234_communicators ( my_rank, nnodes, MPI_COMM_234BASE ) == EXIT_FAILURE ) {
+		MPI_Finalize();
+		return EXIT_FAILURE;
 	}
 	return EXIT_SUCCESS;
 }
@@ -1586,20 +4349,32 @@ int Destroy_234Composition_FLOAT ( unsigned int pixel_ID )
 	// ID_RGBAZ160: RGBAZ 160-bit	
 	// ====================================================================
 
+	// Persistent requests on the image buffers
+	free_exchange_schedule ( );
+
 	// =======================================  
 	// 		Destroy temporay image buffer
 	// =======================================  	
-	if ( pixel_ID == ID_RGBA128 ) 
+	if (( pixel_ID == ID_RGBA128 ) || ( pixel_ID == ID_RGBA128_PLANAR )) 
 	{
-		if ( temp_image_rgba128 )
-			free ( temp_image_rgba128 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgba128, \
+					       temp_image_pixels * global_image_type );
 	}
-	else if ( pixel_ID == ID_RGBAZ160 ) 
+	else if (( pixel_ID == ID_RGBAZ160 ) || ( pixel_ID == ID_RGBAZ160_PLANAR )) 
 	{
-		if ( temp_image_rgbaz160 )
-			free ( temp_image_rgbaz160 );
+		release_pooled_memory_region ( memory_pool, temp_image_rgbaz160, \
+					       temp_image_pixels * global_image_type );
+
+		if ( planar_depth_image )
+			free ( planar_depth_image );
+
+		planar_depth_image = NULL;
 	}
 
+	temp_image_rgba128  = NULL;
+	temp_image_rgbaz160 = NULL;
+	temp_image_pixels   = 0;
+
 	// =======================================  
 	// 		Destroy lists for MPI_Gatherv
 	// =======================================  
@@ -1612,6 +4387,35 @@ int Destroy_234Composition_FLOAT ( unsigned int pixel_ID )
 	if ( bs_gatherv_counts_offset )
 		free ( bs_gatherv_counts_offset );
 
+	if ( MPI_TYPE_PIXEL != MPI_DATATYPE_NULL )
+		MPI_Type_free ( &MPI_TYPE_PIXEL );
+
+	// =======================================  
+	// 	Destroy lists for ROI
+	// =======================================  
+	if ( roi_list )
+		free ( roi_list );
+
+	if ( roi_segments )
+		free ( roi_segments );
+
+	roi_list = NULL;
+	roi_segments = NULL;
+
+	// =======================================  
+	// 	Destroy buffers for RLE compression
+	// =======================================  
+	if ( compress_send_buffer )
+		free ( compress_send_buffer );
+
+	if ( compress_recv_buffer )
+		free ( compress_recv_buffer );
+
+	compress_send_buffer = NULL;
+	compress_recv_buffer = NULL;
+	compress_send_size = 0;
+	compress_recv_size = 0;
+
 	return EXIT_SUCCESS;
 }
 
@@ -1639,15 +4443,47 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 	unsigned int counter; // Loop counter
 #endif
 
+	unsigned int bs_counts;	// Data counts of my composited region
+	unsigned int bs_offset;	// Offset of my composited region
+
 	float *comp_image_float; 
+
+	int result;		// Written image file
+
+	_Bool use_radixk;	// Radix-k instead of Binary-Swap
 	
-	if ( (merge_ID == DEPTH_ROI) || (merge_ID == DEPTH_COMPRESS) ) 
-	{
-		printf("Unsupported merging option \n");	
-		MPI_Finalize();
+	// The gathered image is lent ( See Do_234Composition_View )
+	if ( view_image != NULL ) {
+		printf( "<<< ERROR >> Release_234Composition_View must be called before the next composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	global_merge_ID = merge_ID;
+
+	// Same exchanges as the previous composition ( Persistent requests )
+	restart_exchange_schedule ( );
+
+	// Time and bytes of each stage ( See Get_234Composition_Stats )
+	begin_composition_stats ( );
+
+	// Composited region of my node ( None: Not in the last stage )
+	comp_image_float = NULL;
+	bs_offset = 0;
+	bs_counts = 0;
+
+	use_radixk = (( bswap_radix > 2 ) && (( merge_ID == ALPHA ) || ( merge_ID == DEPTH )));
+
+	// Temporary buffer for the received pixels ( and the gathered image )
+	if ( reserve_temp_image ( pixel_ID, get_temp_image_pixels ( my_rank, nnodes, pixel_ID, merge_ID ) ) == EXIT_FAILURE ) {
 		return EXIT_FAILURE;
 	}
 
+	// Exchange the ROI of every node ( Binary-Swap only )
+	if ((( merge_ID == ALPHA_ROI ) || ( merge_ID == DEPTH_ROI )) && ( is_power_of_two == true ))
+	{
+		exchange_roi ( (void *)my_image_float, width, height, pixel_ID, MPI_COMM_234BS );
+	}
+
 	if ( is_power_of_two == true )
 	{
 		// ====================================================================
@@ -1655,109 +4491,129 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 		// ====================================================================
 		if ( pixel_ID == ID_RGBA128 ) 
 		{	
-			bswap_rgba128 ( my_rank, nnodes, width, height, global_image_type, \
-					my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			if ( use_radixk == true )
+			{
+				radixk_image ( my_rank, nnodes, width, height, pixel_ID, \
+					       (BYTE *)my_image_float, (BYTE **)&comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
+			else
+			{
+				bswap_rgba128 ( my_rank, nnodes, width, height, global_image_type, \
+						my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
 
 			// ============ Final Image Gathering ==============
-			#ifdef _NOGATHER
-				// =========================
-				// NO FINAL IMAGE GATHERING
-				// =========================
-			#elif _GATHERV
-			// ============ (BEGIN)  MPI_Gatherv =============== 
-			bs_counts *= RGBA; // 4 elements
-			bs_offset *= RGBA; // 4 elements
-
-				#ifdef _GATHER_TWICE
-					MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-					MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-
-					MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgba128, \
-								  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_234BS );
+			begin_stats_phase ( STATS_GATHER );
+
+			if ( skip_final_gather == false )
+			{
+				#ifdef _NOGATHER
+					// =========================
+					// NO FINAL IMAGE GATHERING
+					// =========================
+				#elif _GATHERV
+				// ============ (BEGIN)  MPI_Gatherv =============== 
+				// Pixel counts and offsets ( MPI_TYPE_PIXEL )
+
+					#ifdef _GATHER_TWICE
+						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+
+						MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgba128 ), \
+									  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#else
+						counts_offset[0] = (unsigned int)bs_counts;
+						counts_offset[1] = (unsigned int)bs_offset;
+
+						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+
+						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+
+						for ( counter = 0; counter < nnodes; counter++ ) {
+							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+						}
+
+						MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgba128 ), \
+							    bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#endif
+				// ============== (END) MPI_Gatherv =============== 
+
 				#else
-					counts_offset[0] = (unsigned int)bs_counts;
-					counts_offset[1] = (unsigned int)bs_offset;
-
-					MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-
-					bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-					bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-					bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
-
-					for ( counter = 0; counter < nnodes; counter++ ) {
-						*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-					}
-
-					MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgba128, \
-						    bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_234BS );
-				#endif
-			// ============== (END) MPI_Gatherv =============== 
-
-			#else
-			// ============ (BEGIN) MPI_Gather ================ 
-			bs_counts *= RGBA; // 4 elements
-
-			// Gather the composited partial images to temp_image_rgba128
-			// since its size is larger than  my_image_float
-			MPI_Gather ( comp_image_float, bs_counts, MPI_FLOAT, \
-							  temp_image_rgba128, bs_counts, MPI_FLOAT, ROOT_NODE, MPI_COMM_BITREV );
-			// =============== (END) MPI_Gather ===============
+				// ============ (BEGIN) MPI_Gather ================ 
+				// Gather the composited partial images to temp_image_rgba128
+				// since its size is larger than  my_image_float
+				MPI_Gather ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, \
+								  gather_destination ( temp_image_rgba128 ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_BITREV );
+				// =============== (END) MPI_Gather ===============
 			
-			#endif // ifndef _GATHERV
+				#endif // ifndef _GATHERV
+			}
 		}
 		else if ( pixel_ID == ID_RGBAZ160 ) 
 		{
-			bswap_rgbaz160 ( my_rank, nnodes, width, height, global_image_type, \
-					 my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			if ( use_radixk == true )
+			{
+				radixk_image ( my_rank, nnodes, width, height, pixel_ID, \
+					       (BYTE *)my_image_float, (BYTE **)&comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
+			else
+			{
+				bswap_rgbaz160 ( my_rank, nnodes, width, height, global_image_type, \
+						 my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+			}
 
 			// ============ Final Image Gathering ==============
-			#ifdef _NOGATHER
-				// NO FINAL IMAGE GATHERING
+			begin_stats_phase ( STATS_GATHER );
 
-			#elif _GATHERV
-			// ============ (BEGIN)  MPI_Gatherv =============== 
-			bs_counts *= RGBAZ; // 5 elements
-			bs_offset *= RGBAZ; // 5 elements
+			if ( skip_final_gather == false )
+			{
+				#ifdef _NOGATHER
+					// NO FINAL IMAGE GATHERING
 
-				#ifdef _GATHER_TWICE
-					MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
-					MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+				#elif _GATHERV
+				// ============ (BEGIN)  MPI_Gatherv =============== 
+				// Pixel counts and offsets ( MPI_TYPE_PIXEL )
 
-					MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgbaz160, \
-								  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_234BS );
-				#else
-					counts_offset[0] = bs_counts;
-					counts_offset[1] = bs_offset;
+					#ifdef _GATHER_TWICE
+						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
 
-					MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
+						MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgbaz160 ), \
+									  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#else
+						counts_offset[0] = bs_counts;
+						counts_offset[1] = bs_offset;
 
-					bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-					bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-					bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_234BS );
 
-					for (counter = 0; counter < nnodes; counter++ ) {
-						*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-					}
+						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
 
-					MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgbaz160, \
-								  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_234BS );
-				#endif
-			// ============== (END) MPI_Gatherv =============== 
+						for (counter = 0; counter < nnodes; counter++ ) {
+							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+						}
 
-			#else
-			// ============ (BEGIN) MPI_Gather ================ 
-			bs_counts *= RGBAZ; // 5 elements
+						MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgbaz160 ), \
+									  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_234BS );
+					#endif
+				// ============== (END) MPI_Gatherv =============== 
 
-			// Gather the composited partial images to TEMP_IMAGE
-			// since its size is larger than initial IMAGE_BUFFER
-			MPI_Gather ( comp_image_float, bs_counts, MPI_FLOAT, \
-						 temp_image_rgbaz160, bs_counts, MPI_FLOAT, ROOT_NODE, MPI_COMM_BITREV );
+				#else
+				// ============ (BEGIN) MPI_Gather ================ 
+				// Gather the composited partial images to TEMP_IMAGE
+				// since its size is larger than initial IMAGE_BUFFER
+				MPI_Gather ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, \
+							 gather_destination ( temp_image_rgbaz160 ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_BITREV );
 
-			// =============== (END) MPI_Gather ===============
+				// =============== (END) MPI_Gather ===============
 
-			#endif // ifndef _GATHERV
+				#endif // ifndef _GATHERV
+			}
 		}
 		else 
 		{
@@ -1767,6 +4623,8 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 	}
 	else if (( is_power_of_two == false ) && ( nnodes > 4 ))
 	{
+		begin_stats_phase ( STATS_PARTIAL );
+
 		// ====================================================================
 		//				  		234 Composition
 		// ====================================================================
@@ -1797,57 +4655,67 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 			// ================= Stage 2 Binary-Swap ================== 
 			if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
 			{ 		
-				stage2_bswap_rgba128 ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, global_image_type, \
-									   my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				if ( use_radixk == true )
+				{
+					stage2_radixk_image ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+							      (BYTE *)my_image_float, (BYTE **)&comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
+				else
+				{
+					stage2_bswap_rgba128 ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, global_image_type, \
+										   my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
 
 				// ============ Final Image Gathering ==============
-				#ifdef _NOGATHER
-					// NO FINAL IMAGE GATHERING
+				begin_stats_phase ( STATS_GATHER );
 
-				#elif _GATHERV
+				if ( skip_final_gather == false )
+				{
+					#ifdef _NOGATHER
+						// NO FINAL IMAGE GATHERING
 
-				// ============ (BEGIN)  MPI_Gatherv =============== 
-				bs_counts *= RGBA; // 4 elements
-				bs_offset *= RGBA; // 4 elements
+					#elif _GATHERV
 
-					#ifdef _GATHER_TWICE
-						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+					// ============ (BEGIN)  MPI_Gatherv =============== 
+					// Pixel counts and offsets ( MPI_TYPE_PIXEL )
 
-						MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgba128, \
-									  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#else
-						counts_offset[0] = bs_counts;
-						counts_offset[1] = bs_offset;
+						#ifdef _GATHER_TWICE
+							MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
 
-						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgba128 ), \
+										  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#else
+							counts_offset[0] = bs_counts;
+							counts_offset[1] = bs_offset;
 
-						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+							MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
 
-						for (counter = 0; counter < nnodes; counter++ ) {
-							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						}
+							bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+							bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+							bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
 
-						MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgba128, \
-									  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#endif
-				// ============== (END) MPI_Gatherv =============== 
+							for (counter = 0; counter < nnodes; counter++ ) {
+								*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+								*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							}
 
-				#else
-				// ============ (BEGIN) MPI_Gather ================ 
-				bs_counts *= RGBA; // 4 elements
+							MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgba128 ), \
+										  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#endif
+					// ============== (END) MPI_Gatherv =============== 
 
-				// Gather the composited partial images to TEMP_IMAGE
-				// since its size is larger than initial IMAGE_BUFFER
-				MPI_Gather ( comp_image_float, bs_counts, MPI_FLOAT, \
-							 temp_image_rgba128, bs_counts, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
+					#else
+					// ============ (BEGIN) MPI_Gather ================ 
+					// Gather the composited partial images to TEMP_IMAGE
+					// since its size is larger than initial IMAGE_BUFFER
+					MPI_Gather ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, \
+								 gather_destination ( temp_image_rgba128 ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
 
-				// =============== (END) MPI_Gather ===============
+					// =============== (END) MPI_Gather ===============
 
-				#endif
+					#endif
+				}
 			}					
 		}
 		else if ( pixel_ID == ID_RGBAZ160 ) 
@@ -1878,55 +4746,65 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 			if (( stage2_bswap_my_rank >= 0 ) && ( stage2_bswap_my_rank < stage2_bswap_nnodes)) 
 			{ 		
 
-				stage2_bswap_rgbaz160 ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, global_image_type, \
-									    my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				if ( use_radixk == true )
+				{
+					stage2_radixk_image ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, pixel_ID, \
+							      (BYTE *)my_image_float, (BYTE **)&comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
+				else
+				{
+					stage2_bswap_rgbaz160 ( stage2_bswap_my_rank, stage2_bswap_nnodes, width, height, global_image_type, \
+										    my_image_float, &comp_image_float, &bs_offset, &bs_counts, MPI_COMM_STAGE2_BSWAP );
+				}
 
 				// ============ Final Image Gathering ==============
-				#ifdef _NOGATHER
-					// NO FINAL IMAGE GATHERING
+				begin_stats_phase ( STATS_GATHER );
 
-				#elif _GATHERV
+				if ( skip_final_gather == false )
+				{
+					#ifdef _NOGATHER
+						// NO FINAL IMAGE GATHERING
 
-				// ============ (BEGIN)  MPI_Gatherv =============== 
-				bs_counts *= RGBAZ; // 5 elements
-				bs_offset *= RGBAZ; // 5 elements
+					#elif _GATHERV
 
-					#ifdef _GATHER_TWICE
-						MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-						MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+					// ============ (BEGIN)  MPI_Gatherv =============== 
+					// Pixel counts and offsets ( MPI_TYPE_PIXEL )
 
-						MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgbaz160, \
-									  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#else
-						counts_offset[0] = bs_counts;
-						counts_offset[1] = bs_offset;
+						#ifdef _GATHER_TWICE
+							MPI_Gather ( (void *)&bs_offset, 1, MPI_INT, bs_gatherv_offset, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gather ( (void *)&bs_counts, 1, MPI_INT, bs_gatherv_counts, 1, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
 
-						MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+							MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgbaz160 ), \
+										  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#else
+							counts_offset[0] = bs_counts;
+							counts_offset[1] = bs_offset;
 
-						bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
-						bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
-						bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
+							MPI_Gather( (unsigned int *)counts_offset, 2, MPI_INT, bs_gatherv_counts_offset, 2, MPI_INT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
 
-						for (counter = 0; counter < nnodes; counter++ ) {
-							*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-							*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
-						}
+							bs_gatherv_counts_offset_ptr = (int *)bs_gatherv_counts_offset;
+							bs_gatherv_counts_ptr = (int *)bs_gatherv_counts;
+							bs_gatherv_offset_ptr = (int *)bs_gatherv_offset;
 
-						MPI_Gatherv ( comp_image_float, bs_counts, MPI_FLOAT, temp_image_rgbaz160, \
-									  bs_gatherv_counts, bs_gatherv_offset, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
-					#endif
-				// ============== (END) MPI_Gatherv =============== 
+							for (counter = 0; counter < nnodes; counter++ ) {
+								*bs_gatherv_counts_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+								*bs_gatherv_offset_ptr++ = (int)*bs_gatherv_counts_offset_ptr++;
+							}
 
-				#else
-				// ============ (BEGIN) MPI_Gather ================ 
-				bs_counts *= RGBAZ; // 5 elements
+							MPI_Gatherv ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, gather_destination ( temp_image_rgbaz160 ), \
+										  bs_gatherv_counts, bs_gatherv_offset, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BSWAP );
+						#endif
+					// ============== (END) MPI_Gatherv =============== 
 
-				// Gather the composited partial images to TEMP_IMAGE
-				// since its size is larger than initial IMAGE_BUFFER
-				MPI_Gather ( comp_image_float, bs_counts, MPI_FLOAT, \
-							 temp_image_rgbaz160, bs_counts, MPI_FLOAT, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
-				// =============== (END) MPI_Gather ===============
-				#endif
+					#else
+					// ============ (BEGIN) MPI_Gather ================ 
+					// Gather the composited partial images to TEMP_IMAGE
+					// since its size is larger than initial IMAGE_BUFFER
+					MPI_Gather ( comp_image_float, bs_counts, MPI_TYPE_PIXEL, \
+								 gather_destination ( temp_image_rgbaz160 ), bs_counts, MPI_TYPE_PIXEL, ROOT_NODE, MPI_COMM_STAGE2_BITREV );
+					// =============== (END) MPI_Gather ===============
+					#endif
+				}
 			}					
 		}
 	}
@@ -1936,6 +4814,7 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 		// ====================================================================
 		//		  		3-node Composition
 		// ====================================================================
+		begin_stats_phase ( STATS_PARTIAL );
 		if ( pixel_ID == ID_RGBA128 ) 
 		{
 			dsend3_rgba128 ( my_rank, nnodes, width, height, RGBA128, my_image_float, temp_image_rgba128, MPI_COMM_234BS );
@@ -1958,6 +4837,111 @@ int  Do_234Composition_Core_FLOAT ( unsigned int my_rank, unsigned int nnodes, \
 		}
 	}
 
+	// Composited region of my node
+	set_composited_region ( my_rank, nnodes, width, height, my_image_float, comp_image_float, bs_offset, bs_counts );
+
+	// Write my composited region instead of gathering it
+	if ( output_file_name != NULL ) {
+		begin_stats_phase ( STATS_GATHER );
+		result = write_image_file ( my_rank, width, height, pixel_ID, MPI_COMM_234BS );
+		end_composition_stats ( );
+		return result;
+	}
+
+	end_composition_stats ( );
 	return EXIT_SUCCESS;
 }
 
+/*========================================================*/
+/**
+ *  @brief Do 234 Composition 
+ *		   (Planar Float image: RGBA128, RGBAZ160)
+ *         The image is stored as separate R, G, B, A (and Z) 
+ *         planes of width * height floats. The composited 
+ *         planes are gathered to temp_image_rgba128 or
+ *         temp_image_rgbaz160 on the ROOT_NODE.
+ *
+ *  @param  my_rank        [in]  MPI rank number
+ *  @param  nnodes         [in]  MPI number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  pixel_ID       [in]  Pixel type
+ *  @param  my_depth_plane [in,out]  Z plane (NULL: Z plane follows the A plane)
+ *  @param  my_image_float [in,out]  Input and Blended Image planes
+ *  @param  MPI_COMM_234BS [in]  MPI Communicator
+ */
+/*========================================================*/
+int  Do_234Composition_Core_PLANAR ( unsigned int my_rank, unsigned int nnodes, \
+				     unsigned int width, unsigned int height, unsigned int pixel_ID, \
+				     float *my_depth_plane, float *my_image_float, MPI_Comm MPI_COMM_234BS )
+{
+	unsigned int k;
+	unsigned int num_planes;
+	size_t image_size;
+
+	unsigned int bs_counts;	// Pixel counts of my composited region
+	unsigned int bs_offset;	// Offset of my composited region
+
+	float* temp_image_float;
+
+	// The gathered image is lent ( See Do_234Composition_View )
+	if ( view_image != NULL ) {
+		printf( "<<< ERROR >> Release_234Composition_View must be called before the next composition \n" );
+		return EXIT_FAILURE;
+	}
+
+	image_size = (size_t)width * height;
+
+	// Time and bytes of each stage ( See Get_234Composition_Stats )
+	begin_composition_stats ( );
+
+	// Temporary buffer for the received planes ( and the gathered image )
+	if ( reserve_temp_image ( pixel_ID, get_temp_image_pixels ( my_rank, nnodes, pixel_ID, ALPHA ) ) == EXIT_FAILURE ) {
+		return EXIT_FAILURE;
+	}
+
+	if ( pixel_ID == ID_RGBA128_PLANAR ) 
+	{
+		num_planes       = RGBA;
+		temp_image_float = temp_image_rgba128;
+	}
+	else if ( pixel_ID == ID_RGBAZ160_PLANAR ) 
+	{
+		num_planes       = RGBAZ;
+		temp_image_float = temp_image_rgbaz160;
+	}
+	else 
+	{
+		printf ("MPI Rank [%d of %d]: Undefined Pixel ID !!! \n", my_rank, nnodes );
+		return EXIT_FAILURE;
+	}
+
+	for ( k = 0; k < num_planes; k++ )
+	{
+		planar_image_planes[ k ] = my_image_float + k * image_size;
+	}
+
+	if (( num_planes == RGBAZ ) && ( my_depth_plane != NULL ))
+	{
+		planar_image_planes[ RGBA ] = my_depth_plane;
+	}
+
+	// ====================================================================
+	//		BINARY-SWAP ( Reduced to a power-of-two number of nodes )
+	// ====================================================================
+	planar_bswap_float ( my_rank, nnodes, width, height, num_planes, \
+			     planar_image_planes, temp_image_float, &bs_offset, &bs_counts, MPI_COMM_234BS );
+
+	// ============ Final Image Gathering ==============
+	begin_stats_phase ( STATS_GATHER );
+
+	#ifdef _NOGATHER
+		// NO FINAL IMAGE GATHERING
+	#else
+		gather_planar_float ( my_rank, nnodes, width, height, num_planes, \
+				      planar_image_planes, bs_offset, bs_counts, (float *)gather_destination ( temp_image_float ), MPI_COMM_234BS );
+	#endif
+
+	end_composition_stats ( );
+	return EXIT_SUCCESS;
+}
@@ -23,858 +23,1545 @@
 	#define COMPOSITOR234_MERGE_H_INCLUDE
 #endif
 
+#ifndef COMPOSITOR234_CONTEXT_H_INCLUDE
+	#include "context.h"
+	#define COMPOSITOR234_CONTEXT_H_INCLUDE
+#endif
+
 #include "exchange.h"
 
 /*========================================================*/
 /**
- *  @brief Traditional Direct-Send Image Exchange 
- *         between 3 NODES 
- *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *  @brief Build a datatype covering count elements of 
+ *         datatype, for counts that do not fit in the int 
+ *         count argument of MPI: LARGE_COUNT_BLOCK sized 
+ *         blocks followed by the remaining elements.
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  MPI_COMM_DSEND [in] MPI Communicator
+ *  @param  count      [in]  Number of elements
+ *  @param  datatype   [in]  MPI datatype of each element
+ *  @param  large_type [out] Committed datatype (count 1)
 */
 /*========================================================*/
-int dsend3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-			   unsigned int width, unsigned int height, unsigned int image_type, \
-			   BYTE *my_image, BYTE *temp_image, \
-			   MPI_Comm MPI_COMM_DSEND )
+static void create_large_type ( size_t count, MPI_Datatype datatype, MPI_Datatype* large_type )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	MPI_Datatype block_type;
+	MPI_Datatype types[ 2 ];
 
-	int ds_pair;
-	unsigned int ds_image_size, ds_last_image_size, image_size_remainder;
-	unsigned int image_size;
+	MPI_Aint lower_bound, extent;
+	MPI_Aint displs[ 2 ];
 
-	BYTE* ds_send_image_ptr;
-	BYTE* ds_recv_image_ptr;
-	BYTE* ds_blnd_image_ptr;
+	int blocklens[ 2 ];
 
-	// ====================================================================
-	// 			COMPOSITE IMAGES ( DIRECT-SEND )
-	// ====================================================================
-	image_size = width * height;
+	size_t num_blocks;
+	size_t remainder;
 
-	image_size_remainder = image_size % 3;
-	ds_image_size = ceil( image_size / 3 ); 
+	num_blocks = count / LARGE_COUNT_BLOCK;
+	remainder  = count % LARGE_COUNT_BLOCK;
 
-	if (( image_size_remainder ) == 0 ) 
+	MPI_Type_get_extent( datatype, &lower_bound, &extent );
+	MPI_Type_vector( (int)num_blocks, LARGE_COUNT_BLOCK, LARGE_COUNT_BLOCK, datatype, &block_type );
+
+	types[ 0 ] = block_type;
+	types[ 1 ] = datatype;
+	blocklens[ 0 ] = 1;
+	blocklens[ 1 ] = (int)remainder;
+	displs[ 0 ] = 0;
+	displs[ 1 ] = (MPI_Aint)( num_blocks * LARGE_COUNT_BLOCK ) * extent;
+
+	MPI_Type_create_struct( 2, blocklens, displs, types, large_type );
+	MPI_Type_commit( large_type );
+	MPI_Type_free( &block_type );
+}
+
+/*========================================================*/
+/**
+ *  @brief Start the statistics of a composition 
+ *         ( See Get_234Composition_Stats )
+*/
+/*========================================================*/
+void begin_composition_stats ( void )
+{
+	memset( &composition_stats, 0x00, sizeof(Compositor234_Stats) );
+
+	stats_start = MPI_Wtime();
+	stats_mark  = stats_start;
+	stats_phase = STATS_SETUP;
+}
+
+/*========================================================*/
+/**
+ *  @brief Close the current phase of the composition 
+ *         statistics and start the next one
+ *
+ *  @param  phase [in] STATS_PARTIAL, STATS_GATHER or Binary-Swap stage
+*/
+/*========================================================*/
+void begin_stats_phase ( int phase )
+{
+	double now;
+	double elapsed;
+
+	now = MPI_Wtime();
+	elapsed = now - stats_mark;
+
+	if ( stats_phase == STATS_PARTIAL ) 
 	{
-		ds_last_image_size = ds_image_size;
-	} 
-	else 
+		composition_stats.partial_time += elapsed;
+	}
+	else if ( stats_phase == STATS_GATHER ) 
 	{
-		ds_last_image_size = ds_image_size + image_size_remainder;
+		composition_stats.gather_time += elapsed;
 	}
-
-	if ( my_rank == 0 )
+	else if (( stats_phase >= 0 ) && ( stats_phase < STATS_MAX_STAGES )) 
 	{
-		//=====================================
-		//  		Node 0
-		//=====================================
-		ds_pair = 1;
+		composition_stats.stage_time[ stats_phase ] += elapsed;
+		if ( composition_stats.num_stages <= (unsigned int)stats_phase )
+			composition_stats.num_stages = (unsigned int)stats_phase + 1;
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ds_image_size * image_type;
+	stats_mark  = now;
+	stats_phase = phase;
+}
 
-		ds_recv_image_ptr = temp_image;
+/*========================================================*/
+/**
+ *  @brief Finish the statistics of a composition. The blend 
+ *         time is the time of the compositing stages that 
+ *         was not spent in MPI waits.
+*/
+/*========================================================*/
+void end_composition_stats ( void )
+{
+	unsigned int i;
+	double compositing_time;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+	begin_stats_phase ( STATS_SETUP );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	composition_stats.total_time = stats_mark - stats_start;
 
-		ds_pair = 2;
+	compositing_time = composition_stats.partial_time;
+	for ( i = 0; i < composition_stats.num_stages; i++ ) {
+		compositing_time += composition_stats.stage_time[ i ];
+	}
 
-		ds_send_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	compositing_time -= composition_stats.wait_time;
+	composition_stats.blend_time = ( compositing_time > 0.0 ) ? compositing_time : 0.0;
+}
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+/*========================================================*/
+/**
+ *  @brief Count the bytes of a send or a receive 
+ *         ( Composition statistics )
+ *
+ *  @param  is_send  [in] Send ( true ) or receive ( false )
+ *  @param  count    [in] Number of elements
+ *  @param  datatype [in] MPI datatype
+*/
+/*========================================================*/
+static void count_transfer ( _Bool is_send, size_t count, MPI_Datatype datatype )
+{
+	int type_size;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	MPI_Type_size( datatype, &type_size );
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//=====================================
-		ds_blnd_image_ptr = temp_image;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	if ( is_send == true ) {
+		composition_stats.bytes_sent += (unsigned long long)count * type_size;
+	}
+	else {
+		composition_stats.bytes_received += (unsigned long long)count * type_size;
+	}
+}
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBA32 ) // RGBA32
-		{
-			composite_alpha_rgba32 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		} 
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA64 ) // RGBA64
-		{
-			composite_alpha_rgba64 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		#endif
+/*========================================================*/
+/**
+ *  @brief MPI_Wait counted as wait time 
+ *         ( Composition statistics )
+ *
+ *  @param  request [in]  MPI request
+ *  @param  status  [out] MPI status
+*/
+/*========================================================*/
+static int wait_request ( MPI_Request* request, MPI_Status* status )
+{
+	double start;
+	int result;
 
-		ds_blnd_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	start  = MPI_Wtime();
+	result = MPI_Wait( request, status );
+	composition_stats.wait_time += MPI_Wtime() - start;
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBA32 ) // RGBA32
-		{
-			composite_alpha_rgba32 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		} 
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA64 ) // RGBA64
-		{
-			composite_alpha_rgba64 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		#endif
+	return result;
+}
 
-	}
-	else if ( my_rank == 1 )
-	{
-		//=====================================
-		//  		Node 1
-		//=====================================
-		ds_pair = 0;
+/*========================================================*/
+/**
+ *  @brief MPI_Waitall counted as wait time 
+ *         ( Composition statistics )
+ *
+ *  @param  count    [in]  Number of requests
+ *  @param  requests [in]  MPI requests
+ *  @param  statuses [out] MPI statuses
+*/
+/*========================================================*/
+static int wait_all_requests ( int count, MPI_Request* requests, MPI_Status* statuses )
+{
+	double start;
+	int result;
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	start  = MPI_Wtime();
+	result = MPI_Waitall( count, requests, statuses );
+	composition_stats.wait_time += MPI_Wtime() - start;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-		
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	return result;
+}
 
-		ds_pair = 2;
+/*========================================================*/
+/**
+ *  @brief MPI_Isend with a size_t element count. 
+ *         (Counts larger than INT_MAX are sent as a single 
+ *          derived datatype)
+ *
+ *  @param  send_ptr  [in]  Data to be sent
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  dest      [in]  Destination rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+ *  @param  request   [out] MPI request
+*/
+/*========================================================*/
+int isend_large ( void* send_ptr, size_t count, MPI_Datatype datatype, \
+		  int dest, int tag, MPI_Comm comm, MPI_Request* request )
+{
+	MPI_Datatype large_type;
+	int result;
 
-		ds_send_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	count_transfer ( true, count, datatype );
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+	if ( count <= INT_MAX )
+	{
+		return MPI_Isend( send_ptr, (int)count, datatype, dest, tag, comm, request );
+	}
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	// The datatype can be freed while the request is pending
+	create_large_type ( count, datatype, &large_type );
+	result = MPI_Isend( send_ptr, 1, large_type, dest, tag, comm, request );
+	MPI_Type_free( &large_type );
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	return result;
+}
 
+/*========================================================*/
+/**
+ *  @brief MPI_Irecv with a size_t element count. 
+ *
+ *  @param  recv_ptr  [out] Buffer for the received data
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  source    [in]  Source rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+ *  @param  request   [out] MPI request
+*/
+/*========================================================*/
+int irecv_large ( void* recv_ptr, size_t count, MPI_Datatype datatype, \
+		  int source, int tag, MPI_Comm comm, MPI_Request* request )
+{
+	MPI_Datatype large_type;
+	int result;
 
-		if ( image_type == RGBA32 ) // RGBA32
-		{
-			composite_alpha_rgba32 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA64 ) // RGBA64
-		{
-			composite_alpha_rgba64 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
+	count_transfer ( false, count, datatype );
 
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr = temp_image;
+	if ( count <= INT_MAX )
+	{
+		return MPI_Irecv( recv_ptr, (int)count, datatype, source, tag, comm, request );
+	}
 
-		if ( image_type == RGBA32 ) // RGBA32
-		{
-			composite_alpha_rgba32 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBA64 ) // RGBA64
-		{
-			composite_alpha_rgba64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
+	create_large_type ( count, datatype, &large_type );
+	result = MPI_Irecv( recv_ptr, 1, large_type, source, tag, comm, request );
+	MPI_Type_free( &large_type );
+
+	return result;
+}
+
+/*========================================================*/
+/**
+ *  @brief MPI_Send with a size_t element count. 
+ *
+ *  @param  send_ptr  [in] Data to be sent
+ *  @param  count     [in] Number of elements
+ *  @param  datatype  [in] MPI datatype
+ *  @param  dest      [in] Destination rank
+ *  @param  tag       [in] MPI tag
+ *  @param  comm      [in] MPI Communicator
+*/
+/*========================================================*/
+int send_large ( void* send_ptr, size_t count, MPI_Datatype datatype, \
+		 int dest, int tag, MPI_Comm comm )
+{
+	MPI_Datatype large_type;
+	double start;
+	int result;
+
+	count_transfer ( true, count, datatype );
+	start = MPI_Wtime();
+
+	if ( count <= INT_MAX )
+	{
+		result = MPI_Send( send_ptr, (int)count, datatype, dest, tag, comm );
 	}
-	else //  my_rank == 2
+	else
 	{
-		//=====================================
-		//  		Node 2
-		//=====================================
-		ds_pair = 0;
+		create_large_type ( count, datatype, &large_type );
+		result = MPI_Send( send_ptr, 1, large_type, dest, tag, comm );
+		MPI_Type_free( &large_type );
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	composition_stats.wait_time += MPI_Wtime() - start;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-	
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+	return result;
+}
 
-		ds_pair = 1;
+/*========================================================*/
+/**
+ *  @brief MPI_Recv with a size_t element count. 
+ *
+ *  @param  recv_ptr  [out] Buffer for the received data
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  source    [in]  Source rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+*/
+/*========================================================*/
+int recv_large ( void* recv_ptr, size_t count, MPI_Datatype datatype, \
+		 int source, int tag, MPI_Comm comm )
+{
+	MPI_Datatype large_type;
+	MPI_Status status;
+	double start;
+	int result;
 
-		ds_send_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr += ds_last_image_size * image_type;
+	count_transfer ( false, count, datatype );
+	start = MPI_Wtime();
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
+	if ( count <= INT_MAX )
+	{
+		result = MPI_Recv( recv_ptr, (int)count, datatype, source, tag, comm, &status );
+	}
+	else
+	{
+		create_large_type ( count, datatype, &large_type );
+		result = MPI_Recv( recv_ptr, 1, large_type, source, tag, comm, &status );
+		MPI_Type_free( &large_type );
+	}
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	composition_stats.wait_time += MPI_Wtime() - start;
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_last_image_size * image_type;
+	return result;
+}
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBA32 ) // RGBA32
-		{
-			composite_alpha_rgba32 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		else if ( image_type == RGBA64 ) // RGBA64
+/*========================================================*/
+/**
+ *  @brief Start a persistent send or receive of the exchange 
+ *         schedule. The compositions of a context post the 
+ *         same requests in the same order frame after frame, 
+ *         so the request at the same position of the previous 
+ *         composition is simply restarted ( MPI_Start ). A new 
+ *         persistent request replaces it when any argument 
+ *         changed ( e.g. another image buffer ).
+ *
+ *  @param  is_send   [in]  MPI_Send_init ( true ) or MPI_Recv_init ( false )
+ *  @param  buffer    [in]  Data to be sent or received
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  peer      [in]  Destination or source rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+ *  @param  request   [out] MPI request ( Persistent )
+*/
+/*========================================================*/
+static int start_persistent ( _Bool is_send, void* buffer, size_t count, MPI_Datatype datatype, \
+			      int peer, int tag, MPI_Comm comm, MPI_Request* request )
+{
+	struct Compositor234_Exchange* entry;
+	struct Compositor234_Exchange* new_list;
+
+	MPI_Datatype large_type;
+
+	if ( exchange_next < exchange_count )
+	{
+		entry = &exchange_list[ exchange_next ];
+
+		// Same request as in the previous composition
+		if (( entry->is_send == is_send ) && ( entry->buffer == buffer ) && \
+		    ( entry->count == count ) && ( entry->datatype == datatype ) && \
+		    ( entry->peer == peer ) && ( entry->tag == tag ) && ( entry->comm == comm )) 
 		{
-			composite_alpha_rgba64 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+			exchange_next++;
+			*request = entry->request;
+			count_transfer ( is_send, count, datatype );
+			return MPI_Start( request );
 		}
-		#endif
 
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr = temp_image;
-		
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBA32 ) // RGBA32
+		MPI_Request_free( &entry->request );
+	}
+	else
+	{
+		if ( exchange_count == exchange_capacity ) 
 		{
-			composite_alpha_rgba32 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+			new_list = (struct Compositor234_Exchange *)realloc( exchange_list, \
+					( exchange_capacity + EXCHANGE_SCHEDULE_BLOCK ) * sizeof(struct Compositor234_Exchange) );
+
+			// Not kept in the schedule
+			if ( new_list == NULL ) 
+			{
+				if ( is_send == true ) {
+					return isend_large( buffer, count, datatype, peer, tag, comm, request );
+				}
+				return irecv_large( buffer, count, datatype, peer, tag, comm, request );
+			}
+
+			exchange_list = new_list;
+			exchange_capacity += EXCHANGE_SCHEDULE_BLOCK;
 		}
-		else if ( image_type == RGBA56 ) // RGBA56
-		{
-			composite_alpha_rgba56 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+
+		entry = &exchange_list[ exchange_count++ ];
+	}
+
+	exchange_next++;
+
+	entry->is_send  = is_send;
+	entry->buffer   = buffer;
+	entry->count    = count;
+	entry->datatype = datatype;
+	entry->peer     = peer;
+	entry->tag      = tag;
+	entry->comm     = comm;
+
+	if ( count <= INT_MAX )
+	{
+		if ( is_send == true ) {
+			MPI_Send_init( buffer, (int)count, datatype, peer, tag, comm, &entry->request );
 		}
-		else if ( image_type == RGBA64 ) // RGBA64
-		{
-			composite_alpha_rgba64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		else {
+			MPI_Recv_init( buffer, (int)count, datatype, peer, tag, comm, &entry->request );
 		}
-		#endif
 	}
-
-	//=====================================
-	// 	Final Image Gathering
-	//=====================================
-	if ( my_rank == 0 )
+	else
 	{
-		ds_pair = 1;
+		// The datatype can be freed while the request exists
+		create_large_type ( count, datatype, &large_type );
+		if ( is_send == true ) {
+			MPI_Send_init( buffer, 1, large_type, peer, tag, comm, &entry->request );
+		}
+		else {
+			MPI_Recv_init( buffer, 1, large_type, peer, tag, comm, &entry->request );
+		}
+		MPI_Type_free( &large_type );
+	}
 
-		ds_recv_image_ptr = my_image;
-		ds_recv_image_ptr += ( ds_image_size * image_type );
+	*request = entry->request;
+	count_transfer ( is_send, count, datatype );
+	return MPI_Start( request );
+}
 
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+/*========================================================*/
+/**
+ *  @brief MPI_Isend through a persistent request of the 
+ *         exchange schedule ( See start_persistent ). 
+ *         The request stays valid after MPI_Wait.
+ *
+ *  @param  send_ptr  [in]  Data to be sent
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  dest      [in]  Destination rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+ *  @param  request   [out] MPI request
+*/
+/*========================================================*/
+int isend_persistent ( void* send_ptr, size_t count, MPI_Datatype datatype, \
+		       int dest, int tag, MPI_Comm comm, MPI_Request* request )
+{
+	return start_persistent ( true, send_ptr, count, datatype, dest, tag, comm, request );
+}
 
-		ds_pair = 2;
+/*========================================================*/
+/**
+ *  @brief MPI_Irecv through a persistent request of the 
+ *         exchange schedule ( See start_persistent ). 
+ *
+ *  @param  recv_ptr  [out] Buffer for the received data
+ *  @param  count     [in]  Number of elements
+ *  @param  datatype  [in]  MPI datatype
+ *  @param  source    [in]  Source rank
+ *  @param  tag       [in]  MPI tag
+ *  @param  comm      [in]  MPI Communicator
+ *  @param  request   [out] MPI request
+*/
+/*========================================================*/
+int irecv_persistent ( void* recv_ptr, size_t count, MPI_Datatype datatype, \
+		       int source, int tag, MPI_Comm comm, MPI_Request* request )
+{
+	return start_persistent ( false, recv_ptr, count, datatype, source, tag, comm, request );
+}
 
-		ds_recv_image_ptr += (ds_image_size * image_type );
+/*========================================================*/
+/**
+ *  @brief Restart the exchange schedule from its first 
+ *         request ( Beginning of every composition )
+*/
+/*========================================================*/
+void restart_exchange_schedule ( void )
+{
+	exchange_next = 0;
+}
+
+/*========================================================*/
+/**
+ *  @brief Free the persistent requests of the exchange 
+ *         schedule ( Before freeing their communicators 
+ *         or buffers )
+*/
+/*========================================================*/
+void free_exchange_schedule ( void )
+{
+	unsigned int i;
 
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+	for ( i = 0; i < exchange_count; i++ ) {
+		MPI_Request_free( &exchange_list[ i ].request );
 	}
-	else if ( my_rank == 1 )
-	{
-		ds_pair = 0;
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_size * image_type );
+	free ( exchange_list );
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
-	}
-	else
+	exchange_list     = NULL;
+	exchange_count    = 0;
+	exchange_capacity = 0;
+	exchange_next     = 0;
+}
+
+/*========================================================*/
+/**
+ *  @brief Make sure the RLE staging buffer is large enough. 
+ *
+ *  @param  buffer      [in/out] Staging buffer
+ *  @param  buffer_size [in/out] Current size of the staging buffer
+ *  @param  data_size   [in] Number of bytes to be compressed
+*/
+/*========================================================*/
+static int reserve_compress_buffer ( BYTE** buffer, size_t* buffer_size, \
+				     size_t data_size )
+{
+	size_t required_size;
+
+	// Worst case RLE output: (257/256) * insize + 1
+	required_size = data_size + ( data_size / 256 ) + 2;
+
+	if ( *buffer_size >= required_size ) 
 	{
-		ds_pair = 0;
+		return EXIT_SUCCESS;
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_size * image_type * 2 );
+	if ( *buffer != NULL ) 
+	{
+		free( *buffer );
+	}
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+	if (( *buffer = allocate_byte_memory_region( required_size )) == NULL ) 
+	{
+		*buffer_size = 0;
+		return EXIT_FAILURE;
 	}
 
+	*buffer_size = required_size;
+
 	return EXIT_SUCCESS;
 }
 
 /*========================================================*/
 /**
- *  @brief Traditional Direct-Send Image Exchange 
- *         between 3 NODES 
- *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *  @brief Compress the outgoing data into compress_send_buffer. 
+ *         Returns the number of bytes to be sent, or the raw 
+ *         size when the RLE output does not reduce the data.
+ *         (Data larger than INT_MAX bytes is not compressed 
+ *          since the RLE coder uses int sizes)
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+ *  @param  send_ptr   [in] Data to be sent
+ *  @param  send_bytes [in] Number of bytes to be sent
 */
 /*========================================================*/
-int dsend3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-			    unsigned int width, unsigned int height, unsigned int image_type, \
-			    BYTE *my_image, BYTE *temp_image, \
-			    MPI_Comm MPI_COMM_DSEND )
+static size_t compress_image ( void* send_ptr, size_t send_bytes )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	int compressed_bytes;
 
-	int ds_pair;
-	unsigned int ds_image_size, ds_last_image_size, image_size_remainder;
-	unsigned int image_size;
+	if (( send_bytes == 0 ) || ( send_bytes > INT_MAX ))
+	{
+		return send_bytes;
+	}
 
-	BYTE* ds_send_image_ptr;
-	BYTE* ds_recv_image_ptr;
-	BYTE* ds_blnd_image_ptr;
-	
-	// ====================================================================
-	// 			COMPOSITE IMAGES ( DIRECT-SEND )
-	// ====================================================================
-	image_size = width * height;
+	if ( reserve_compress_buffer ( &compress_send_buffer, &compress_send_size, send_bytes ) == EXIT_FAILURE ) 
+	{
+		return send_bytes;
+	}
 
-	image_size_remainder = image_size % 3;
-	ds_image_size = ceil( image_size / 3 ); 
+	compressed_bytes = RLE_Compress( (BYTE *)send_ptr, compress_send_buffer, (unsigned int)send_bytes );
 
-	if (( image_size_remainder ) == 0 ) 
-	{
-		ds_last_image_size = ds_image_size;
-	} 
-	else 
+	if (( compressed_bytes <= 0 ) || ( (size_t)compressed_bytes >= send_bytes ))
 	{
-		ds_last_image_size = ds_image_size + image_size_remainder;
+		return send_bytes;
 	}
 
-	if ( my_rank == 0 )
-	{
-		//=====================================
-		//  		Node 0
-		//=====================================
-		ds_pair = 1;
+	return (size_t)compressed_bytes;
+}
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_size * image_type );
+/*========================================================*/
+/**
+ *  @brief Exchange the length of the encoded data with 
+ *         the pair node ( Counted as wait time )
+ *
+ *  @param  send_length [in]  Length sent
+ *  @param  recv_length [out] Length received
+ *  @param  pair        [in]  Rank of the pair node
+ *  @param  send_tag    [in]  MPI tag (send)
+ *  @param  recv_tag    [in]  MPI tag (receive)
+ *  @param  comm        [in]  MPI Communicator
+*/
+/*========================================================*/
+static void exchange_length ( unsigned long long send_length, unsigned long long* recv_length, \
+			      int pair, int send_tag, int recv_tag, MPI_Comm comm )
+{
+	MPI_Status status;
+	double start;
 
-		ds_recv_image_ptr = temp_image;
+	start = MPI_Wtime();
+	MPI_Sendrecv( &send_length, 1, MPI_UNSIGNED_LONG_LONG, pair, send_tag, \
+		      recv_length, 1, MPI_UNSIGNED_LONG_LONG, pair, recv_tag, comm, &status );
+	composition_stats.wait_time += MPI_Wtime() - start;
+}
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+/*========================================================*/
+/**
+ *  @brief Exchange image data with the pair node. 
+ *         When merge_ID is ALPHA_COMPRESS or DEPTH_COMPRESS the 
+ *         data is RLE compressed and the compressed length is 
+ *         sent ahead of the data. A length equal to the raw 
+ *         size means that the data was sent uncompressed.
+ *
+ *  @param  send_ptr   [in]  Data to be sent
+ *  @param  send_count [in]  Number of elements to be sent
+ *  @param  recv_ptr   [out] Buffer for the received data
+ *  @param  recv_count [in]  Number of elements to be received
+ *  @param  datatype   [in]  MPI datatype
+ *  @param  pair       [in]  Rank of the pair node
+ *  @param  send_tag   [in]  MPI tag (send)
+ *  @param  recv_tag   [in]  MPI tag (receive)
+ *  @param  comm       [in]  MPI Communicator
+*/
+/*========================================================*/
+int exchange_image ( void* send_ptr, size_t send_count, \
+		     void* recv_ptr, size_t recv_count, \
+		     MPI_Datatype datatype, int pair, int send_tag, int recv_tag, \
+		     MPI_Comm comm )
+{
+	MPI_Status  status;
+	MPI_Request isend;
+	MPI_Request irecv;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	int type_size;
+	size_t send_bytes, recv_bytes;
+	unsigned long long send_length, recv_length;
 
-		ds_pair = 2;
+	BYTE* send_data_ptr;
+	BYTE* recv_data_ptr;
 
-		ds_send_image_ptr += ( ds_image_size * image_type );
-		ds_recv_image_ptr += ( ds_image_size * image_type );
+	if (( global_merge_ID != ALPHA_COMPRESS ) && ( global_merge_ID != DEPTH_COMPRESS ))
+	{
+		irecv_persistent( recv_ptr, recv_count, datatype, pair, recv_tag, comm, &irecv );
+		isend_persistent( send_ptr, send_count, datatype, pair, send_tag, comm, &isend );
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+		wait_request( &isend, &status );
+		wait_request( &irecv, &status );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		return EXIT_SUCCESS;
+	}
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//  2 and 1: temp_image
-		//  0: my_image
-		//=====================================
-		ds_blnd_image_ptr = temp_image;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ( ds_image_size * image_type );
+	MPI_Type_size( datatype, &type_size );
+	send_bytes = send_count * type_size;
+	recv_bytes = recv_count * type_size;
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
-		{
-			composite_alpha_rgbaz88 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
-		{
-			composite_alpha_rgbaz96 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		#endif
+	send_length = compress_image ( send_ptr, send_bytes );
 
-		ds_blnd_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	composition_stats.compress_raw_bytes += send_bytes;
+	composition_stats.compress_bytes     += send_length;
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
-		{
-			composite_alpha_rgbaz88 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
+	send_data_ptr = ( send_length == send_bytes ) ? (BYTE *)send_ptr : compress_send_buffer;
+
+	exchange_length ( send_length, &recv_length, pair, send_tag, recv_tag, comm );
+
+	if ( recv_length == recv_bytes ) 
+	{
+		recv_data_ptr = (BYTE *)recv_ptr;
+	}
+	else
+	{
+		if ( reserve_compress_buffer ( &compress_recv_buffer, &compress_recv_size, recv_length ) == EXIT_FAILURE ) 
 		{
-			composite_alpha_rgbaz96 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+			printf( "<<< ERROR >> Cannot allocate memory for the compressed data \n" );
+			return EXIT_FAILURE;
 		}
-		#endif
+		recv_data_ptr = compress_recv_buffer;
 	}
-	else if ( my_rank == 1 )
+
+	irecv_large( recv_data_ptr, recv_length, MPI_BYTE, pair, recv_tag, comm, &irecv );
+	isend_large( send_data_ptr, send_length, MPI_BYTE, pair, send_tag, comm, &isend );
+
+	wait_request( &isend, &status );
+	wait_request( &irecv, &status );
+
+	if ( recv_data_ptr != (BYTE *)recv_ptr ) 
 	{
-		//=====================================
-		//  		Node 1
-		//=====================================
-		ds_pair = 0;
+		RLE_Uncompress( recv_data_ptr, (BYTE *)recv_ptr, (unsigned int)recv_length );
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	return EXIT_SUCCESS;
+}
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-		
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+/*========================================================*/
+/**
+ *  @brief Send image data to the pair node. 
+ *         (RLE compressed for ALPHA_COMPRESS and DEPTH_COMPRESS)
+ *
+ *  @param  send_ptr   [in] Data to be sent
+ *  @param  send_count [in] Number of elements to be sent
+ *  @param  datatype   [in] MPI datatype
+ *  @param  pair       [in] Rank of the pair node
+ *  @param  tag        [in] MPI tag
+ *  @param  comm       [in] MPI Communicator
+*/
+/*========================================================*/
+int send_image ( void* send_ptr, size_t send_count, \
+		 MPI_Datatype datatype, int pair, int tag, MPI_Comm comm )
+{
+	int type_size;
+	size_t send_bytes;
+	unsigned long long send_length;
 
-		ds_pair = 2;
+	if (( global_merge_ID != ALPHA_COMPRESS ) && ( global_merge_ID != DEPTH_COMPRESS ))
+	{
+		send_large( send_ptr, send_count, datatype, pair, tag, comm );
+		return EXIT_SUCCESS;
+	}
 
-		ds_send_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	MPI_Type_size( datatype, &type_size );
+	send_bytes = send_count * type_size;
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+	send_length = compress_image ( send_ptr, send_bytes );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	composition_stats.compress_raw_bytes += send_bytes;
+	composition_stats.compress_bytes     += send_length;
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	MPI_Send( &send_length, 1, MPI_UNSIGNED_LONG_LONG, pair, tag, comm );
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
-		{
-			composite_alpha_rgbaz88 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
-		{
-			composite_alpha_rgbaz96 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		#endif
+	if ( send_length == send_bytes ) 
+	{
+		send_large( send_ptr, send_length, MPI_BYTE, pair, tag, comm );
+	}
+	else
+	{
+		send_large( compress_send_buffer, send_length, MPI_BYTE, pair, tag, comm );
+	}
 
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr = temp_image;
+	return EXIT_SUCCESS;
+}
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
-		{
-			composite_alpha_rgbaz88 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
-		{
-			composite_alpha_rgbaz96 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		}
-		#endif
-	}
-	else //  my_rank == 2
+/*========================================================*/
+/**
+ *  @brief Receive image data from the pair node. 
+ *         (RLE compressed for ALPHA_COMPRESS and DEPTH_COMPRESS)
+ *
+ *  @param  recv_ptr   [out] Buffer for the received data
+ *  @param  recv_count [in]  Number of elements to be received
+ *  @param  datatype   [in]  MPI datatype
+ *  @param  pair       [in]  Rank of the pair node
+ *  @param  tag        [in]  MPI tag
+ *  @param  comm       [in]  MPI Communicator
+*/
+/*========================================================*/
+int recv_image ( void* recv_ptr, size_t recv_count, \
+		 MPI_Datatype datatype, int pair, int tag, MPI_Comm comm )
+{
+	MPI_Status status;
+
+	int type_size;
+	size_t recv_bytes;
+	unsigned long long recv_length;
+	double start;
+
+	if (( global_merge_ID != ALPHA_COMPRESS ) && ( global_merge_ID != DEPTH_COMPRESS ))
 	{
-		//=====================================
-		//  		Node 2
-		//=====================================
-		ds_pair = 0;
+		recv_large( recv_ptr, recv_count, datatype, pair, tag, comm );
+		return EXIT_SUCCESS;
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+	MPI_Type_size( datatype, &type_size );
+	recv_bytes = recv_count * type_size;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-	
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+	start = MPI_Wtime();
+	MPI_Recv( &recv_length, 1, MPI_UNSIGNED_LONG_LONG, pair, tag, comm, &status );
+	composition_stats.wait_time += MPI_Wtime() - start;
 
-		ds_pair = 1;
+	if ( recv_length == recv_bytes ) 
+	{
+		recv_large( recv_ptr, recv_length, MPI_BYTE, pair, tag, comm );
+		return EXIT_SUCCESS;
+	}
 
-		ds_send_image_ptr += ds_image_size * image_type;
-		ds_recv_image_ptr += ds_last_image_size * image_type;
+	if ( reserve_compress_buffer ( &compress_recv_buffer, &compress_recv_size, recv_length ) == EXIT_FAILURE ) 
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the compressed data \n" );
+		return EXIT_FAILURE;
+	}
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
+	recv_large( compress_recv_buffer, recv_length, MPI_BYTE, pair, tag, comm );
+	RLE_Uncompress( compress_recv_buffer, (BYTE *)recv_ptr, (unsigned int)recv_length );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	return EXIT_SUCCESS;
+}
 
-		//=====================================
-		//  Image Compositing (2->1->0)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_last_image_size * image_type;
+/*========================================================*/
+/**
+ *  @brief Encode an image as a list of active-pixel spans.
+ *         Layout: number of spans, (empty, active) pixel counts
+ *         of each span, followed by the active pixels packed
+ *         together. A pixel is empty when all its bytes are zero.
+ *         Trailing empty pixels are not recorded. If the spans
+ *         would be larger than the image itself, the whole image
+ *         is encoded as a single active span.
+ *
+ *  @param  image       [in]  Image Data
+ *  @param  num_pixels  [in]  Number of pixels
+ *  @param  pixel_size  [in]  Bytes per pixel
+ *  @param  span_buffer [out] Encoded image
+ *  @return Size of the encoded image (bytes)
+*/
+/*========================================================*/
+static size_t encode_active_spans ( BYTE* image, unsigned int num_pixels, \
+					  size_t pixel_size, BYTE* span_buffer )
+{
+	unsigned int i, j;
+	unsigned int num_spans;
+	unsigned int num_active;
+	unsigned int span_start;
+	unsigned int empty_pixels;
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
-		{
-			composite_alpha_rgbaz88 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
-		{
-			composite_alpha_rgbaz96 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		#endif
+	unsigned int* span_list;
+	BYTE* image_ptr;
+	BYTE* active_ptr;
 
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_size * image_type * 2;
-		ds_recv_image_ptr = temp_image;
+	_Bool is_empty, was_empty;
 
-		#ifdef _NOBLEND
-		#else
-		if ( image_type == RGBAZ64 ) // RGBAZ64
-		{
-			composite_alpha_rgbaz64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) // RGBAZ88
+	// Count spans and active pixels
+	num_spans  = 0;
+	num_active = 0;
+	was_empty  = true;
+
+	image_ptr = image;
+	for ( i = 0; i < num_pixels; i++, image_ptr += pixel_size )
+	{
+		is_empty = true;
+		for ( j = 0; j < pixel_size; j++ )
 		{
-			composite_alpha_rgbaz88 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+			if ( image_ptr[ j ] != 0 )
+			{
+				is_empty = false;
+				break;
+			}
 		}
-		else if ( image_type == RGBAZ96 ) // RGBAZ96
+
+		if ( is_empty == false )
 		{
-			composite_alpha_rgbaz96 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+			num_active++;
+			if ( was_empty == true ) num_spans++;
 		}
-		#endif
+		was_empty = is_empty;
 	}
 
-	//=====================================
-	// 	Final Image Gathering
-	//=====================================
-	if ( my_rank == 0 )
+	span_list = (unsigned int *)span_buffer;
+
+	if (( num_spans * 2 * sizeof(unsigned int) + num_active * pixel_size ) >=
+	    ( 2 * sizeof(unsigned int) + num_pixels * pixel_size ))
 	{
-		ds_pair = 1;
+		// Dense image
+		span_list[ 0 ] = 1;
+		span_list[ 1 ] = 0;
+		span_list[ 2 ] = num_pixels;
+		memcpy( span_buffer + 3 * sizeof(unsigned int), image, num_pixels * pixel_size );
 
-		ds_recv_image_ptr = my_image;
-		ds_recv_image_ptr += ds_image_size * image_type;
+		return 3 * sizeof(unsigned int) + num_pixels * pixel_size;
+	}
 
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+	span_list[ 0 ] = num_spans;
+	active_ptr = span_buffer + ( 1 + 2 * num_spans ) * sizeof(unsigned int);
 
-		ds_pair = 2;
-		ds_recv_image_ptr += ds_image_size * image_type;
+	// Store spans and active pixels
+	num_spans    = 0;
+	empty_pixels = 0;
+	span_start   = 0;
+	was_empty    = true;
 
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
-	}
-	else if ( my_rank == 1 )
+	image_ptr = image;
+	for ( i = 0; i <= num_pixels; i++, image_ptr += pixel_size )
 	{
-		ds_pair = 0;
+		is_empty = true;
+		if ( i < num_pixels )
+		{
+			for ( j = 0; j < pixel_size; j++ )
+			{
+				if ( image_ptr[ j ] != 0 )
+				{
+					is_empty = false;
+					break;
+				}
+			}
+		}
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_size * image_type );
+		if (( is_empty == false ) && ( was_empty == true ))
+		{
+			span_start = i;
+		}
+		else if (( is_empty == true ) && ( was_empty == false ))
+		{
+			span_list[ 1 + 2 * num_spans ] = empty_pixels;
+			span_list[ 2 + 2 * num_spans ] = i - span_start;
+			num_spans++;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
-	}
-	else // my_rank = 2
-	{
-		ds_pair = 0;
+			memcpy( active_ptr, image + span_start * pixel_size, ( i - span_start ) * pixel_size );
+			active_ptr += ( i - span_start ) * pixel_size;
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_size * image_type * 2 );
+			empty_pixels = 0;
+		}
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+		if ( is_empty == true ) empty_pixels++;
+		was_empty = is_empty;
 	}
 
-	return EXIT_SUCCESS;
+	return (size_t)( active_ptr - span_buffer );
 }
 
-
-
 /*========================================================*/
 /**
- *  @brief Traditional Direct-Send Image Exchange 
- *         between 3 NODES 
- *         (RGBA128 Pixels) 
+ *  @brief Exchange image data with the pair node using
+ *         active-pixel span encoding (ALPHA_SPARSE).
+ *         The received spans are left in compress_recv_buffer
+ *         and are blended without being expanded.
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  MPI_COMM_DSEND [in] MPI Communicator
+ *  @param  send_ptr    [in]  Data to be sent
+ *  @param  send_pixels [in]  Number of pixels to be sent
+ *  @param  pixel_size  [in]  Bytes per pixel
+ *  @param  span_ptr    [out] Received span encoded image
+ *  @param  pair        [in]  Rank of the pair node
+ *  @param  send_tag    [in]  MPI tag (send)
+ *  @param  recv_tag    [in]  MPI tag (receive)
+ *  @param  comm        [in]  MPI Communicator
 */
 /*========================================================*/
-int dsend3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
-					 unsigned int width, unsigned int height, unsigned int image_type, \
-					 float *my_image, float *temp_image, \
-					 MPI_Comm MPI_COMM_DSEND )
+int exchange_image_spans ( BYTE* send_ptr, unsigned int send_pixels, size_t pixel_size, \
+			   BYTE** span_ptr, int pair, int send_tag, int recv_tag, \
+			   MPI_Comm comm )
 {
 	MPI_Status  status;
 	MPI_Request isend;
 	MPI_Request irecv;
 
-	int ds_pair;
-	unsigned int ds_image_size, ds_last_image_size, image_size_remainder;
-	unsigned int ds_image_offset, ds_last_image_offset;
-	unsigned int image_size; 
-
+	unsigned long long send_length, recv_length;
 
-	float* ds_send_image_ptr;
-	float* ds_recv_image_ptr;
-	float* ds_blnd_image_ptr;
+	if ( reserve_compress_buffer ( &compress_send_buffer, &compress_send_size, \
+		send_pixels * pixel_size + 3 * sizeof(unsigned int) ) == EXIT_FAILURE )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the span encoded data \n" );
+		return EXIT_FAILURE;
+	}
 
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( DIRECT-SEND )
-	// ====================================================================
-	image_size = width * height;
+	send_length = encode_active_spans ( send_ptr, send_pixels, pixel_size, compress_send_buffer );
 
-	image_size_remainder = image_size % 3;
-	ds_image_size = ceil( image_size / 3 ); 
+	exchange_length ( send_length, &recv_length, pair, send_tag, recv_tag, comm );
 
-	if (( image_size_remainder ) == 0 ) 
-	{
-		ds_last_image_size = ds_image_size;
-	} 
-	else 
+	if ( reserve_compress_buffer ( &compress_recv_buffer, &compress_recv_size, recv_length ) == EXIT_FAILURE )
 	{
-		ds_last_image_size = ds_image_size + image_size_remainder;
+		printf( "<<< ERROR >> Cannot allocate memory for the span encoded data \n" );
+		return EXIT_FAILURE;
 	}
 
-	ds_image_offset = ds_image_size * RGBA; // RGBA = Four components
-	ds_last_image_offset = ds_last_image_size * RGBA; // RGBA = Four components
-
-	if ( my_rank == 0 )
-	{
-		ds_pair = 1;
+	irecv_large( compress_recv_buffer, recv_length, MPI_BYTE, pair, recv_tag, comm, &irecv );
+	isend_large( compress_send_buffer, send_length, MPI_BYTE, pair, send_tag, comm, &isend );
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ds_image_offset;
+	wait_request( &isend, &status );
+	wait_request( &irecv, &status );
 
-		ds_recv_image_ptr = temp_image;
+	*span_ptr = compress_recv_buffer;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+	return EXIT_SUCCESS;
+}
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+/*========================================================*/
+/**
+ *  @brief Compute the ROI of my image (unless it was given 
+ *         by Set_234Composition_ROI) and collect the ROI of 
+ *         every node in roi_list (ALPHA_ROI and DEPTH_ROI).
+ *
+ *  @param  my_image [in] Image Data 
+ *  @param  width    [in] Image Width
+ *  @param  height   [in] Image Height
+ *  @param  pixel_ID [in] Pixel type
+ *  @param  comm     [in] MPI Communicator
+*/
+/*========================================================*/
+int exchange_roi ( void* my_image, unsigned int width, unsigned int height, \
+		   unsigned int pixel_ID, MPI_Comm comm )
+{
+	if ( global_roi_defined == false ) 
+	{
+		get_image_roi ( my_image, width, height, pixel_ID, global_roi );
+	}
+	else
+	{
+		// Clip the given ROI to the image
+		if ( global_roi[ 0 ] < 0 ) global_roi[ 0 ] = 0;
+		if ( global_roi[ 1 ] < 0 ) global_roi[ 1 ] = 0;
+		if ( global_roi[ 2 ] > (int)width  ) global_roi[ 2 ] = (int)width;
+		if ( global_roi[ 3 ] > (int)height ) global_roi[ 3 ] = (int)height;
+	}
 
-		ds_pair = 2;
+	// The given ROI is valid for one composition
+	global_roi_defined = false;
 
-		ds_send_image_ptr += ds_image_offset;
-		ds_recv_image_ptr += ds_image_offset;
-	
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+	MPI_Allgather( global_roi, 4, MPI_INT, roi_list, 4, MPI_INT, comm );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	return EXIT_SUCCESS;
+}
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		ds_blnd_image_ptr = temp_image;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_offset;
+/*========================================================*/
+/**
+ *  @brief Get the union of the ROI of a group of nodes. 
+ *
+ *  @param  first_node [in]  First node of the group
+ *  @param  num_nodes  [in]  Number of nodes of the group
+ *  @param  roi        [out] ROI ( x_min, y_min, x_max, y_max ) 
+*/
+/*========================================================*/
+static void get_group_roi ( unsigned int first_node, unsigned int num_nodes, int* roi )
+{
+	unsigned int i;
+	int* node_roi;
 
-		composite_alpha_rgba128 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+	roi[ 0 ] = roi[ 1 ] = roi[ 2 ] = roi[ 3 ] = 0;
 
-		ds_blnd_image_ptr = temp_image;
-		ds_recv_image_ptr = temp_image;
-		composite_alpha_rgba128 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-	}
-	else if ( my_rank == 1 )
+	for ( i = first_node; i < first_node + num_nodes; i++ )
 	{
-		ds_pair = 0;
+		node_roi = roi_list + 4 * i;
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
-
-		MPI_Isend( ds_send_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-		
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		// Skip empty ROI
+		if (( node_roi[ 0 ] >= node_roi[ 2 ] ) || ( node_roi[ 1 ] >= node_roi[ 3 ] )) 
+			continue;
 
-		ds_pair = 2;
-
-		ds_send_image_ptr += ( ds_image_offset * 2 );
-		ds_recv_image_ptr += ds_image_offset;
+		if (( roi[ 0 ] >= roi[ 2 ] ) || ( roi[ 1 ] >= roi[ 3 ] ))
+		{
+			memcpy( roi, node_roi, 4 * sizeof(int) );
+			continue;
+		}
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+		if ( node_roi[ 0 ] < roi[ 0 ] ) roi[ 0 ] = node_roi[ 0 ];
+		if ( node_roi[ 1 ] < roi[ 1 ] ) roi[ 1 ] = node_roi[ 1 ];
+		if ( node_roi[ 2 ] > roi[ 2 ] ) roi[ 2 ] = node_roi[ 2 ];
+		if ( node_roi[ 3 ] > roi[ 3 ] ) roi[ 3 ] = node_roi[ 3 ];
+	}
+}
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+/*========================================================*/
+/**
+ *  @brief Get the pixel segments of an image region 
+ *         ( pixels from offset to offset + counts ) 
+ *         which are inside the ROI. One segment per row.
+ *
+ *  @param  roi      [in]  ROI ( x_min, y_min, x_max, y_max ) 
+ *  @param  width    [in]  Image Width
+ *  @param  offset   [in]  First pixel of the region
+ *  @param  counts   [in]  Number of pixels of the region
+ *  @param  segments [out] Segments ( offset from the region, counts )
+ *  @return Number of segments
+*/
+/*========================================================*/
+static unsigned int get_roi_segments ( int* roi, unsigned int width, \
+				       unsigned int offset, unsigned int counts, \
+				       unsigned int* segments )
+{
+	unsigned int row, first_row, last_row;
+	unsigned int segment_start, segment_end;
+	unsigned int num_segments;
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_offset;
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_offset;
+	if (( roi[ 0 ] >= roi[ 2 ] ) || ( roi[ 1 ] >= roi[ 3 ] ) || ( counts == 0 )) 
+		return 0;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgba128 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		#endif
+	first_row = offset / width;
+	last_row  = ( offset + counts - 1 ) / width;
 
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_offset;
-		ds_recv_image_ptr = temp_image;
+	if ( first_row < (unsigned int)roi[ 1 ] ) first_row = (unsigned int)roi[ 1 ];
+	if ( last_row >= (unsigned int)roi[ 3 ] ) last_row  = (unsigned int)roi[ 3 ] - 1;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgba128 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		#endif
-	}
-	else //  my_rank == 2
+	num_segments = 0;
+	for ( row = first_row; row <= last_row; row++ )
 	{
-		ds_pair = 0;
+		segment_start = row * width + (unsigned int)roi[ 0 ];
+		segment_end   = row * width + (unsigned int)roi[ 2 ];
 
-		ds_send_image_ptr = my_image;
-		ds_recv_image_ptr = temp_image;
+		if ( segment_start < offset ) segment_start = offset;
+		if ( segment_end > offset + counts ) segment_end = offset + counts;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-	
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		if ( segment_start < segment_end ) 
+		{
+			segments[ 2 * num_segments     ] = segment_start - offset;
+			segments[ 2 * num_segments + 1 ] = segment_end - segment_start;
+			num_segments++;
+		}
+	}
 
-		ds_pair = 1;
+	return num_segments;
+}
 
-		ds_send_image_ptr += ds_image_offset;
-		ds_recv_image_ptr += ds_last_image_offset;
+/*========================================================*/
+/**
+ *  @brief Exchange image data with the pair node sending 
+ *         only the pixels inside the ROI of the group of 
+ *         nodes already merged into the image 
+ *         (ALPHA_ROI and DEPTH_ROI). The received pixels 
+ *         are packed in recv_ptr and their segments are 
+ *         stored in roi_segments.
+ *
+ *  @param  send_ptr     [in]  Data to be sent
+ *  @param  send_offset  [in]  First pixel to be sent
+ *  @param  send_counts  [in]  Number of pixels to be sent
+ *  @param  send_group   [in]  First node of my group
+ *  @param  recv_ptr     [out] Buffer for the received pixels
+ *  @param  recv_offset  [in]  First pixel to be received
+ *  @param  recv_counts  [in]  Number of pixels to be received
+ *  @param  recv_group   [in]  First node of the pair group
+ *  @param  group_size   [in]  Number of nodes of each group
+ *  @param  pixel_size   [in]  Bytes per pixel
+ *  @param  width        [in]  Image Width
+ *  @param  pair         [in]  Rank of the pair node
+ *  @param  send_tag     [in]  MPI tag (send)
+ *  @param  recv_tag     [in]  MPI tag (receive)
+ *  @param  comm         [in]  MPI Communicator
+ *  @param  num_segments [out] Number of received segments
+*/
+/*========================================================*/
+int exchange_image_roi ( BYTE* send_ptr, unsigned int send_offset, unsigned int send_counts, unsigned int send_group, \
+			 BYTE* recv_ptr, unsigned int recv_offset, unsigned int recv_counts, unsigned int recv_group, \
+			 unsigned int group_size, size_t pixel_size, unsigned int width, \
+			 int pair, int send_tag, int recv_tag, MPI_Comm comm, \
+			 unsigned int* num_segments )
+{
+	MPI_Status  status;
+	MPI_Request isend;
+	MPI_Request irecv;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
+	unsigned int i;
+	unsigned int num_send_segments;
+	size_t send_length, recv_length;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	int group_roi[ 4 ];
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ( ds_image_offset * 2 );
+	BYTE* pack_ptr;
 
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_last_image_offset;
+	// Pack the pixels inside the ROI of my group
+	get_group_roi ( send_group, group_size, group_roi );
+	num_send_segments = get_roi_segments ( group_roi, width, send_offset, send_counts, roi_segments );
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgba128 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
-		#endif
+	if ( reserve_compress_buffer ( &compress_send_buffer, &compress_send_size, send_counts * pixel_size ) == EXIT_FAILURE ) 
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the ROI data \n" );
+		return EXIT_FAILURE;
+	}
 
-		ds_recv_image_ptr = temp_image;
+	pack_ptr = compress_send_buffer;
+	for ( i = 0; i < num_send_segments; i++ )
+	{
+		memcpy( pack_ptr, send_ptr + roi_segments[ 2 * i ] * pixel_size, roi_segments[ 2 * i + 1 ] * pixel_size );
+		pack_ptr += roi_segments[ 2 * i + 1 ] * pixel_size;
+	}
+	send_length = (size_t)( pack_ptr - compress_send_buffer );
 
-		#ifdef _NOBLEND
+	// Segments to be received from the pair group
+	get_group_roi ( recv_group, group_size, group_roi );
+	*num_segments = get_roi_segments ( group_roi, width, recv_offset, recv_counts, roi_segments );
+
+	recv_length = 0;
+	for ( i = 0; i < *num_segments; i++ )
+	{
+		recv_length += roi_segments[ 2 * i + 1 ] * pixel_size;
+	}
+
+	irecv_large( recv_ptr, recv_length, MPI_BYTE, pair, recv_tag, comm, &irecv );
+	isend_large( compress_send_buffer, send_length, MPI_BYTE, pair, send_tag, comm, &isend );
+
+	wait_request( &isend, &status );
+	wait_request( &irecv, &status );
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Composite the received ROI segments into the 
+ *         blended image (BYTE Pixels). The pixels outside 
+ *         the segments are kept unchanged.
+ *
+ *  @param  image_ID     [in]     Image Type ID
+ *  @param  recv_order   [in]     Received image is OVER or UNDER
+ *  @param  recv_image   [in]     Received (packed) pixels
+ *  @param  blnd_image   [in,out] Local image and blended image
+ *  @param  num_segments [in]     Number of segments in roi_segments
+*/
+/*========================================================*/
+static void composite_roi_segments_BYTE ( unsigned int image_ID, unsigned int recv_order, \
+					  BYTE* recv_image, BYTE* blnd_image, \
+					  unsigned int num_segments )
+{
+	unsigned int i;
+	unsigned int segment_size;
+
+	BYTE* over_image_ptr;
+	BYTE* under_image_ptr;
+	BYTE* blnd_image_ptr;
+
+	for ( i = 0; i < num_segments; i++ )
+	{
+		segment_size   = roi_segments[ 2 * i + 1 ];
+		blnd_image_ptr = blnd_image + roi_segments[ 2 * i ] * global_image_type;
+
+		if ( recv_order == OVER ) 
+		{
+			over_image_ptr  = recv_image;
+			under_image_ptr = blnd_image_ptr;
+		}
+		else
+		{
+			over_image_ptr  = blnd_image_ptr;
+			under_image_ptr = recv_image;
+		}
+
+		if ( image_ID == ID_RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+			#else
+				composite_alpha_rgba32_blend ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+			#endif
+		}
+		else if ( image_ID == ID_RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+		}
+		else if ( image_ID == ID_RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+		}
+		else if ( image_ID == ID_RGBAZ64 ) 
+		{
+			composite_alpha_rgbaz64_blend ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+		}
+		else if ( image_ID == ID_RGBAZ88 ) 
+		{
+			composite_alpha_rgbaz88_blend ( under_image_ptr, over_image_ptr, blnd_image_ptr, segment_size );
+		}
+		else if ( image_ID == ID_RGBAZ96 ) 
+		{
+			composite_alpha_rgbaz96_blend ( under_image_ptr, over_image_ptr, blnd_image_ptr, segment_size );
+		}
+
+		recv_image += segment_size * global_image_type;
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Composite the received ROI segments into the 
+ *         blended image (RGBA128 and RGBAZ160 Pixels). 
+ *         The pixels outside the segments are kept unchanged.
+ *
+ *  @param  image_ID     [in]     Image Type ID
+ *  @param  recv_order   [in]     Received image is OVER or UNDER
+ *  @param  recv_image   [in]     Received (packed) pixels
+ *  @param  blnd_image   [in,out] Local image and blended image
+ *  @param  num_segments [in]     Number of segments in roi_segments
+*/
+/*========================================================*/
+static void composite_roi_segments_FLOAT ( unsigned int image_ID, unsigned int recv_order, \
+					   float* recv_image, float* blnd_image, \
+					   unsigned int num_segments )
+{
+	unsigned int i;
+	unsigned int segment_size;
+	unsigned int num_elements;
+
+	float* over_image_ptr;
+	float* under_image_ptr;
+	float* blnd_image_ptr;
+
+	num_elements = ( image_ID == ID_RGBA128 ) ? RGBA : RGBAZ;
+
+	for ( i = 0; i < num_segments; i++ )
+	{
+		segment_size   = roi_segments[ 2 * i + 1 ];
+		blnd_image_ptr = blnd_image + roi_segments[ 2 * i ] * num_elements;
+
+		if ( recv_order == OVER ) 
+		{
+			over_image_ptr  = recv_image;
+			under_image_ptr = blnd_image_ptr;
+		}
+		else
+		{
+			over_image_ptr  = blnd_image_ptr;
+			under_image_ptr = recv_image;
+		}
+
+		if ( image_ID == ID_RGBA128 ) 
+		{
+			composite_alpha_rgba128 ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+		}
+		else if ( image_ID == ID_RGBAZ160 ) 
+		{
+			composite_alpha_rgbaz160_blend ( over_image_ptr, under_image_ptr, blnd_image_ptr, segment_size );
+		}
+
+		recv_image += segment_size * num_elements;
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Alpha-blend or depth-sort the pixels of two images
+ *
+ *  @param  image_ID    [in]  Pixel ID
+ *  @param  over_image  [in]  Image in front
+ *  @param  under_image [in]  Image behind
+ *  @param  blnd_image  [out] Composited image
+ *  @param  image_size  [in]  Number of pixels
+*/
+/*========================================================*/
+static void composite_pixels ( unsigned int image_ID, \
+			       BYTE* over_image, BYTE* under_image, BYTE* blnd_image, \
+			       unsigned int image_size )
+{
+	#ifdef _NOBLEND
+	#else
+	if ( image_ID == ID_RGBA32 ) 
+	{
+		#ifdef _LUTBLEND
+			composite_alpha_rgba32 ( over_image, under_image, blnd_image, image_size );
+		#elif defined _BLENDF
+			composite_alpha_rgba32f ( over_image, under_image, blnd_image, image_size );
 		#else
-		composite_alpha_rgba128 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+			composite_alpha_rgba32_blend ( over_image, under_image, blnd_image, image_size );
 		#endif
 	}
+	else if ( image_ID == ID_RGBA56 ) 
+	{
+		composite_alpha_rgba56 ( over_image, under_image, blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBA64 ) 
+	{
+		composite_alpha_rgba64 ( over_image, under_image, blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBAZ64 ) 
+	{
+		composite_alpha_rgbaz64_blend ( over_image, under_image, blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBAZ88 ) 
+	{
+		composite_alpha_rgbaz88_blend ( under_image, over_image, blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBAZ96 ) 
+	{
+		composite_alpha_rgbaz96_blend ( under_image, over_image, blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBA128 ) 
+	{
+		composite_alpha_rgba128 ( (float *)over_image, (float *)under_image, (float *)blnd_image, image_size );
+	}
+	else if ( image_ID == ID_RGBAZ160 ) 
+	{
+		composite_alpha_rgbaz160_blend ( (float *)over_image, (float *)under_image, (float *)blnd_image, image_size );
+	}
+	#endif
+}
 
-	//=====================================
-	//  Image Gathering
-	//=====================================
-	if ( my_rank == 0 )
+/*========================================================*/
+/**
+ *  @brief Number of pixels per message of the pipelined 
+ *         Binary-Swap exchange
+ *
+ *  @param  image_ID   [in] Pixel ID
+ *  @param  pixel_size [in] Bytes per pixel
+*/
+/*========================================================*/
+static unsigned int get_chunk_pixels ( unsigned int image_ID, size_t pixel_size )
+{
+	if ( bswap_chunk_pixels[ image_ID ] > 0 ) 
 	{
-		ds_pair = 1;
+		return bswap_chunk_pixels[ image_ID ];
+	}
 
-		ds_recv_image_ptr = my_image;
-		ds_recv_image_ptr += ds_image_offset;
+	return ( BSWAP_CHUNK_SIZE / pixel_size );
+}
+
+/*========================================================*/
+/**
+ *  @brief Exchange image data with the pair node and composite 
+ *         the received pixels. The data is split into chunks so 
+ *         that the compositing of a chunk overlaps the transfer 
+ *         of the following ones.
+ *
+ *  @param  send_ptr     [in]  Data to be sent
+ *  @param  send_pixels  [in]  Number of pixels to be sent
+ *  @param  recv_ptr     [in]  Buffer for the received pixels
+ *  @param  recv_pixels  [in]  Number of pixels to be received
+ *  @param  pair_ptr     [in]  My pixels to be composited
+ *  @param  blnd_ptr     [out] Composited pixels
+ *  @param  recv_order   [in]  Received pixels in front (OVER) or behind (UNDER)
+ *  @param  image_ID     [in]  Pixel ID
+ *  @param  pixel_size   [in]  Bytes per pixel
+ *  @param  chunk_pixels [in]  Number of pixels per message
+ *  @param  pair         [in]  Rank of the pair node
+ *  @param  send_tag     [in]  MPI tag (send)
+ *  @param  recv_tag     [in]  MPI tag (receive)
+ *  @param  comm         [in]  MPI Communicator
+*/
+/*========================================================*/
+int exchange_composite_image ( BYTE* send_ptr, unsigned int send_pixels, \
+			       BYTE* recv_ptr, unsigned int recv_pixels, \
+			       BYTE* pair_ptr, BYTE* blnd_ptr, unsigned int recv_order, \
+			       unsigned int image_ID, size_t pixel_size, unsigned int chunk_pixels, \
+			       int pair, int send_tag, int recv_tag, MPI_Comm comm )
+{
+	unsigned int i;
+	unsigned int num_send_chunks;
+	unsigned int num_recv_chunks;
+	unsigned int chunk_offset;
+	unsigned int chunk_size;
+	size_t send_size;
+	size_t recv_size;
 
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+	_Bool on_arrival;
 
-		ds_pair = 2;
-		ds_recv_image_ptr += ds_image_offset;
+	MPI_Request* isend;
+	MPI_Request* irecv;
 
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+	recv_size = recv_pixels * pixel_size;
+	send_size = send_pixels * pixel_size;
+
+	if ( chunk_pixels == 0 ) 
+	{
+		chunk_pixels = ( send_pixels > recv_pixels ) ? send_pixels : recv_pixels;
 	}
-	else if ( my_rank == 1 )
+
+	// The composited pixels must not overwrite the pixels that are 
+	// still being received or sent. Otherwise the chunks are still 
+	// exchanged (the pair node splits the data in the same way), 
+	// but they are composited after the whole exchange
+	on_arrival = true;
+	if ((( blnd_ptr != recv_ptr ) && \
+	     ( blnd_ptr < recv_ptr + recv_size ) && ( recv_ptr < blnd_ptr + recv_size )) || \
+	    (( blnd_ptr < send_ptr + send_size ) && ( send_ptr < blnd_ptr + recv_size )))
 	{
-		ds_pair = 0;
+		on_arrival = false;
+	}
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ds_image_offset;
+	num_send_chunks = ( chunk_pixels > 0 ) ? ( send_pixels + chunk_pixels - 1 ) / chunk_pixels : 0;
+	num_recv_chunks = ( chunk_pixels > 0 ) ? ( recv_pixels + chunk_pixels - 1 ) / chunk_pixels : 0;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size     * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+	isend = (MPI_Request *)malloc( ( num_send_chunks + num_recv_chunks + 1 ) * sizeof(MPI_Request) );
+	if ( isend == NULL )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the MPI requests \n" );
+		return EXIT_FAILURE;
 	}
-	else
+	irecv = isend + num_send_chunks;
+
+	for ( i = 0; i < num_recv_chunks; i++ )
 	{
-		ds_pair = 0;
+		chunk_offset = i * chunk_pixels;
+		chunk_size   = ( recv_pixels - chunk_offset < chunk_pixels ) ? ( recv_pixels - chunk_offset ) : chunk_pixels;
 
-		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_offset * 2 );
+		irecv_persistent( recv_ptr + chunk_offset * pixel_size, chunk_size * pixel_size, MPI_BYTE, \
+				  pair, recv_tag, comm, &irecv[ i ] );
+	}
+
+	for ( i = 0; i < num_send_chunks; i++ )
+	{
+		chunk_offset = i * chunk_pixels;
+		chunk_size   = ( send_pixels - chunk_offset < chunk_pixels ) ? ( send_pixels - chunk_offset ) : chunk_pixels;
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+		isend_persistent( send_ptr + chunk_offset * pixel_size, chunk_size * pixel_size, MPI_BYTE, \
+				  pair, send_tag, comm, &isend[ i ] );
 	}
 
-	return EXIT_SUCCESS;
+	if ( on_arrival == false )
+	{
+		wait_all_requests( (int)( num_send_chunks + num_recv_chunks ), isend, MPI_STATUSES_IGNORE );
+
+		if ( recv_order == OVER ) 
+		{
+			composite_pixels ( image_ID, recv_ptr, pair_ptr, blnd_ptr, recv_pixels );
+		}
+		else
+		{
+			composite_pixels ( image_ID, pair_ptr, recv_ptr, blnd_ptr, recv_pixels );
+		}
+
+		free( isend );
+
+		return EXIT_SUCCESS;
+	}
+
+	//=====================================
+	//  Composite each chunk on arrival
+	//=====================================
+	for ( i = 0; i < num_recv_chunks; i++ )
+	{
+		chunk_offset = i * chunk_pixels;
+		chunk_size   = ( recv_pixels - chunk_offset < chunk_pixels ) ? ( recv_pixels - chunk_offset ) : chunk_pixels;
+
+		wait_request( &irecv[ i ], MPI_STATUS_IGNORE );
 
+		if ( recv_order == OVER ) 
+		{
+			composite_pixels ( image_ID, recv_ptr + chunk_offset * pixel_size, pair_ptr + chunk_offset * pixel_size, \
+					   blnd_ptr + chunk_offset * pixel_size, chunk_size );
+		}
+		else
+		{
+			composite_pixels ( image_ID, pair_ptr + chunk_offset * pixel_size, recv_ptr + chunk_offset * pixel_size, \
+					   blnd_ptr + chunk_offset * pixel_size, chunk_size );
+		}
+	}
+
+	wait_all_requests( (int)num_send_chunks, isend, MPI_STATUSES_IGNORE );
+
+	free( isend );
+
+	return EXIT_SUCCESS;
 }
 
 /*========================================================*/
 /**
  *  @brief Traditional Direct-Send Image Exchange 
  *         between 3 NODES 
- *         (RGBAZ160 Pixels) 
+ *         (RGBA32, RGBA56 and RGBA64 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -886,29 +1573,23 @@ int dsend3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_DSEND [in] MPI Communicator
 */
 /*========================================================*/
-int dsend3_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
-					  unsigned int width, unsigned int height, unsigned int image_type, \
-					  float *my_image, float *temp_image, \
-					  MPI_Comm MPI_COMM_DSEND )
+int dsend3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+			   unsigned int width, unsigned int height, unsigned int image_type, \
+			   BYTE *my_image, BYTE *temp_image, \
+			   MPI_Comm MPI_COMM_DSEND )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
 	int ds_pair;
-	unsigned int ds_image_size, ds_last_image_size, image_size_remainder;
-	unsigned int ds_image_offset, ds_last_image_offset;
-	unsigned int image_size; 
-
+	size_t ds_image_size, ds_last_image_size, image_size_remainder;
+	size_t image_size;
 
-	float* ds_send_image_ptr;
-	float* ds_recv_image_ptr;
-	float* ds_blnd_image_ptr;
+	BYTE* ds_send_image_ptr;
+	BYTE* ds_recv_image_ptr;
+	BYTE* ds_blnd_image_ptr;
 
 	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( DIRECT-SEND )
+	// 			COMPOSITE IMAGES ( DIRECT-SEND )
 	// ====================================================================
-	image_size = width * height;
+	image_size = (size_t)width * height;
 
 	image_size_remainder = image_size % 3;
 	ds_image_size = ceil( image_size / 3 ); 
@@ -922,357 +1603,2027 @@ int dsend3_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
 		ds_last_image_size = ds_image_size + image_size_remainder;
 	}
 
-	ds_image_offset = ds_image_size * RGBAZ; // RGBAZ = Five components
-	ds_last_image_offset = ds_last_image_size * RGBAZ; // RGBAZ = Five components
-
 	if ( my_rank == 0 )
 	{
+		//=====================================
+		//  		Node 0
+		//=====================================
 		ds_pair = 1;
 
 		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ds_image_offset;
+		ds_send_image_ptr += ds_image_size * image_type;
 
 		ds_recv_image_ptr = temp_image;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
 
 		ds_pair = 2;
 
-		ds_send_image_ptr += ds_image_offset;
-		ds_recv_image_ptr += ds_image_offset;
-	
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+		ds_send_image_ptr += ds_image_size * image_type;
+		ds_recv_image_ptr += ds_image_size * image_type;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
 
 		//=====================================
-		//  Image Compositing (Alpha or Depth)
+		//  Image Compositing (2->1->0)
 		//=====================================
 		ds_blnd_image_ptr = temp_image;
 		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_image_size * image_type;
 
 		#ifdef _NOBLEND
 		#else
-		composite_alpha_rgbaz160 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		} 
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
 		#endif
 
-		ds_blnd_image_ptr = temp_image;
+		ds_blnd_image_ptr = my_image;
 		ds_recv_image_ptr = temp_image;
 
 		#ifdef _NOBLEND
 		#else
-		composite_alpha_rgbaz160 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		} 
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
 		#endif
+
 	}
 	else if ( my_rank == 1 )
 	{
+		//=====================================
+		//  		Node 1
+		//=====================================
 		ds_pair = 0;
 
 		ds_send_image_ptr = my_image;
 		ds_recv_image_ptr = temp_image;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-		
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
 
 		ds_pair = 2;
 
-		ds_send_image_ptr += ( ds_image_offset * 2 );
-		ds_recv_image_ptr += ds_image_offset;
-
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &irecv );
+		ds_send_image_ptr += ds_image_size * image_type * 2;
+		ds_recv_image_ptr += ds_image_size * image_type;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
 
 		//=====================================
-		//  Image Compositing (Alpha or Depth)
+		//  Image Compositing (2->1->0)
 		//=====================================
 		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_offset;
+		ds_blnd_image_ptr += ds_image_size * image_type;
 		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_image_size * image_type;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgbaz160 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		#endif
+
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
 
 		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ds_image_offset;
+		ds_blnd_image_ptr += ds_image_size * image_type;
 		ds_recv_image_ptr = temp_image;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgbaz160 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
-		#endif
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
 	}
 	else //  my_rank == 2
 	{
+		//=====================================
+		//  		Node 2
+		//=====================================
 		ds_pair = 0;
 
 		ds_send_image_ptr = my_image;
 		ds_recv_image_ptr = temp_image;
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
-	
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
 
 		ds_pair = 1;
 
-		ds_send_image_ptr += ds_image_offset;
-		ds_recv_image_ptr += ds_last_image_offset;
-
-		MPI_Isend( ds_send_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, MPI_COMM_DSEND, &irecv );
+		ds_send_image_ptr += ds_image_size * image_type;
+		ds_recv_image_ptr += ds_last_image_size * image_type;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
 
 		//=====================================
-		//  Image Compositing (Alpha or Depth)
+		//  Image Compositing (2->1->0)
 		//=====================================
 		ds_blnd_image_ptr = my_image;
-		ds_blnd_image_ptr += ( ds_image_offset * 2 );
-
+		ds_blnd_image_ptr += ds_image_size * image_type * 2;
 		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_last_image_offset;
+		ds_recv_image_ptr += ds_last_image_size * image_type;
 
 		#ifdef _NOBLEND
 		#else
-		composite_alpha_rgbaz160 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
 		#endif
 
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_size * image_type * 2;
 		ds_recv_image_ptr = temp_image;
-
+		
 		#ifdef _NOBLEND
 		#else
-		composite_alpha_rgbaz160 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		if ( image_type == RGBA32 ) // RGBA32
+		{
+			composite_alpha_rgba32 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBA56 ) // RGBA56
+		{
+			composite_alpha_rgba56 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBA64 ) // RGBA64
+		{
+			composite_alpha_rgba64 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
 		#endif
 	}
 
 	//=====================================
-	//  Image Gathering
+	// 	Final Image Gathering
 	//=====================================
 	if ( my_rank == 0 )
 	{
 		ds_pair = 1;
 
-		ds_recv_image_ptr = temp_image;
-		ds_recv_image_ptr += ds_image_offset;
+		ds_recv_image_ptr = my_image;
+		ds_recv_image_ptr += ( ds_image_size * image_type );
 
-		MPI_Irecv( ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
 
 		ds_pair = 2;
-		ds_recv_image_ptr += ds_image_offset;
 
-		MPI_Irecv( ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &irecv );
-		MPI_Wait( &irecv, &status );
+		ds_recv_image_ptr += (ds_image_size * image_type );
+
+		recv_image ( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
 	}
 	else if ( my_rank == 1 )
 	{
 		ds_pair = 0;
 
 		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ds_image_offset;
+		ds_send_image_ptr += ( ds_image_size * image_type );
 
-		MPI_Isend( ds_send_image_ptr, ds_image_size     * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+		send_image ( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
 	}
 	else
 	{
 		ds_pair = 0;
 
 		ds_send_image_ptr = my_image;
-		ds_send_image_ptr += ( ds_image_offset * 2 );
+		ds_send_image_ptr += ( ds_image_size * image_type * 2 );
 
-		MPI_Isend( ds_send_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND, &isend );
-		MPI_Wait( &isend, &status );
+		send_image ( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
 	}
 
 	return EXIT_SUCCESS;
-
 }
 
 /*========================================================*/
 /**
- *  @brief Traditional Binary-Swap Image Exchange 
- *        (RGBA32 and RGBA56 Pixels) 
+ *  @brief Traditional Direct-Send Image Exchange 
+ *         between 3 NODES 
+ *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
  *  @param  width          [in] Image Width
  *  @param  height         [in] Image Height
- *  @param  image_ID       [in] Image Type ID
+ *  @param  image_type     [in] Image Type
  *  @param  my_image       [in] Image Data 
  *  @param  temp_image     [in] Temporary Buffer
- *  @param  bs_offset      [in] Offset for MPI_Gatherv
- *  @param  bs_counts      [in] Counts for MPI_Gatherv
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-				      unsigned int width, unsigned int height, unsigned int image_ID, \
-				      BYTE *my_image, BYTE **comp_image, \
-				      unsigned int *bs_offset, unsigned int *bs_counts, \
-				      MPI_Comm MPI_COMM_BSWAP )
+int dsend3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+			    unsigned int width, unsigned int height, unsigned int image_type, \
+			    BYTE *my_image, BYTE *temp_image, \
+			    MPI_Comm MPI_COMM_DSEND )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int image_size;
-	unsigned int bs_send_image_size;
-	unsigned int bs_recv_image_size;
-
-	BYTE* bs_send_image_ptr;
-	BYTE* bs_pair_image_ptr;
-	BYTE* bs_recv_image_ptr;
-	BYTE* bs_blnd_image_ptr;
-
-	unsigned int bs_pair_offset;
-	unsigned int bs_stage, bs_max_stage;
-	unsigned int bs_pair_node; 
+	int ds_pair;
+	size_t ds_image_size, ds_last_image_size, image_size_remainder;
+	size_t image_size;
 
+	BYTE* ds_send_image_ptr;
+	BYTE* ds_recv_image_ptr;
+	BYTE* ds_blnd_image_ptr;
+	
 	// ====================================================================
-	// 		COMPOSITE IMAGES ( BINARY SWAP )
+	// 			COMPOSITE IMAGES ( DIRECT-SEND )
 	// ====================================================================
-	
-	 // Power of two number of pixels
-	#ifdef _GATHERV	
-		// << MPI_GATHERV >>
-		image_size = width * height;
-	#else 
-		// << MPI_GATHER >>
-		// Add remaining pixels (Blank Pixels) in order to make
-		// image size (number of pixels) divisible by "nnodes"
-		image_size = width * height + global_add_pixels; 
-	#endif
-
-	#ifdef C99
-		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
-	#else
-		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
-	#endif
-	
-	switch ( image_ID ) {
-		case ID_RGBA32: temp_image_byte_ptr = temp_image_rgba32;
-                    break;
-		case ID_RGBA56: temp_image_byte_ptr = temp_image_rgba56;
-                    break;
-		case ID_RGBA64: temp_image_byte_ptr = temp_image_rgba64;
-                    break;
-		case ID_RGBAZ64: temp_image_byte_ptr = temp_image_rgbaz64;
-                     break;
-		case ID_RGBAZ88: temp_image_byte_ptr = temp_image_rgbaz88;
-                     break;
-		case ID_RGBAZ96: temp_image_byte_ptr = temp_image_rgbaz96;
-                     break;
- 	}
+	image_size = (size_t)width * height;
 
-	bs_blnd_image_ptr  = my_image;
-	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
-
-	*bs_offset = (unsigned int)0;
-	*bs_counts = (unsigned int)0;
+	image_size_remainder = image_size % 3;
+	ds_image_size = ceil( image_size / 3 ); 
 
-	bs_recv_image_size = 0;
+	if (( image_size_remainder ) == 0 ) 
+	{
+		ds_last_image_size = ds_image_size;
+	} 
+	else 
+	{
+		ds_last_image_size = ds_image_size + image_size_remainder;
+	}
 
-	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	if ( my_rank == 0 )
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		//=====================================
+		//  		Node 0
+		//=====================================
+		ds_pair = 1;
 
-		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
-		{
-			//=====================================
-			//  		LEFT NODE of pair
-			//=====================================
-			bs_pair_node = my_rank + bs_pair_offset;
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ( ds_image_size * image_type );
 
-			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size + 1;
-				}
-			#else
-				// << MPI_GATHER >>
-				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_send_image_size -= global_add_pixels;
-				}
-			#endif
+		ds_recv_image_ptr = temp_image;
 
-			bs_pair_image_ptr  = bs_blnd_image_ptr;
-			bs_recv_image_ptr  = temp_image_byte_ptr;
-			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * global_image_type );
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		ds_pair = 2;
 
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+		ds_send_image_ptr += ( ds_image_size * image_type );
+		ds_recv_image_ptr += ( ds_image_size * image_type );
 
-			#ifdef _NOBLEND
-			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			// Assuming bs_pair_image_ptr (OVER) and bs_recv_image_ptr (UNDER)
-			if ( image_ID == ID_RGBA32 ) 
-			{
-				#ifdef _LUTBLEND
-					composite_alpha_rgba32 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#elif defined _BLENDF
-					composite_alpha_rgba32f ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#else
-					composite_alpha_rgba32_LUT ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#endif
-			}
-			else if ( image_ID == ID_RGBA56 ) 
-			{
-				composite_alpha_rgba56 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBA64 ) 
-			{
-				composite_alpha_rgba64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			#endif
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
 
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
-		}
-		else // RIGHT NODE
-		{		
-			//=====================================
-			//  		RIGHT NODE of pair
+		//=====================================
+		//  Image Compositing (2->1->0)
+		//  2 and 1: temp_image
+		//  0: my_image
+		//=====================================
+		ds_blnd_image_ptr = temp_image;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ( ds_image_size * image_type );
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		#endif
+	}
+	else if ( my_rank == 1 )
+	{
+		//=====================================
+		//  		Node 1
+		//=====================================
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+
+		ds_send_image_ptr += ds_image_size * image_type * 2;
+		ds_recv_image_ptr += ds_image_size * image_type;
+
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * image_type, ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (2->1->0)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_size * image_type;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_image_size * image_type;
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_size * image_type;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		}
+		#endif
+	}
+	else //  my_rank == 2
+	{
+		//=====================================
+		//  		Node 2
+		//=====================================
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 1;
+
+		ds_send_image_ptr += ds_image_size * image_type;
+		ds_recv_image_ptr += ds_last_image_size * image_type;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * image_type, ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (2->1->0)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_size * image_type * 2;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_last_image_size * image_type;
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_size * image_type * 2;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBAZ64 ) // RGBAZ64
+		{
+			composite_alpha_rgbaz64_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBAZ88 ) // RGBAZ88
+		{
+			composite_alpha_rgbaz88_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		else if ( image_type == RGBAZ96 ) // RGBAZ96
+		{
+			composite_alpha_rgbaz96_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		}
+		#endif
+	}
+
+	//=====================================
+	// 	Final Image Gathering
+	//=====================================
+	if ( my_rank == 0 )
+	{
+		ds_pair = 1;
+
+		ds_recv_image_ptr = my_image;
+		ds_recv_image_ptr += ds_image_size * image_type;
+
+		recv_image ( ds_recv_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+		ds_recv_image_ptr += ds_image_size * image_type;
+
+		recv_image ( ds_recv_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else if ( my_rank == 1 )
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ( ds_image_size * image_type );
+
+		send_image ( ds_send_image_ptr, ds_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else // my_rank = 2
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ( ds_image_size * image_type * 2 );
+
+		send_image ( ds_send_image_ptr, ds_last_image_size * image_type, MPI_BYTE, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+
+
+/*========================================================*/
+/**
+ *  @brief Traditional Direct-Send Image Exchange 
+ *         between 3 NODES 
+ *         (RGBA128 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_type     [in] Image Type
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  MPI_COMM_DSEND [in] MPI Communicator
+*/
+/*========================================================*/
+int dsend3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+					 unsigned int width, unsigned int height, unsigned int image_type, \
+					 float *my_image, float *temp_image, \
+					 MPI_Comm MPI_COMM_DSEND )
+{
+	int ds_pair;
+	size_t ds_image_size, ds_last_image_size, image_size_remainder;
+	size_t ds_image_offset, ds_last_image_offset;
+	size_t image_size; 
+
+
+	float* ds_send_image_ptr;
+	float* ds_recv_image_ptr;
+	float* ds_blnd_image_ptr;
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( DIRECT-SEND )
+	// ====================================================================
+	image_size = (size_t)width * height;
+
+	image_size_remainder = image_size % 3;
+	ds_image_size = ceil( image_size / 3 ); 
+
+	if (( image_size_remainder ) == 0 ) 
+	{
+		ds_last_image_size = ds_image_size;
+	} 
+	else 
+	{
+		ds_last_image_size = ds_image_size + image_size_remainder;
+	}
+
+	ds_image_offset = ds_image_size * RGBA; // RGBA = Four components
+	ds_last_image_offset = ds_last_image_size * RGBA; // RGBA = Four components
+
+	if ( my_rank == 0 )
+	{
+		ds_pair = 1;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ds_image_offset;
+
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * RGBA, ds_recv_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+
+		ds_send_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_image_offset;
+	
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * RGBA, ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = temp_image;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		composite_alpha_rgba128 ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+
+		ds_blnd_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+		composite_alpha_rgba128 ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+	}
+	else if ( my_rank == 1 )
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * RGBA, ds_recv_image_ptr, ds_image_size * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+
+		ds_send_image_ptr += ( ds_image_offset * 2 );
+		ds_recv_image_ptr += ds_image_offset;
+
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * RGBA, ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_offset;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgba128 ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_offset;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgba128 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+	}
+	else //  my_rank == 2
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size      * RGBA, ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 1;
+
+		ds_send_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_last_image_offset;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size      * RGBA, ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ( ds_image_offset * 2 );
+
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_last_image_offset;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgba128 ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		#endif
+
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgba128 ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		#endif
+	}
+
+	//=====================================
+	//  Image Gathering
+	//=====================================
+	if ( my_rank == 0 )
+	{
+		ds_pair = 1;
+
+		ds_recv_image_ptr = my_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		recv_image ( ds_recv_image_ptr, ds_image_size      * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+		ds_recv_image_ptr += ds_image_offset;
+
+		recv_image ( ds_recv_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else if ( my_rank == 1 )
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ds_image_offset;
+
+		send_image ( ds_send_image_ptr, ds_image_size     * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ( ds_image_offset * 2 );
+
+		send_image ( ds_send_image_ptr, ds_last_image_size * RGBA, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+
+	return EXIT_SUCCESS;
+
+}
+
+/*========================================================*/
+/**
+ *  @brief Traditional Direct-Send Image Exchange 
+ *         between 3 NODES 
+ *         (RGBAZ160 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_type     [in] Image Type
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  MPI_COMM_DSEND [in] MPI Communicator
+*/
+/*========================================================*/
+int dsend3_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
+					  unsigned int width, unsigned int height, unsigned int image_type, \
+					  float *my_image, float *temp_image, \
+					  MPI_Comm MPI_COMM_DSEND )
+{
+	int ds_pair;
+	size_t ds_image_size, ds_last_image_size, image_size_remainder;
+	size_t ds_image_offset, ds_last_image_offset;
+	size_t image_size; 
+
+
+	float* ds_send_image_ptr;
+	float* ds_recv_image_ptr;
+	float* ds_blnd_image_ptr;
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( DIRECT-SEND )
+	// ====================================================================
+	image_size = (size_t)width * height;
+
+	image_size_remainder = image_size % 3;
+	ds_image_size = ceil( image_size / 3 ); 
+
+	if (( image_size_remainder ) == 0 ) 
+	{
+		ds_last_image_size = ds_image_size;
+	} 
+	else 
+	{
+		ds_last_image_size = ds_image_size + image_size_remainder;
+	}
+
+	ds_image_offset = ds_image_size * RGBAZ; // RGBAZ = Five components
+	ds_last_image_offset = ds_last_image_size * RGBAZ; // RGBAZ = Five components
+
+	if ( my_rank == 0 )
+	{
+		ds_pair = 1;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ds_image_offset;
+
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * RGBAZ, ds_recv_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+
+		ds_send_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_image_offset;
+	
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * RGBAZ, ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = temp_image;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( temp_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( my_image, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+	}
+	else if ( my_rank == 1 )
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size * RGBAZ, ds_recv_image_ptr, ds_image_size * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+
+		ds_send_image_ptr += ( ds_image_offset * 2 );
+		ds_recv_image_ptr += ds_image_offset;
+
+		exchange_image ( ds_send_image_ptr, ds_last_image_size * RGBAZ, ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, SEND_TAG, RECV_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_offset;
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( ds_blnd_image_ptr, ds_recv_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ds_image_offset;
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_image_size );
+		#endif
+	}
+	else //  my_rank == 2
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_recv_image_ptr = temp_image;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size      * RGBAZ, ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 1;
+
+		ds_send_image_ptr += ds_image_offset;
+		ds_recv_image_ptr += ds_last_image_offset;
+
+		exchange_image ( ds_send_image_ptr, ds_image_size      * RGBAZ, ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, RECV_TAG, SEND_TAG, MPI_COMM_DSEND );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		ds_blnd_image_ptr = my_image;
+		ds_blnd_image_ptr += ( ds_image_offset * 2 );
+
+		ds_recv_image_ptr = temp_image;
+		ds_recv_image_ptr += ds_last_image_offset;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( ds_recv_image_ptr, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		#endif
+
+		ds_recv_image_ptr = temp_image;
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( temp_image, ds_blnd_image_ptr, ds_blnd_image_ptr, ds_last_image_size );
+		#endif
+	}
+
+	//=====================================
+	//  Image Gathering
+	//=====================================
+	if ( my_rank == 0 )
+	{
+		ds_pair = 1;
+
+		ds_recv_image_ptr = my_image;
+		ds_recv_image_ptr += ds_image_offset;
+
+		recv_image ( ds_recv_image_ptr, ds_image_size      * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+
+		ds_pair = 2;
+		ds_recv_image_ptr += ds_image_offset;
+
+		recv_image ( ds_recv_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else if ( my_rank == 1 )
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ds_image_offset;
+
+		send_image ( ds_send_image_ptr, ds_image_size     * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+	else
+	{
+		ds_pair = 0;
+
+		ds_send_image_ptr = my_image;
+		ds_send_image_ptr += ( ds_image_offset * 2 );
+
+		send_image ( ds_send_image_ptr, ds_last_image_size * RGBAZ, MPI_FLOAT, ds_pair, PAIR_TAG, MPI_COMM_DSEND );
+	}
+
+	return EXIT_SUCCESS;
+
+}
+
+/*========================================================*/
+/**
+ *  @brief Traditional Binary-Swap Image Exchange 
+ *        (RGBA32 and RGBA56 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_ID       [in] Image Type ID
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  bs_offset      [in] Offset for MPI_Gatherv
+ *  @param  bs_counts      [in] Counts for MPI_Gatherv
+ *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+*/
+/*========================================================*/
+int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+				      unsigned int width, unsigned int height, unsigned int image_ID, \
+				      BYTE *my_image, BYTE **comp_image, \
+				      unsigned int *bs_offset, unsigned int *bs_counts, \
+				      MPI_Comm MPI_COMM_BSWAP )
+{
+	size_t image_size;
+	size_t bs_send_image_size;
+	size_t bs_recv_image_size;
+
+	BYTE* bs_send_image_ptr;
+	BYTE* bs_pair_image_ptr;
+	BYTE* bs_recv_image_ptr;
+	BYTE* bs_blnd_image_ptr;
+
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+	BYTE* bs_span_image_ptr;
+
+	_Bool bs_sparse;
+
+	unsigned int bs_pair_offset;
+	unsigned int bs_stage, bs_max_stage;
+	unsigned int bs_pair_node; 
+	unsigned int bs_num_segments;
+
+	_Bool bs_roi;
+
+	// ====================================================================
+	// 		COMPOSITE IMAGES ( BINARY SWAP )
+	// ====================================================================
+	
+	 // Power of two number of pixels
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		image_size = (size_t)width * height;
+	#else 
+		// << MPI_GATHER >>
+		// Add remaining pixels (Blank Pixels) in order to make
+		// image size (number of pixels) divisible by "nnodes"
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	#ifdef C99
+		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
+	#else
+		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+	#endif
+	
+	switch ( image_ID ) {
+		case ID_RGBA32: temp_image_byte_ptr = temp_image_rgba32;
+                    break;
+		case ID_RGBA56: temp_image_byte_ptr = temp_image_rgba56;
+                    break;
+		case ID_RGBA64: temp_image_byte_ptr = temp_image_rgba64;
+                    break;
+		case ID_RGBAZ64: temp_image_byte_ptr = temp_image_rgbaz64;
+                     break;
+		case ID_RGBAZ88: temp_image_byte_ptr = temp_image_rgbaz88;
+                     break;
+		case ID_RGBAZ96: temp_image_byte_ptr = temp_image_rgbaz96;
+                     break;
+ 	}
+
+	// Active-pixel span exchange (RGBA32 Pixels)
+	bs_sparse = (( image_ID == ID_RGBA32 ) && ( global_merge_ID == ALPHA_SPARSE ));
+
+	// Exchange only the pixels inside the ROI
+	bs_roi = (( global_merge_ID == ALPHA_ROI ) || ( global_merge_ID == DEPTH_ROI ));
+
+	bs_blnd_image_ptr  = my_image;
+	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
+
+	*bs_offset = (unsigned int)0;
+	*bs_counts = (unsigned int)0;
+
+	bs_recv_image_size = 0;
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( bs_sparse == false ) && \
+		       ( bs_roi == false ) && \
+		       ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( image_ID, global_image_type );
+
+	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	{
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
+
+		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
+		{
+			//=====================================
+			//  		LEFT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank + bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_send_image_size -= global_add_pixels;
+				}
+			#endif
+
+			bs_pair_image_ptr  = bs_blnd_image_ptr;
+			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_send_image_ptr  = bs_pair_image_ptr ;
+			bs_send_image_ptr += ( bs_recv_image_size * global_image_type );
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_sparse == true )
+			{
+				exchange_image_spans ( bs_send_image_ptr, bs_send_image_size, global_image_type, &bs_span_image_ptr, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				if ( bs_roi == true )
+				{
+					exchange_image_roi ( bs_send_image_ptr, *bs_offset + bs_recv_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+							     bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+							     bs_pair_offset, global_image_type, width, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+				}
+				else
+				{
+					if ( bs_chunked == true )
+					{
+						exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+									   bs_pair_image_ptr, bs_blnd_image_ptr, UNDER, image_ID, global_image_type, bs_chunk_pixels, \
+									   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+					}
+					else
+					{
+						exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+					}
+				}
+			}
+
+			#ifdef _NOBLEND
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			// Assuming bs_pair_image_ptr (OVER) and bs_recv_image_ptr (UNDER)
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_sparse == true )
+				{
+					composite_alpha_rgba32_span ( bs_span_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size, UNDER );
+				}
+				else if ( bs_roi == true )
+				{
+					composite_roi_segments_BYTE ( image_ID, UNDER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else if ( image_ID == ID_RGBA32 ) 
+				{
+					#ifdef _LUTBLEND
+						composite_alpha_rgba32 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#elif defined _BLENDF
+						composite_alpha_rgba32f ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#else
+						composite_alpha_rgba32_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#endif
+				}
+				else if ( image_ID == ID_RGBA56 ) 
+				{
+					composite_alpha_rgba56 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBA64 ) 
+				{
+					composite_alpha_rgba64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
+		}
+		else // RIGHT NODE
+		{		
+			//=====================================
+			//  		RIGHT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank - bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_send_image_size *= 0.5;
+					bs_recv_image_size  = bs_send_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+
+				//=====================================
+				//  Offset for Image Gathering
+				//=====================================
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_recv_image_size -= global_add_pixels;
+				}
+			#endif
+
+			//=====================================
+			//  Offset for Image Gathering
+			//=====================================
+			*bs_offset += bs_send_image_size;
+			
+			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_send_image_ptr  = bs_blnd_image_ptr;
+			bs_pair_image_ptr  = bs_send_image_ptr ;
+			bs_pair_image_ptr += ( bs_send_image_size * global_image_type );
+
+			// Blank pixels added for MPI_Gather are not part of my_image: 
+			// the pair half is composited into the temporary buffer
+			if (( bs_stage == 0 ) && ( global_add_pixels > 0 )) {
+				bs_blnd_image_ptr  = temp_image_byte_ptr;
+				bs_blnd_image_ptr += ( bs_send_image_size * global_image_type );
+			}
+			else
+			{
+				bs_blnd_image_ptr  = bs_pair_image_ptr;
+			}
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_sparse == true )
+			{
+				exchange_image_spans ( bs_send_image_ptr, bs_send_image_size, global_image_type, &bs_span_image_ptr, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				if ( bs_roi == true )
+				{
+					exchange_image_roi ( bs_send_image_ptr, *bs_offset - bs_send_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+							     bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+							     bs_pair_offset, global_image_type, width, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+				}
+				else
+				{
+					if ( bs_chunked == true )
+					{
+						exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+									   bs_pair_image_ptr, bs_blnd_image_ptr, OVER, image_ID, global_image_type, bs_chunk_pixels, \
+									   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+					}
+					else
+					{
+						exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+					}
+				}
+			}
+
+			#ifdef _NOBLEND
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			// Assuming bs_recv_image_ptr (OVER) and bs_pair_image_ptr (UNDER)
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_sparse == true )
+				{
+					composite_alpha_rgba32_span ( bs_span_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size, OVER );
+				}
+				else if ( bs_roi == true )
+				{
+					if ( bs_blnd_image_ptr != bs_pair_image_ptr )
+					{
+						memcpy( bs_blnd_image_ptr, bs_pair_image_ptr, bs_recv_image_size * global_image_type );
+					}
+					composite_roi_segments_BYTE ( image_ID, OVER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else if ( image_ID == ID_RGBA32 ) 
+				{
+					#ifdef _LUTBLEND
+						composite_alpha_rgba32 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#elif defined _BLENDF
+						composite_alpha_rgba32f ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#else
+						composite_alpha_rgba32_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#endif
+				}
+				else if ( image_ID == ID_RGBA56 ) 
+				{
+					composite_alpha_rgba56 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBA64 ) 
+				{
+					composite_alpha_rgba64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif // #ifdef _NOBLEND
+		}
+	}
+
+	*bs_counts = bs_recv_image_size;
+	*comp_image = (BYTE *)bs_blnd_image_ptr;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Traditional Binary-Swap Image Exchange 
+ *        (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_ID       [in] Image Type ID
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  bs_offset      [in] Offset for MPI_Gatherv
+ *  @param  bs_counts      [in] Counts for MPI_Gatherv
+ *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+*/
+/*========================================================*/
+int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+				       unsigned int width, unsigned int height, unsigned int image_ID, \
+				       BYTE *my_image, BYTE **comp_image, \
+				       unsigned int *bs_offset, unsigned int *bs_counts, \
+				       MPI_Comm MPI_COMM_BSWAP )
+{
+	size_t image_size;
+	size_t bs_send_image_size;
+	size_t bs_recv_image_size;
+
+	BYTE* bs_send_image_ptr;
+	BYTE* bs_pair_image_ptr;
+	BYTE* bs_recv_image_ptr;
+	BYTE* bs_blnd_image_ptr;
+
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+
+	unsigned int bs_pair_offset;
+	unsigned int bs_stage, bs_max_stage;
+	unsigned int bs_pair_node; 
+	unsigned int bs_num_segments;
+
+	_Bool bs_roi;
+
+	// =======================================  
+	//     COMPOSITE IMAGES ( BINARY SWAP )
+	// =======================================  
+	 // Power of two number of pixels
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		image_size = (size_t)width * height;
+	#else 
+		// << MPI_GATHER >>
+		// Add remaining pixels (Blank Pixels) in order to make
+		// image size (number of pixels) divisible by "nnodes"
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	#ifdef C99
+		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
+	#else
+		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+	#endif
+
+	switch ( image_ID ) {
+		case ID_RGBA32:  temp_image_byte_ptr = temp_image_rgba32;
+				   global_image_type   = RGBA32; 	
+		                 break;
+		case ID_RGBA56:  temp_image_byte_ptr = temp_image_rgba56;
+				   global_image_type   = RGBA56; 	
+                    		   break;
+		case ID_RGBA64:  temp_image_byte_ptr = temp_image_rgba64;
+				   global_image_type   = RGBA64; 	
+                   		   break;
+		case ID_RGBAZ64: temp_image_byte_ptr = temp_image_rgbaz64;
+		   		   global_image_type   = RGBAZ64; 	
+                     	   break;
+		case ID_RGBAZ88: temp_image_byte_ptr = temp_image_rgbaz88;
+				   global_image_type   = RGBAZ88; 	
+                     	   break;
+		case ID_RGBAZ96: temp_image_byte_ptr = temp_image_rgbaz96;
+				   global_image_type   = RGBAZ96; 	
+		                 break;
+ 	}
+
+	// Exchange only the pixels inside the ROI
+	bs_roi = (( global_merge_ID == ALPHA_ROI ) || ( global_merge_ID == DEPTH_ROI ));
+
+	bs_blnd_image_ptr  = my_image;
+	bs_send_image_size = image_size;
+
+	*bs_offset = (unsigned int)0;
+	*bs_counts = (unsigned int)0;
+
+	bs_recv_image_size = 0;
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( bs_roi == false ) && \
+		       ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( image_ID, global_image_type );
+
+	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	{
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
+
+		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
+		{
+			//=====================================
+			//  		LEFT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank + bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_send_image_size -= global_add_pixels;
+				}
+			#endif
+
+			bs_pair_image_ptr  = bs_blnd_image_ptr;
+			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_send_image_ptr  = bs_pair_image_ptr ;
+			bs_send_image_ptr += ( bs_recv_image_size * global_image_type );
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( bs_send_image_ptr, *bs_offset + bs_recv_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, global_image_type, width, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+								   bs_pair_image_ptr, bs_blnd_image_ptr, UNDER, image_ID, global_image_type, bs_chunk_pixels, \
+								   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+			}
+
+			#ifdef _NOBLEND
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			// Assuming bs_pair_image_ptr (OVER) and bs_recv_image_ptr (UNDER)
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_roi == true )
+				{
+					composite_roi_segments_BYTE ( image_ID, UNDER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else if ( image_ID == ID_RGBAZ64 ) 
+				{
+					composite_alpha_rgbaz64_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ88 ) 
+				{
+					composite_alpha_rgbaz88_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ96 ) 
+				{
+					composite_alpha_rgbaz96_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
+		}
+		else // RIGHT NODE
+		{		
+			//=====================================
+			//  		RIGHT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank - bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_recv_image_size -= global_add_pixels;
+				}
+			#endif
+
+			//=====================================
+			//  Offset for Image Gathering
+			//=====================================
+			*bs_offset += bs_send_image_size;
+			
+			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_send_image_ptr  = bs_blnd_image_ptr;
+			bs_pair_image_ptr  = bs_send_image_ptr ;
+			bs_pair_image_ptr += ( bs_send_image_size * global_image_type );
+
+			// Blank pixels added for MPI_Gather are not part of my_image: 
+			// the pair half is composited into the temporary buffer
+			if (( bs_stage == 0 ) && ( global_add_pixels > 0 )) {
+				bs_blnd_image_ptr  = temp_image_byte_ptr;
+				bs_blnd_image_ptr += ( bs_send_image_size * global_image_type );
+			}
+			else
+			{
+				bs_blnd_image_ptr  = bs_pair_image_ptr;
+			}
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( bs_send_image_ptr, *bs_offset - bs_send_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, global_image_type, width, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+								   bs_pair_image_ptr, bs_blnd_image_ptr, OVER, image_ID, global_image_type, bs_chunk_pixels, \
+								   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+			}
+
+			#ifdef _NOBLEND
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			// Assuming bs_recv_image_ptr (OVER) and bs_pair_image_ptr (UNDER)
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_roi == true )
+				{
+					if ( bs_blnd_image_ptr != bs_pair_image_ptr )
+					{
+						memcpy( bs_blnd_image_ptr, bs_pair_image_ptr, bs_recv_image_size * global_image_type );
+					}
+					composite_roi_segments_BYTE ( image_ID, OVER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else if ( image_ID == ID_RGBAZ64 ) 
+				{
+					composite_alpha_rgbaz64_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ88 ) 
+				{
+					composite_alpha_rgbaz88_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ96 ) 
+				{
+					composite_alpha_rgbaz96_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif
+		}
+	}
+
+	*bs_counts  = bs_recv_image_size;
+	*comp_image = (BYTE *)bs_blnd_image_ptr;
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Traditional Binary-Swap Image Exchange 
+ *        (RGBA128 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_type     [in] Image Type
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  bs_offset      [in] Offset for MPI_Gatherv
+ *  @param  bs_counts      [in] Counts for MPI_Gatherv
+ *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+*/
+/*========================================================*/
+int bswap_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+				    unsigned int width, unsigned int height, unsigned int image_type, \
+				    float *my_image, float **comp_image, \
+					unsigned int *bs_offset, unsigned int *bs_counts, \
+					MPI_Comm MPI_COMM_BSWAP )
+{
+	size_t image_size;
+	size_t bs_send_image_size;
+	size_t bs_recv_image_size;
+
+	float* bs_send_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_blnd_image_ptr;
+
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+
+	unsigned int bs_pair_offset;
+	unsigned int bs_stage, bs_max_stage;
+	unsigned int bs_pair_node; 
+	unsigned int bs_num_segments;
+
+	_Bool bs_roi;
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// ====================================================================
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		image_size = (size_t)width * height;
+	#else 
+		// << MPI_GATHER >>
+		// Add remaining pixels (Blank Pixels) in order to make
+		// image size (number of pixels) divisible by "nnodes"
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	#ifdef C99
+		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
+	#else
+		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+	#endif
+
+	// Exchange only the pixels inside the ROI
+	bs_roi = (( global_merge_ID == ALPHA_ROI ) || ( global_merge_ID == DEPTH_ROI ));
+
+	bs_blnd_image_ptr  = my_image;
+	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
+
+	*bs_counts = (unsigned int)0;
+	*bs_offset = (unsigned int)0;
+
+	bs_recv_image_size = 0;
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( bs_roi == false ) && \
+		       ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( ID_RGBA128, RGBA128 );
+
+	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	{
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
+
+		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
+		{
+			//=====================================
+			//  		LEFT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank + bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_send_image_size -= global_add_pixels;
+				}
+			#endif
+
+			bs_pair_image_ptr  = bs_blnd_image_ptr;
+			bs_recv_image_ptr  = temp_image_rgba128;
+			bs_send_image_ptr  = bs_pair_image_ptr ;
+			bs_send_image_ptr += ( bs_recv_image_size * RGBA );
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( (BYTE *)bs_send_image_ptr, *bs_offset + bs_recv_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     (BYTE *)bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, RGBA * sizeof(float), width, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+								   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, UNDER, ID_RGBA128, RGBA128, bs_chunk_pixels, \
+								   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+			}
+
+			#ifdef _NOBLEND
+			//=====================================
+			//  Do nothing (for benchmarking)
+			//=====================================
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_roi == true )
+				{
+					composite_roi_segments_FLOAT ( ID_RGBA128, UNDER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else
+				{
+					composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif // #ifdef _NOBLEND
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
+		}
+		else // RIGHT NODE 
+		{		
+			//=====================================
+			//  		RIGHT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank - bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_recv_image_size -= global_add_pixels;
+				}
+			#endif
+
+			//=====================================
+			//  Offset for Image Gathering
+			//=====================================
+			*bs_offset += bs_send_image_size;
+
+			bs_recv_image_ptr  = temp_image_rgba128;
+			bs_send_image_ptr  = bs_blnd_image_ptr;
+			bs_pair_image_ptr  = bs_send_image_ptr ;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+
+			// Blank pixels added for MPI_Gather are not part of my_image: 
+			// the pair half is composited into the temporary buffer
+			if (( bs_stage == 0 ) && ( global_add_pixels > 0 )) {
+				bs_blnd_image_ptr  = temp_image_rgba128;
+				bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+			}
+			else
+			{
+				bs_blnd_image_ptr  = bs_pair_image_ptr;
+			}
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( (BYTE *)bs_send_image_ptr, *bs_offset - bs_send_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     (BYTE *)bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, RGBA * sizeof(float), width, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+								   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, OVER, ID_RGBA128, RGBA128, bs_chunk_pixels, \
+								   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+			}
+
+			#ifdef _NOBLEND
+			//=====================================
+			//  Do nothing (for benchmarking)
+			//=====================================
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_roi == true )
+				{
+					if ( bs_blnd_image_ptr != bs_pair_image_ptr )
+					{
+						memcpy( bs_blnd_image_ptr, bs_pair_image_ptr, bs_recv_image_size * RGBA * sizeof(float) );
+					}
+					composite_roi_segments_FLOAT ( ID_RGBA128, OVER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else
+				{
+					composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif // #ifdef _NOBLEND
+	
+			#ifdef _GATHERV
+				bs_send_image_size = bs_recv_image_size;
+			#endif
+		}
+	}
+
+	*bs_counts = bs_recv_image_size;
+	*comp_image = (float *)bs_blnd_image_ptr;	
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Traditional Binary-Swap Image Exchange 
+ *        (RGBAZ160 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_type     [in] Image Type
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  bs_offset      [in] Offset for MPI_Gatherv
+ *  @param  bs_counts      [in] Counts for MPI_Gatherv
+ *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+*/
+/*========================================================*/
+int bswap_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
+				     unsigned int width, unsigned int height, unsigned int image_type, \
+				     float *my_image, float **comp_image, \
+					 unsigned int *bs_offset, unsigned int *bs_counts, \
+					 MPI_Comm MPI_COMM_BSWAP )
+{
+	size_t image_size;
+	size_t bs_send_image_size;
+	size_t bs_recv_image_size;
+
+	float* bs_send_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_blnd_image_ptr;
+
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+
+	unsigned int bs_pair_offset;
+	unsigned int bs_stage, bs_max_stage;
+	unsigned int bs_pair_node; 
+	unsigned int bs_num_segments;
+
+	_Bool bs_roi;
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// ====================================================================
+	 // Power of two number of pixels
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		image_size = (size_t)width * height;
+	#else 
+		// << MPI_GATHER >>
+		// Add remaining pixels (Blank Pixels) in order to make
+		// image size (number of pixels) divisible by "nnodes"
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	#ifdef C99
+		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
+	#else
+		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+	#endif
+
+	// Exchange only the pixels inside the ROI
+	bs_roi = (( global_merge_ID == ALPHA_ROI ) || ( global_merge_ID == DEPTH_ROI ));
+
+	bs_blnd_image_ptr  = my_image;
+	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
+
+	*bs_counts = (unsigned int)0;
+	*bs_offset = (unsigned int)0;
+
+	bs_recv_image_size = 0;
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( bs_roi == false ) && \
+		       ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( ID_RGBAZ160, RGBAZ160 );
+
+	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	{
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
+
+		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
+		{
+			//=====================================
+			//  		LEFT NODE of pair
+			//=====================================
+			bs_pair_node = my_rank + bs_pair_offset;
+
+			#ifdef _GATHERV	
+				// << MPI_GATHERV >>
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size;
+				}
+				else // ODD number of pixels
+				{
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = bs_recv_image_size + 1;
+				}
+			#else
+				// << MPI_GATHER >>
+				// Always EVEN number of pixels
+				bs_recv_image_size = bs_send_image_size * 0.5;
+				bs_send_image_size = bs_recv_image_size;
+				// In the first stage there is a need to send correct 
+				// amount of remaining pixels
+				if ( bs_stage == 0 ) {
+					bs_send_image_size -= global_add_pixels;
+				}
+			#endif
+
+			bs_pair_image_ptr  = bs_blnd_image_ptr;
+			bs_recv_image_ptr  = temp_image_rgbaz160;
+			bs_send_image_ptr  = bs_pair_image_ptr ;
+			bs_send_image_ptr += ( bs_recv_image_size * RGBAZ );
+
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( (BYTE *)bs_send_image_ptr, *bs_offset + bs_recv_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     (BYTE *)bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, RGBAZ * sizeof(float), width, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+								   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, UNDER, ID_RGBAZ160, RGBAZ160, bs_chunk_pixels, \
+								   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+			}
+
+			#ifdef _NOBLEND
+			//=====================================
+			//  Do nothing (for benchmarking)
+			//=====================================
+			#else
+			//=====================================
+			//  Image Compositing (Alpha or Depth)
+			//=====================================
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				if ( bs_roi == true )
+				{
+					composite_roi_segments_FLOAT ( ID_RGBAZ160, UNDER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else
+				{
+					composite_alpha_rgbaz160_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+			}
+			#endif // #ifdef _NOBLEND
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
+		}
+		else // RIGHT NODE 
+		{		
+			//=====================================
+			//  		RIGHT NODE of pair
 			//=====================================
 			bs_pair_node = my_rank - bs_pair_offset;
 
@@ -1280,8 +3631,8 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 				// << MPI_GATHERV >>
 				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
-					bs_send_image_size *= 0.5;
-					bs_recv_image_size  = bs_send_image_size;
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size;
 				}
 				else // ODD number of pixels
 				{
@@ -1294,9 +3645,6 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 				bs_recv_image_size = bs_send_image_size * 0.5;
 				bs_send_image_size = bs_recv_image_size;
 
-				//=====================================
-				//  Offset for Image Gathering
-				//=====================================
 				// In the first stage there is a need to send correct 
 				// amount of remaining pixels
 				if ( bs_stage == 0 ) {
@@ -1308,15 +3656,17 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//  Offset for Image Gathering
 			//=====================================
 			*bs_offset += bs_send_image_size;
-			
-			bs_recv_image_ptr  = temp_image_byte_ptr;
+
+			bs_recv_image_ptr  = temp_image_rgbaz160;
 			bs_send_image_ptr  = bs_blnd_image_ptr;
 			bs_pair_image_ptr  = bs_send_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * global_image_type );
+			bs_pair_image_ptr += ( bs_send_image_size * RGBAZ );
 
-			if ( bs_stage == 0 ) {
-				bs_blnd_image_ptr  = temp_image_byte_ptr;
-				bs_blnd_image_ptr += ( bs_send_image_size * global_image_type );
+			// Blank pixels added for MPI_Gather are not part of my_image: 
+			// the pair half is composited into the temporary buffer
+			if (( bs_stage == 0 ) && ( global_add_pixels > 0 )) {
+				bs_blnd_image_ptr  = temp_image_rgbaz160;
+				bs_blnd_image_ptr += ( bs_send_image_size * RGBAZ );
 			}
 			else
 			{
@@ -1326,42 +3676,59 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+			if ( bs_roi == true )
+			{
+				exchange_image_roi ( (BYTE *)bs_send_image_ptr, *bs_offset - bs_send_image_size, bs_send_image_size, my_rank - ( my_rank % bs_pair_offset ), \
+						     (BYTE *)bs_recv_image_ptr, *bs_offset, bs_recv_image_size, bs_pair_node - ( bs_pair_node % bs_pair_offset ), \
+						     bs_pair_offset, RGBAZ * sizeof(float), width, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP, &bs_num_segments );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+								   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, OVER, ID_RGBAZ160, RGBAZ160, bs_chunk_pixels, \
+								   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+			}
 
 			#ifdef _NOBLEND
+			//=====================================
+			//  Do nothing (for benchmarking)
+			//=====================================
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			// Assuming bs_recv_image_ptr (OVER) and bs_pair_image_ptr (UNDER)
-			if ( image_ID == ID_RGBA32 ) 
-			{
-				#ifdef _LUTBLEND
-					composite_alpha_rgba32 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#elif defined _BLENDF
-					composite_alpha_rgba32f ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#else
-					composite_alpha_rgba32_LUT ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#endif
-			}
-			else if ( image_ID == ID_RGBA56 ) 
-			{
-				composite_alpha_rgba56 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBA64 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgba64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				if ( bs_roi == true )
+				{
+					if ( bs_blnd_image_ptr != bs_pair_image_ptr )
+					{
+						memcpy( bs_blnd_image_ptr, bs_pair_image_ptr, bs_recv_image_size * RGBAZ * sizeof(float) );
+					}
+					composite_roi_segments_FLOAT ( ID_RGBAZ160, OVER, bs_recv_image_ptr, bs_blnd_image_ptr, bs_num_segments );
+				}
+				else
+				{
+					composite_alpha_rgbaz160_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
 			}
 			#endif // #ifdef _NOBLEND
+	
+			#ifdef _GATHERV
+				bs_send_image_size = bs_recv_image_size;
+			#endif
 		}
 	}
 
 	*bs_counts = bs_recv_image_size;
-	*comp_image = (BYTE *)bs_blnd_image_ptr;
+	*comp_image = (float *)bs_blnd_image_ptr;	
 
 	return EXIT_SUCCESS;
 }
@@ -1369,13 +3736,14 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
- *        (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *         From STAGE 2, After 234Composition
+ *         (RGBA32, RGBA56 and RGBA64 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
  *  @param  width          [in] Image Width
  *  @param  height         [in] Image Height
- *  @param  image_ID       [in] Image Type ID
+ *  @param  image_type     [in] Image Type
  *  @param  my_image       [in] Image Data 
  *  @param  temp_image     [in] Temporary Buffer
  *  @param  bs_offset      [in] Offset for MPI_Gatherv
@@ -1383,40 +3751,41 @@ int bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-				       unsigned int width, unsigned int height, unsigned int image_ID, \
-				       BYTE *my_image, BYTE **comp_image, \
-				       unsigned int *bs_offset, unsigned int *bs_counts, \
-				       MPI_Comm MPI_COMM_BSWAP )
+int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+							 unsigned int width, unsigned int height, unsigned int image_ID, \
+							 BYTE *my_image, BYTE **comp_image, \
+							 unsigned int *bs_offset, unsigned int *bs_counts, \
+							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int image_size;
-	unsigned int bs_send_image_size;
-	unsigned int bs_recv_image_size;
+	size_t bs_send_image_size, bs_recv_image_size;
+	size_t image_size;
 
 	BYTE* bs_send_image_ptr;
 	BYTE* bs_pair_image_ptr;
 	BYTE* bs_recv_image_ptr;
 	BYTE* bs_blnd_image_ptr;
 
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+	BYTE* bs_span_image_ptr;
+
+	_Bool bs_sparse;
+    
 	unsigned int bs_pair_offset;
 	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
 
-	// =======================================  
-	//     COMPOSITE IMAGES ( BINARY SWAP )
-	// =======================================  
-	 // Power of two number of pixels
+	_Bool bs_left_node;
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// ====================================================================
+
+	// Power of two number of pixels
 	#ifdef _GATHERV	
-		// << MPI_GATHERV >>
-		image_size = width * height;
-	#else 
-		// << MPI_GATHER >>
-		// Add remaining pixels (Blank Pixels) in order to make
-		// image size (number of pixels) divisible by "nnodes"
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
 	#endif
 
@@ -1427,47 +3796,78 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	#endif
 
 	switch ( image_ID ) {
-		case ID_RGBA32:  temp_image_byte_ptr = temp_image_rgba32;
-				   global_image_type   = RGBA32; 	
-		                 break;
-		case ID_RGBA56:  temp_image_byte_ptr = temp_image_rgba56;
-				   global_image_type   = RGBA56; 	
-                    		   break;
-		case ID_RGBA64:  temp_image_byte_ptr = temp_image_rgba64;
-				   global_image_type   = RGBA64; 	
-                   		   break;
+		case ID_RGBA32: temp_image_byte_ptr = temp_image_rgba32;
+                    break;
+		case ID_RGBA56: temp_image_byte_ptr = temp_image_rgba56;
+                    break;
+		case ID_RGBA64: temp_image_byte_ptr = temp_image_rgba64;
+                    break;
 		case ID_RGBAZ64: temp_image_byte_ptr = temp_image_rgbaz64;
-		   		   global_image_type   = RGBAZ64; 	
-                     	   break;
+                     break;
 		case ID_RGBAZ88: temp_image_byte_ptr = temp_image_rgbaz88;
-				   global_image_type   = RGBAZ88; 	
-                     	   break;
+                     break;
 		case ID_RGBAZ96: temp_image_byte_ptr = temp_image_rgbaz96;
-				   global_image_type   = RGBAZ96; 	
-		                 break;
+                     break;
  	}
 
-	bs_blnd_image_ptr  = my_image;
-	bs_send_image_size = image_size;
+	// Active-pixel span exchange (RGBA32 Pixels)
+	bs_sparse = (( image_ID == ID_RGBA32 ) && ( global_merge_ID == ALPHA_SPARSE ));
 
-	*bs_offset = (unsigned int)0;
+	bs_send_image_size = image_size >> 1; // width * height / 2
 	*bs_counts = (unsigned int)0;
 
 	bs_recv_image_size = 0;
 
-	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
+	// STAGE 1
+	// Get pointers and info for continung Binary-Swap
+	// from Stage 2
+	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 ))
+	{
+		*bs_offset = (unsigned int)0;
+		bs_blnd_image_ptr = my_image;
+	}
+	else 
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		*bs_offset = (unsigned int)bs_send_image_size;
+		bs_blnd_image_ptr = my_image + *bs_offset * global_image_type;
 
-		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
+	}
+
+	// STAGE 2
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( bs_sparse == false ) && \
+		       ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( image_ID, global_image_type );
+
+	for ( bs_stage = 1; bs_stage < bs_max_stage; bs_stage++ )
+	{
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
+
+		bs_left_node = false;
+		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 )
 		{
+			bs_left_node = true;
+		}
+	
+		if ( bs_left_node == true )
+		{		
 			//=====================================
-			//  		LEFT NODE of pair
+			//  LEFT NODE of pair
 			//=====================================
+
 			bs_pair_node = my_rank + bs_pair_offset;
 
 			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
 				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
 					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
@@ -1479,63 +3879,81 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 					bs_send_image_size = bs_recv_image_size + 1;
 				}
 			#else
-				// << MPI_GATHER >>
 				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_send_image_size -= global_add_pixels;
-				}
+				bs_send_image_size *= 0.5; // DIV 2
+				bs_recv_image_size = bs_send_image_size;
 			#endif
 
-			bs_pair_image_ptr  = bs_blnd_image_ptr;
 			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_pair_image_ptr  = bs_blnd_image_ptr;
 			bs_send_image_ptr  = bs_pair_image_ptr ;
 			bs_send_image_ptr += ( bs_recv_image_size * global_image_type );
 
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+			if ( bs_sparse == true )
+			{
+				exchange_image_spans ( bs_send_image_ptr, bs_send_image_size, global_image_type, &bs_span_image_ptr, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+								   bs_pair_image_ptr, bs_blnd_image_ptr, UNDER, image_ID, global_image_type, bs_chunk_pixels, \
+								   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+				}
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			// Assuming bs_pair_image_ptr (OVER) and bs_recv_image_ptr (UNDER)
-			if ( image_ID == ID_RGBAZ64 ) 
-			{
-				composite_alpha_rgbaz64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ88 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgbaz88 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ96 ) 
-			{
-				composite_alpha_rgbaz96 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				if ( bs_sparse == true )
+				{
+					composite_alpha_rgba32_span ( bs_span_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size, UNDER );
+				}
+				else if ( image_ID == ID_RGBA32 ) 
+				{
+					#ifdef _LUTBLEND
+						composite_alpha_rgba32 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#elif defined _BLENDF
+						composite_alpha_rgba32f ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#else
+						composite_alpha_rgba32_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#endif
+				}
+				else if ( image_ID == ID_RGBA56 ) 
+				{
+					composite_alpha_rgba56 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBA64 ) 
+				{
+					composite_alpha_rgba64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
 			}
 			#endif
 
 			bs_blnd_image_ptr  = bs_pair_image_ptr;
 			bs_send_image_size = bs_recv_image_size;
 		}
-		else // RIGHT NODE
+		else 
 		{		
 			//=====================================
-			//  		RIGHT NODE of pair
+			//  RIGHT NODE of pair
 			//=====================================
+
 			bs_pair_node = my_rank - bs_pair_offset;
 
 			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
 				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
 					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
@@ -1547,21 +3965,9 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 					bs_recv_image_size = bs_send_image_size + 1;
 				}
 			#else
-				// << MPI_GATHER >>
 				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-
-				//=====================================
-				//  Offset for Image Gathering
-				//=====================================
-				*bs_offset += bs_send_image_size;
-
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_recv_image_size -= global_add_pixels;
-				}
+				bs_send_image_size *= 0.5; // DIV 2
+				bs_recv_image_size = bs_send_image_size;
 			#endif
 
 			//=====================================
@@ -1573,44 +3979,64 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			bs_send_image_ptr  = bs_blnd_image_ptr;
 			bs_pair_image_ptr  = bs_send_image_ptr ;
 			bs_pair_image_ptr += ( bs_send_image_size * global_image_type );
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
 
-			if ( bs_stage == 0 ) {
-				bs_blnd_image_ptr  = temp_image_byte_ptr;
-				bs_blnd_image_ptr += ( bs_send_image_size * global_image_type );
+			//=====================================
+			//  Image Exchange between pairs
+			//=====================================
+			if ( bs_sparse == true )
+			{
+				exchange_image_spans ( bs_send_image_ptr, bs_send_image_size, global_image_type, &bs_span_image_ptr, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 			}
 			else
 			{
-				bs_blnd_image_ptr  = bs_pair_image_ptr;
+				if ( bs_chunked == true )
+				{
+					exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+								   bs_pair_image_ptr, bs_blnd_image_ptr, OVER, image_ID, global_image_type, bs_chunk_pixels, \
+								   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
+				else
+				{
+					exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+				}
 			}
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
-
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			// Assuming bs_recv_image_ptr (OVER) and bs_pair_image_ptr (UNDER)
-			if ( image_ID == ID_RGBAZ64 ) 
-			{
-				composite_alpha_rgbaz64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ88 ) 
-			{
-				composite_alpha_rgbaz88 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ96 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgbaz96 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				if ( bs_sparse == true )
+				{
+					composite_alpha_rgba32_span ( bs_span_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size, OVER );
+				}
+				else if ( image_ID == ID_RGBA32 ) 
+				{
+					#ifdef _LUTBLEND
+						composite_alpha_rgba32 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#elif defined _BLENDF
+						composite_alpha_rgba32f ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#else
+						composite_alpha_rgba32_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+					#endif
+
+				}
+				else if ( image_ID == ID_RGBA56 ) 
+				{
+					composite_alpha_rgba56 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBA64 ) 
+				{
+					composite_alpha_rgba64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
 			}
 			#endif
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
 		}
 	}
 
@@ -1623,7 +4049,8 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
- *        (RGBA128 Pixels) 
+ *         GROUP OF 2 NODES (2-3-4 Decomposition)
+ *         (RGBA32, RGBA56 and RGBA64 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -1637,216 +4064,425 @@ int bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int bswap_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
-				    unsigned int width, unsigned int height, unsigned int image_type, \
-				    float *my_image, float **comp_image, \
-					unsigned int *bs_offset, unsigned int *bs_counts, \
-					MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+							   unsigned int width, unsigned int height, unsigned int image_type, \
+							   BYTE *my_image, BYTE *temp_image, \
+							   MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
-	unsigned int image_size;
-	unsigned int bs_send_image_size;
-	unsigned int bs_recv_image_size;
+	BYTE* bs_send_image_ptr;
+	BYTE* bs_recv_image_ptr;
+	BYTE* bs_blnd_image_ptr;
 
-	float* bs_send_image_ptr;
-	float* bs_pair_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+	unsigned int bs_left_node;
+	unsigned int bs_pair_node; 
+
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// ====================================================================
+	
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	bs_half_image_size = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
+
+	bs_recv_image_size = 0;
+
+	if ( my_rank == ROOT_NODE ) {
+		bs_pair_node = 1; 
+		bs_left_node = true;
+	} else {
+		bs_pair_node = ROOT_NODE; 
+		bs_left_node = false;
+	}
+
+	if ( bs_left_node == true )
+	{		
+		//=====================================
+		//  LEFT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
+
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
+
+		bs_recv_image_ptr  = temp_image;
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * image_type );
+
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
+			#else
+				composite_alpha_rgba32_blend ( my_image, temp_image, my_image, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		#endif
+	}
+	else 
+	{		
+		//=====================================
+		//  RIGHT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
+
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
+
+		//=====================================
+		//  Offset for Image Gathering
+		//=====================================
+		bs_recv_image_ptr = temp_image;
+		bs_send_image_ptr = my_image;
+
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#else
+				composite_alpha_rgba32_blend ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		#endif
+	}
+	
+	return EXIT_SUCCESS;
+}
+
+
+/*========================================================*/
+/**
+ *  @brief Traditional Binary-Swap Image Exchange 
+ *         GROUP OF 3 NODES (2-3-4 Decomposition)
+ *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *
+ *  @param  my_rank        [in] My Rank
+ *  @param  nnodes         [in] Number of Nodes
+ *  @param  width          [in] Image Width
+ *  @param  height         [in] Image Height
+ *  @param  image_type     [in] Image Type
+ *  @param  my_image       [in] Image Data 
+ *  @param  temp_image     [in] Temporary Buffer
+ *  @param  bs_offset      [in] Offset for MPI_Gatherv
+ *  @param  bs_counts      [in] Counts for MPI_Gatherv
+ *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+*/
+/*========================================================*/
+int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+							   unsigned int width, unsigned int height, unsigned int image_type, \
+							   BYTE *my_image, BYTE *temp_image, \
+  							   MPI_Comm MPI_COMM_BSWAP )
+{
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
+
+	BYTE* bs_send_image_ptr;
+	BYTE* bs_recv_image_ptr;
+	BYTE* bs_blnd_image_ptr;
 
-	unsigned int bs_pair_offset;
-	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
 
 	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
+	
 	// Power of two number of pixels
 	#ifdef _GATHERV	
-		// << MPI_GATHERV >>
-		image_size = width * height;
-	#else 
-		// << MPI_GATHER >>
-		// Add remaining pixels (Blank Pixels) in order to make
-		// image size (number of pixels) divisible by "nnodes"
-		image_size = width * height + global_add_pixels; 
-	#endif
-
-	#ifdef C99
-		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
+		image_size = (size_t)width * height;
 	#else
-		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
 	#endif
 
-	bs_blnd_image_ptr  = my_image;
-	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
-
-	*bs_counts = (unsigned int)0;
-	*bs_offset = (unsigned int)0;
+	bs_half_image_size = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
 
 	bs_recv_image_size = 0;
 
-	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
-	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
-
-		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
-		{
-			//=====================================
-			//  		LEFT NODE of pair
-			//=====================================
-			bs_pair_node = my_rank + bs_pair_offset;
+	if ( my_rank == ROOT_NODE ) {
+		bs_pair_node = 1; 
+	} else {
+		bs_pair_node = ROOT_NODE; 
+	}
 
-			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size + 1;
-				}
-			#else
-				// << MPI_GATHER >>
-				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_send_image_size -= global_add_pixels;
-				}
-			#endif
+	if ( my_rank == ROOT_NODE ) // bs_left_node = TRUE;
+	{	
+		//=====================================
+		//  LEFT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			bs_pair_image_ptr  = bs_blnd_image_ptr;
-			bs_recv_image_ptr  = temp_image_rgba128;
-			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * RGBA );
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		bs_recv_image_ptr  = temp_image;
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * image_type );
 
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _NOBLEND
-			//=====================================
-			//  Do nothing (for benchmarking)
-			//=====================================
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
 			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				composite_alpha_rgba32_blend ( my_image, temp_image, my_image, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		#endif
 
-			#endif // #ifdef _NOBLEND
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 2; 
 
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
-		}
-		else // RIGHT NODE 
-		{		
-			//=====================================
-			//  		RIGHT NODE of pair
-			//=====================================
-			bs_pair_node = my_rank - bs_pair_offset;
+		bs_recv_image_size = bs_half_image_size;
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size + 1;
-				}
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
 			#else
-				// << MPI_GATHER >>
-				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
+				composite_alpha_rgba32_blend ( my_image, temp_image, my_image, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		#endif
+	}
+	else if ( my_rank == 1 ) // bs_left_node = FALSE;
+	{		
+		//=====================================
+		//  RIGHT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-				//=====================================
-				//  Offset for Image Gathering
-				//=====================================
-				*bs_offset += bs_send_image_size;
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
 
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_recv_image_size -= global_add_pixels;
-				}
-			#endif
+		//=====================================
+		//  Offset for Image Gathering
+		//=====================================
+		bs_recv_image_ptr = temp_image;
+		bs_send_image_ptr = my_image;
 
-			//=====================================
-			//  Offset for Image Gathering
-			//=====================================
-			*bs_offset += bs_send_image_size;
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
-			bs_recv_image_ptr  = temp_image_rgba128;
-			bs_send_image_ptr  = bs_blnd_image_ptr;
-			bs_pair_image_ptr  = bs_send_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
 
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#else
+				composite_alpha_rgba32_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		#endif
 
-			if ( bs_stage == 0 ) {
-				bs_blnd_image_ptr  = temp_image_rgba128;
-				bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 2; 
 
-			}
-			else
-			{
-				bs_blnd_image_ptr  = bs_pair_image_ptr;
-			}
+		bs_recv_image_size = bs_half_image_size;
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
 
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _NOBLEND
-			//=====================================
-			//  Do nothing (for benchmarking)
-			//=====================================
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-
-			#endif // #ifdef _NOBLEND
-	
-			#ifdef _GATHERV
-				bs_send_image_size = bs_recv_image_size;
+				composite_alpha_rgba32_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 			#endif
 		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		#endif
 	}
+	else if ( my_rank == 2 ) {
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
+	// ====================================================================
 
-	*bs_counts = bs_recv_image_size;
-	*comp_image = (float *)bs_blnd_image_ptr;	
+		//=====================================
+		//  		Image Sending to 0
+		//=====================================
+		bs_pair_node = 0; 
+		bs_send_image_ptr = my_image;
+
+		bs_send_image_size = bs_half_image_size;
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
+
+		//=====================================
+		//  		Image Sending to 1
+		//=====================================
+		bs_pair_node = 1; 
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * image_type );
 
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
+
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
+	}
+	
 	return EXIT_SUCCESS;
 }
 
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
- *        (RGBAZ160 Pixels) 
+ *         GROUP OF 4 NODES (2-3-4 Decomposition)
+ *         (RGBA32, RGBA56 and RGBA64 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -1860,207 +4496,273 @@ int bswap_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int bswap_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
-				     unsigned int width, unsigned int height, unsigned int image_type, \
-				     float *my_image, float **comp_image, \
-					 unsigned int *bs_offset, unsigned int *bs_counts, \
-					 MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+						       unsigned int width, unsigned int height, unsigned int image_type, \
+						       BYTE *my_image, BYTE *temp_image, \
+						       MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;	
 
-	unsigned int image_size;
-	unsigned int bs_send_image_size;
-	unsigned int bs_recv_image_size;
-
-	float* bs_send_image_ptr;
-	float* bs_pair_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+	BYTE* bs_send_image_ptr;
+	BYTE* bs_recv_image_ptr;
+	BYTE* bs_blnd_image_ptr;
 
-	unsigned int bs_pair_offset;
-	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
 
 	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
-	 // Power of two number of pixels
+
+	// Power of two number of pixels
 	#ifdef _GATHERV	
-		// << MPI_GATHERV >>
-		image_size = width * height;
-	#else 
-		// << MPI_GATHER >>
-		// Add remaining pixels (Blank Pixels) in order to make
-		// image size (number of pixels) divisible by "nnodes"
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
 	#endif
 
-	#ifdef C99
-		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
-	#else
-		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
-	#endif
+	bs_half_image_size  = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
 
-	bs_blnd_image_ptr  = my_image;
-	bs_send_image_size = image_size; // width * height ( + global_add_pixels )
+ 	// Variable initialization
+	bs_pair_node       = 0;
+	bs_send_image_size = 0;
+	bs_blnd_image_ptr  = NULL;
 
-	*bs_counts = (unsigned int)0;
-	*bs_offset = (unsigned int)0;
+	if ( my_rank == 0 ) {
+		bs_pair_node = 1; 
+	} else if ( my_rank == 1 ){
+		bs_pair_node = 0; 
+	} else if ( my_rank == 2 ){
+		bs_pair_node = 3; 
+	} else if ( my_rank == 3 ){
+		bs_pair_node = 2; 
+	}
+	
+	// =========================================================
+	// 					BINARY-SWAP STAGE 1
+	// =========================================================
 
-	bs_recv_image_size = 0;
+	if (( my_rank == 0 ) || ( my_rank == 2 )) // LEFT NODE
+	{	
+		//=====================================
+		//  LEFT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-	for ( bs_stage = 0; bs_stage < bs_max_stage; bs_stage++ )
-	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
 
-		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 ) // LEFT NODE
-		{
-			//=====================================
-			//  		LEFT NODE of pair
-			//=====================================
-			bs_pair_node = my_rank + bs_pair_offset;
+		bs_recv_image_ptr  = temp_image;
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * image_type );
 
-			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size + 1;
-				}
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
 			#else
-				// << MPI_GATHER >>
-				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_send_image_size -= global_add_pixels;
-				}
+				composite_alpha_rgba32_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 			#endif
 
-			bs_pair_image_ptr  = bs_blnd_image_ptr;
-			bs_recv_image_ptr  = temp_image_rgbaz160;
-			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * RGBAZ );
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		#endif
+	}
+	else if (( my_rank == 1 ) || ( my_rank == 3 )) // RIGHT NODE
+	{		
+		//=====================================
+		//  RIGHT NODE of pair
+		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
+
+		//=====================================
+		//  Offset for Image Gathering
+		//=====================================
+		bs_recv_image_ptr = temp_image;
+		bs_send_image_ptr = my_image;
+
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
+
+		#ifdef _NOBLEND
+		#else
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#else
+				composite_alpha_rgba32_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		#endif
+	}
 
-			#ifdef _NOBLEND
-			//=====================================
-			//  Do nothing (for benchmarking)
-			//=====================================
-			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgbaz160 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+	// =========================================================
+	//		BINARY-SWAP STAGE 2
+	// =========================================================
 
-			#endif // #ifdef _NOBLEND
+	if ( my_rank == 0 ) // LEFT NODE
+	{
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 2; 
 
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
-		}
-		else // RIGHT NODE 
-		{		
-			//=====================================
-			//  		RIGHT NODE of pair
-			//=====================================
-			bs_pair_node = my_rank - bs_pair_offset;
+		bs_recv_image_size = bs_half_image_size;
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _GATHERV	
-				// << MPI_GATHERV >>
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size + 1;
-				}
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
 			#else
-				// << MPI_GATHER >>
-				// Always EVEN number of pixels
-				bs_recv_image_size = bs_send_image_size * 0.5;
-				bs_send_image_size = bs_recv_image_size;
-
-				//=====================================
-				//  Offset for Image Gathering
-				//=====================================
-				*bs_offset += bs_send_image_size;
-
-				// In the first stage there is a need to send correct 
-				// amount of remaining pixels
-				if ( bs_stage == 0 ) {
-					bs_recv_image_size -= global_add_pixels;
-				}
+				composite_alpha_rgba32_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 			#endif
+		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+		}
+		#endif
+	}
+	else if ( my_rank == 1 ) // RIGHT NODE
+	{
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 3; 
 
-			//=====================================
-			//  Offset for Image Gathering
-			//=====================================
-			*bs_offset += bs_send_image_size;
-
-			bs_recv_image_ptr  = temp_image_rgbaz160;
-			bs_send_image_ptr  = bs_blnd_image_ptr;
-			bs_pair_image_ptr  = bs_send_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBAZ );
+		bs_recv_image_size = bs_half_image_size;
 
-			if ( bs_stage == 0 ) {
-				bs_blnd_image_ptr  = temp_image_rgbaz160;
-				bs_blnd_image_ptr += ( bs_send_image_size * RGBAZ );
-			}
-			else
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
 			{
-				bs_blnd_image_ptr  = bs_pair_image_ptr;
+				bs_recv_image_size++;
 			}
+		#endif
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _NOBLEND
-			//=====================================
-			//  Do nothing (for benchmarking)
-			//=====================================
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		if ( image_type == RGBA32 ) 
+		{
+			#ifdef _LUTBLEND
+				composite_alpha_rgba32 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			#elif defined _BLENDF
+				composite_alpha_rgba32f ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgbaz160 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-
-			#endif // #ifdef _NOBLEND
-	
-			#ifdef _GATHERV
-				bs_send_image_size = bs_recv_image_size;
+				composite_alpha_rgba32_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 			#endif
 		}
+		else if ( image_type == RGBA56 ) 
+		{
+			composite_alpha_rgba56 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		else if ( image_type == RGBA64 ) 
+		{
+			composite_alpha_rgba64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		}
+		#endif
+	}
+	else if ( my_rank == 2 )
+	{
+		//=====================================
+		//  		Image Sending to 0
+		//=====================================
+		bs_pair_node = 0; 
+		bs_send_image_ptr = my_image;
+
+		bs_send_image_size = bs_half_image_size;
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
+
 	}
+	else if ( my_rank == 3 )
+	{
+		//=====================================
+		//  		Image Sending to 1
+		//=====================================
+		bs_pair_node = 1; 
+		bs_send_image_ptr  = my_image;
 
-	*bs_counts = bs_recv_image_size;
-	*comp_image = (float *)bs_blnd_image_ptr;	
+		bs_send_image_ptr += ( bs_half_image_size * image_type );
+
+		#ifdef _GATHERV	
+			if ( image_size % 2 != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
 
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
+	}
+	
 	return EXIT_SUCCESS;
 }
 
@@ -2068,7 +4770,7 @@ int bswap_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         From STAGE 2, After 234Composition
- *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -2082,24 +4784,23 @@ int bswap_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-							 unsigned int width, unsigned int height, unsigned int image_ID, \
-							 BYTE *my_image, BYTE **comp_image, \
-							 unsigned int *bs_offset, unsigned int *bs_counts, \
-							 MPI_Comm MPI_COMM_BSWAP )
+int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+						 	  unsigned int width, unsigned int height, unsigned int image_ID, \
+							  BYTE *my_image, BYTE **comp_image, \
+							  unsigned int *bs_offset, unsigned int *bs_counts, \
+							  MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size;
-	unsigned int image_size;
+	size_t bs_send_image_size, bs_recv_image_size;
+	size_t image_size;
 
 	BYTE* bs_send_image_ptr;
 	BYTE* bs_pair_image_ptr;
 	BYTE* bs_recv_image_ptr;
 	BYTE* bs_blnd_image_ptr;
-    
+
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+
 	unsigned int bs_pair_offset;
 	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
@@ -2109,10 +4810,9 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
 	// ====================================================================
-
 	// Power of two number of pixels
 	#ifdef _GATHERV	
-		image_size = width * height;
+		image_size = (size_t)width * height;
 	#else
 		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
@@ -2139,14 +4839,12 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
                      break;
  	}
 
-	bs_send_image_size = image_size >> 1; // width * height / 2
+	bs_send_image_size = image_size * 0.5; // width * height / 2
 	*bs_counts = (unsigned int)0;
 
 	bs_recv_image_size = 0;
 
 	// STAGE 1
-	// Get pointers and info for continung Binary-Swap
-	// from Stage 2
 	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 ))
 	{
 		*bs_offset = (unsigned int)0;
@@ -2166,9 +4864,17 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	}
 
 	// STAGE 2
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( image_ID, global_image_type );
+
 	for ( bs_stage = 1; bs_stage < bs_max_stage; bs_stage++ )
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
 
 		bs_left_node = false;
 		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 )
@@ -2209,34 +4915,36 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+							   bs_pair_image_ptr, bs_blnd_image_ptr, UNDER, image_ID, global_image_type, bs_chunk_pixels, \
+							   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			if ( image_ID == ID_RGBA32 ) 
-			{
-				#ifdef _LUTBLEND
-					composite_alpha_rgba32 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#elif defined _BLENDF
-					composite_alpha_rgba32f ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#else
-					composite_alpha_rgba32_LUT ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#endif
-			}
-			else if ( image_ID == ID_RGBA56 ) 
-			{
-				composite_alpha_rgba56 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBA64 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgba64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				if ( image_ID == ID_RGBAZ64 ) 
+				{
+					composite_alpha_rgbaz64_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ88 ) 
+				{
+					composite_alpha_rgbaz88_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ96 ) 
+				{
+					composite_alpha_rgbaz96_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
 			}
 			#endif
 
@@ -2282,35 +4990,36 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( bs_send_image_ptr, bs_send_image_size, bs_recv_image_ptr, bs_recv_image_size, \
+							   bs_pair_image_ptr, bs_blnd_image_ptr, OVER, image_ID, global_image_type, bs_chunk_pixels, \
+							   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * global_image_type, bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			if ( image_ID == ID_RGBA32 ) 
-			{
-				#ifdef _LUTBLEND
-					composite_alpha_rgba32 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#elif defined _BLENDF
-					composite_alpha_rgba32f ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#else
-					composite_alpha_rgba32_LUT ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-				#endif
-
-			}
-			else if ( image_ID == ID_RGBA56 ) 
-			{
-				composite_alpha_rgba56 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBA64 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgba64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				if ( image_ID == ID_RGBAZ64 ) 
+				{
+					composite_alpha_rgbaz64_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ88 ) 
+				{
+					composite_alpha_rgbaz88_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
+				else if ( image_ID == ID_RGBAZ96 ) 
+				{
+					composite_alpha_rgbaz96_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				}
 			}
 			#endif
 
@@ -2329,7 +5038,7 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 2 NODES (2-3-4 Decomposition)
- *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -2343,17 +5052,13 @@ int stage2_bswap_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-							   unsigned int width, unsigned int height, unsigned int image_type, \
-							   BYTE *my_image, BYTE *temp_image, \
-							   MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+						    	unsigned int width, unsigned int height, unsigned int image_type, \
+						   		BYTE *my_image, BYTE *temp_image, \
+								MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
 	BYTE* bs_send_image_ptr;
 	BYTE* bs_recv_image_ptr;
@@ -2365,25 +5070,22 @@ int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
 	// ====================================================================
-	
 	// Power of two number of pixels
 	#ifdef _GATHERV	
-		image_size = width * height;
+		image_size = (size_t)width * height;
 	#else
 		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
 	#endif
 
-	bs_half_image_size = image_size; // width * height
+	bs_half_image_size  = image_size; // width * height
 	bs_half_image_size *= 0.5; // DIV 2
 
-	bs_recv_image_size = 0;
-
-	if ( my_rank == ROOT_NODE ) {
+	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 		bs_left_node = true;
 	} else {
-		bs_pair_node = ROOT_NODE; 
+		bs_pair_node = 0; 
 		bs_left_node = false;
 	}
 
@@ -2404,39 +5106,29 @@ int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * image_type );
+		bs_send_image_ptr += ( bs_half_image_size * image_type ); 
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( my_image, temp_image, my_image, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -2464,37 +5156,27 @@ int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
 		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
+		bs_blnd_image_ptr += ( bs_half_image_size * image_type ); 
 
 		#ifdef _NOBLEND
 		#else
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -2502,12 +5184,11 @@ int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	return EXIT_SUCCESS;
 }
 
-
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 3 NODES (2-3-4 Decomposition)
- *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -2521,17 +5202,15 @@ int partial_bswap2_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-							   unsigned int width, unsigned int height, unsigned int image_type, \
-							   BYTE *my_image, BYTE *temp_image, \
-  							   MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+						  	 	unsigned int width, unsigned int height, unsigned int image_type, \
+						   	 	BYTE *my_image, BYTE *temp_image, \
+						  	 	MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend, isend_to_0, isend_to_1;
-	MPI_Request irecv;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	_Bool even_image_size;
 
 	BYTE* bs_send_image_ptr;
 	BYTE* bs_recv_image_ptr;
@@ -2545,24 +5224,28 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	
 	// Power of two number of pixels
 	#ifdef _GATHERV	
-		image_size = width * height;
+		image_size = (size_t)width * height;
 	#else
 		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
 	#endif
 
-	bs_half_image_size = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
+	even_image_size = false;
+	if (( image_size % 2 ) == 0 ) 
+	{
+		even_image_size = true;
+	}
 
-	bs_recv_image_size = 0;
+	bs_half_image_size  = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
 
-	if ( my_rank == ROOT_NODE ) {
+	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 	} else {
-		bs_pair_node = ROOT_NODE; 
+		bs_pair_node = 0; 
 	}
 
-	if ( my_rank == ROOT_NODE ) // bs_left_node = TRUE;
+	if ( my_rank == 0 ) // bs_left_node = TRUE;
 	{	
 		//=====================================
 		//  LEFT NODE of pair
@@ -2584,34 +5267,24 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( my_image, temp_image, my_image, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
 		#endif
 
@@ -2621,31 +5294,24 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		bs_pair_node = 2; 
 
 		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( my_image, temp_image, my_image, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -2673,11 +5339,7 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
@@ -2687,23 +5349,17 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 
 		#ifdef _NOBLEND
 		#else
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
 		#endif
 
@@ -2713,39 +5369,28 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		bs_pair_node = 2; 
 
 		bs_recv_image_size = bs_half_image_size;
+		if ( even_image_size == false ) {
+			bs_recv_image_size++; 
+		}
 
-		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
-			{
-				bs_recv_image_size++;
-			}
-		#endif
-
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -2761,7 +5406,7 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		bs_send_image_ptr = my_image;
 
 		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend_to_0 );
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  		Image Sending to 1
@@ -2777,9 +5422,7 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			}
 		#endif
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &isend_to_1 );
-		MPI_Wait( &isend_to_0, &status );
-		MPI_Wait( &isend_to_1, &status );
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 	}
 	
 	return EXIT_SUCCESS;
@@ -2789,7 +5432,7 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 4 NODES (2-3-4 Decomposition)
- *         (RGBA32, RGBA56 and RGBA64 Pixels) 
+ *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -2803,17 +5446,13 @@ int partial_bswap3_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-						       unsigned int width, unsigned int height, unsigned int image_type, \
-						       BYTE *my_image, BYTE *temp_image, \
-						       MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
+							    unsigned int width, unsigned int height, unsigned int image_type, \
+							    BYTE *my_image, BYTE *temp_image, \
+							    MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;	
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;	
 
 	BYTE* bs_send_image_ptr;
 	BYTE* bs_recv_image_ptr;
@@ -2824,22 +5463,22 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
-
+	
 	// Power of two number of pixels
 	#ifdef _GATHERV	
-		image_size = width * height;
+		image_size = (size_t)width * height;
 	#else
 		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
-	#endif
+	#endif	
 
 	bs_half_image_size  = image_size; // width * height
 	bs_half_image_size *= 0.5; // DIV 2
 
- 	// Variable initialization
-	bs_pair_node       = 0;
+	// Variable Initialization
+	bs_pair_node = 0;
 	bs_send_image_size = 0;
-	bs_blnd_image_ptr  = NULL;
+	bs_blnd_image_ptr = NULL;
 
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
@@ -2877,35 +5516,24 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( my_image, temp_image, my_image, bs_recv_image_size );
-			#endif
-
+			composite_alpha_rgbaz64_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -2933,11 +5561,7 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * image_type, bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
@@ -2947,29 +5571,23 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 
 		#ifdef _NOBLEND
 		#else
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		}
 		#endif
 	}
 
 	// =========================================================
-	//		BINARY-SWAP STAGE 2
+	// 					BINARY-SWAP STAGE 2
 	// =========================================================
 
 	if ( my_rank == 0 ) // LEFT NODE
@@ -2980,31 +5598,24 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		bs_pair_node = 2; 
 
 		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( my_image, temp_image, my_image, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( my_image, temp_image, my_image, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( my_image, temp_image, my_image, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( my_image, temp_image, my_image, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -3024,31 +5635,24 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			}
 		#endif
 
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBA32 ) 
+		if ( image_type == RGBAZ64 ) 
 		{
-			#ifdef _LUTBLEND
-				composite_alpha_rgba32 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#elif defined _BLENDF
-				composite_alpha_rgba32f ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#else
-				composite_alpha_rgba32_LUT ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+			composite_alpha_rgbaz64_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA56 ) 
+		else if ( image_type == RGBAZ88 ) 
 		{
-			composite_alpha_rgba56 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz88_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
-		else if ( image_type == RGBA64 ) 
+		else if ( image_type == RGBAZ96 ) 
 		{
-			composite_alpha_rgba64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+			composite_alpha_rgbaz96_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		}
 		#endif
 	}
@@ -3061,8 +5665,7 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		bs_send_image_ptr = my_image;
 
 		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 	}
 	else if ( my_rank == 3 )
@@ -3082,8 +5685,7 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			}
 		#endif
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		send_image ( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
 	}
 	
 	return EXIT_SUCCESS;
@@ -3093,7 +5695,7 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         From STAGE 2, After 234Composition
- *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *         (RGBA128 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -3107,90 +5709,93 @@ int partial_bswap4_rgba_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-						 	  unsigned int width, unsigned int height, unsigned int image_ID, \
-							  BYTE *my_image, BYTE **comp_image, \
-							  unsigned int *bs_offset, unsigned int *bs_counts, \
-							  MPI_Comm MPI_COMM_BSWAP )
+int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
+							unsigned int width, unsigned int height, unsigned int image_type, \
+							float *my_image, float **comp_image, \
+							unsigned int *bs_offset, unsigned int *bs_counts, \
+							MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	size_t bs_send_image_size, bs_recv_image_size;
+	size_t image_size; 
 
-	unsigned int bs_send_image_size, bs_recv_image_size;
-	unsigned int image_size;
+	float* bs_send_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_blnd_image_ptr;
 
-	BYTE* bs_send_image_ptr;
-	BYTE* bs_pair_image_ptr;
-	BYTE* bs_recv_image_ptr;
-	BYTE* bs_blnd_image_ptr;
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
 
-	unsigned int bs_pair_offset;
+	unsigned int bs_left_node, bs_pair_offset;
 	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
 
-	_Bool bs_left_node;
-
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
 	// ====================================================================
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
+	#ifdef C99
+		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
 	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
+		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
 	#endif
 
-	#ifdef C99
-		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
-	#else
-		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
+	 // Power of two number of pixels
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		image_size = (size_t)width * height;
+		bs_send_image_size = (unsigned int)floor( image_size * 0.5 ); // width * height / 2
+		bs_recv_image_size = bs_send_image_size;
+	#else 
+		// << MPI_GATHER >>
+		// Add remaining pixels (Blank Pixels) in order to make
+		// image size (number of pixels) divisible by "nnodes"
+
+		image_size = width * height + global_add_pixels; 
+		bs_send_image_size = image_size * 0.5; // width * height / 2
+		bs_recv_image_size = bs_send_image_size;
 	#endif
 
-	switch ( image_ID ) {
-		case ID_RGBA32: temp_image_byte_ptr = temp_image_rgba32;
-                    break;
-		case ID_RGBA56: temp_image_byte_ptr = temp_image_rgba56;
-                    break;
-		case ID_RGBA64: temp_image_byte_ptr = temp_image_rgba64;
-                    break;
-		case ID_RGBAZ64: temp_image_byte_ptr = temp_image_rgbaz64;
-                     break;
-		case ID_RGBAZ88: temp_image_byte_ptr = temp_image_rgbaz88;
-                     break;
-		case ID_RGBAZ96: temp_image_byte_ptr = temp_image_rgbaz96;
-                     break;
- 	}
-
-	bs_send_image_size = image_size * 0.5; // width * height / 2
 	*bs_counts = (unsigned int)0;
 
-	bs_recv_image_size = 0;
-
-	// STAGE 1
-	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 ))
+	//=====================================
+	//  			STAGE 1
+	//=====================================
+	// Note: bs_send_image_size and bs_recv_image_sizes
+	// can be different between MPI_GATHERV and MPI_GATHER
+	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 )) // LEFT NODE
 	{
 		*bs_offset = (unsigned int)0;
 		bs_blnd_image_ptr = my_image;
 	}
-	else 
+	else // RIGHT NODE 
 	{
 		*bs_offset = (unsigned int)bs_send_image_size;
-		bs_blnd_image_ptr = my_image + *bs_offset * global_image_type;
+
+		bs_blnd_image_ptr  = temp_image_rgba128;  
+		bs_blnd_image_ptr += ( *bs_offset * RGBA ); 
 
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			if (( image_size % 2 ) != 0 )
 			{
-				bs_send_image_size++;
+				bs_recv_image_size++;
 			}
 		#endif
 	}
 
-	// STAGE 2
+	//=====================================
+	//  			STAGE 2
+	//=====================================
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( ID_RGBA128, RGBA128 );
+
 	for ( bs_stage = 1; bs_stage < bs_max_stage; bs_stage++ )
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
 
 		bs_left_node = false;
 		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 )
@@ -3203,18 +5808,17 @@ int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			//  LEFT NODE of pair
 			//=====================================
-
 			bs_pair_node = my_rank + bs_pair_offset;
 
 			#ifdef _GATHERV	
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				if (( bs_recv_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size *= 0.5;
 					bs_send_image_size = bs_recv_image_size;
 				}
 				else // ODD number of pixels
 				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = ( unsigned int )floor( bs_recv_image_size * 0.5 );
 					bs_send_image_size = bs_recv_image_size + 1;
 				}
 			#else
@@ -3223,59 +5827,52 @@ int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 				bs_recv_image_size = bs_send_image_size;
 			#endif
 
-			bs_recv_image_ptr  = temp_image_byte_ptr;
+			bs_recv_image_ptr  = temp_image_rgba128;
 			bs_pair_image_ptr  = bs_blnd_image_ptr;
 			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * global_image_type );
+			bs_send_image_ptr += ( bs_recv_image_size * RGBA );
 
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+							   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, UNDER, ID_RGBA128, RGBA128, bs_chunk_pixels, \
+							   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			if ( image_ID == ID_RGBAZ64 ) 
-			{
-				composite_alpha_rgbaz64 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ88 ) 
-			{
-				composite_alpha_rgbaz88 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ96 ) 
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgbaz96 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 			}
 			#endif
-
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
 		}
 		else 
 		{		
 			//=====================================
 			//  RIGHT NODE of pair
 			//=====================================
-
 			bs_pair_node = my_rank - bs_pair_offset;
 
 			#ifdef _GATHERV	
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
+				if (( bs_recv_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size;
+					bs_recv_image_size *= 0.5;
+					bs_send_image_size = bs_recv_image_size;
 				}
 				else // ODD number of pixels
 				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_send_image_size = ( unsigned int )floor( bs_recv_image_size * 0.5 );
 					bs_recv_image_size = bs_send_image_size + 1;
 				}
 			#else
@@ -3289,47 +5886,43 @@ int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			*bs_offset += bs_send_image_size;
 			
-			bs_recv_image_ptr  = temp_image_byte_ptr;
-			bs_send_image_ptr  = bs_blnd_image_ptr;
-			bs_pair_image_ptr  = bs_send_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * global_image_type );
+			bs_recv_image_ptr  = temp_image_rgba128;
+
+			bs_pair_image_ptr  = bs_blnd_image_ptr ;
+			bs_send_image_ptr  = bs_pair_image_ptr ;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
 			bs_blnd_image_ptr  = bs_pair_image_ptr;
 
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * global_image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * global_image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+							   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, OVER, ID_RGBA128, RGBA128, bs_chunk_pixels, \
+							   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			if ( image_ID == ID_RGBAZ64 ) 
-			{
-				composite_alpha_rgbaz64 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ88 ) 
-			{
-				composite_alpha_rgbaz88 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			}
-			else if ( image_ID == ID_RGBAZ96 ) 
+
+			if ( bs_chunked == false ) // Not composited during the exchange
 			{
-				composite_alpha_rgbaz96 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+				composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 			}
 			#endif
-
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
 		}
 	}
 
 	*bs_counts  = bs_recv_image_size;
-	*comp_image = (BYTE *)bs_blnd_image_ptr;
+	*comp_image = (float *)bs_blnd_image_ptr;
 
 	return EXIT_SUCCESS;
 }
@@ -3338,7 +5931,7 @@ int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 2 NODES (2-3-4 Decomposition)
- *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *         (RGBA128 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -3352,39 +5945,25 @@ int stage2_bswap_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-						    	unsigned int width, unsigned int height, unsigned int image_type, \
-						   		BYTE *my_image, BYTE *temp_image, \
-								MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+							 unsigned int width, unsigned int height, unsigned int image_type, \
+							 float *my_image, float *temp_image, \
+							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
-	BYTE* bs_send_image_ptr;
-	BYTE* bs_recv_image_ptr;
-	BYTE* bs_blnd_image_ptr;
+	float* bs_send_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_blnd_image_ptr;
 
-	unsigned int bs_left_node;
 	unsigned int bs_pair_node; 
+	_Bool bs_left_node;
 
 	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
+	// 			 	COMPOSITE TWO IMAGES ( BINARY SWAP )
 	// ====================================================================
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif
-
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
-
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 		bs_left_node = true;
@@ -3398,46 +5977,56 @@ int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+
+			if (( image_size % 2 ) == 0 ) // EVEN number of pixels
 			{
-				bs_send_image_size++;
+				bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+				bs_recv_image_size = bs_half_image_size;
+				bs_send_image_size = bs_recv_image_size;
+			}
+			else // ODD number of pixels
+			{
+				bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+				bs_recv_image_size = bs_half_image_size;
+				bs_send_image_size = bs_recv_image_size + 1;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+			bs_half_image_size = image_size * 0.5;
+
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+			// For avoiding memory access problem
+			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * image_type ); 
+		bs_send_image_ptr += ( bs_half_image_size * RGBA );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
+		bs_recv_image_ptr = my_image;
+		bs_pair_image_ptr = temp_image;
+		bs_blnd_image_ptr = my_image;
+		
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	else 
@@ -3445,14 +6034,31 @@ int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+
+			if (( image_size % 2 ) == 0 ) // EVEN number of pixels
 			{
-				bs_recv_image_size++;
+				bs_send_image_size = ( unsigned int )floor( image_size * 0.5 );
+				bs_recv_image_size = bs_send_image_size;
+			}
+			else // ODD number of pixels
+			{
+				bs_send_image_size = ( unsigned int )floor( image_size * 0.5 );
+				bs_recv_image_size = bs_send_image_size + 1;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+
+			bs_half_image_size = image_size * 0.5;
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+
+			// For avoiding memory access problem
+			bs_recv_image_size -= global_add_pixels;
 		#endif
 
 		//=====================================
@@ -3464,32 +6070,34 @@ int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * image_type ); 
+		#ifdef _GATHERV
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#else
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#endif
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	
@@ -3500,7 +6108,7 @@ int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 3 NODES (2-3-4 Decomposition)
- *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *         (RGBA128 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -3514,98 +6122,81 @@ int partial_bswap2_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-						  	 	unsigned int width, unsigned int height, unsigned int image_type, \
-						   	 	BYTE *my_image, BYTE *temp_image, \
-						  	 	MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+							 unsigned int width, unsigned int height, unsigned int image_type, \
+							 float *my_image, float *temp_image, \
+							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend, isend_to_0, isend_to_1;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
-
-	_Bool even_image_size;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size; 
 
-	BYTE* bs_send_image_ptr;
-	BYTE* bs_recv_image_ptr;
-	BYTE* bs_blnd_image_ptr;
+	float* bs_send_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_blnd_image_ptr;
 
 	unsigned int bs_pair_node; 
 
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
-	
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif
-
-	even_image_size = false;
-	if (( image_size % 2 ) == 0 ) 
-	{
-		even_image_size = true;
-	}
-
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
-
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 	} else {
 		bs_pair_node = 0; 
 	}
 
-	if ( my_rank == 0 ) // bs_left_node = TRUE;
+	if ( my_rank == 0 ) // LEFT NODE
 	{	
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+
+			if (( image_size % 2 ) != 0 ) // ODD number of pixels
 			{
 				bs_send_image_size++;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+
+			bs_half_image_size = image_size * 0.5;
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+			// For avoiding memory access problem
+			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * image_type );
+		bs_send_image_ptr += ( bs_half_image_size * RGBA );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
+		bs_recv_image_ptr = my_image;
+		bs_pair_image_ptr = temp_image;
+		bs_blnd_image_ptr = my_image;
+		
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 
 		//=====================================
@@ -3613,42 +6204,54 @@ int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		bs_pair_node = 2; 
 
-		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
+		bs_recv_image_ptr = my_image;
+		bs_pair_image_ptr = temp_image;
+		bs_blnd_image_ptr = my_image;
+		
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
-	else if ( my_rank == 1 ) // bs_left_node = FALSE;
+	else if ( my_rank == 1 ) // RIGHT NODE
 	{		
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+
+			bs_send_image_size = bs_half_image_size;
+			bs_recv_image_size = bs_send_image_size;
+
+			if (( image_size % 2 ) != 0 ) // ODD number of pixels
 			{
 				bs_recv_image_size++;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+
+			bs_half_image_size = image_size * 0.5;
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+
+			//=====================================
+			//  Offset for Image Gathering
+			//=====================================
+			// For avoiding memory access problem
+			bs_recv_image_size -= global_add_pixels;
 		#endif
 
 		//=====================================
@@ -3660,32 +6263,35 @@ int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
+		#ifdef _GATHERV
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#else
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#endif
+
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 
 		//=====================================
@@ -3693,66 +6299,69 @@ int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		bs_pair_node = 2; 
 
-		bs_recv_image_size = bs_half_image_size;
-		if ( even_image_size == false ) {
-			bs_recv_image_size++; 
-		}
-
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
+		composite_alpha_rgba128 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	else if ( my_rank == 2 ) {
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
-	// ====================================================================
 
+		// ====================================================================
+		// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
+		// ====================================================================
 		//=====================================
-		//  		Image Sending to 0
+		//  	Image Sending to LEFT NODE
 		//=====================================
 		bs_pair_node = 0; 
+
+		#ifdef _GATHERV	
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+
+			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+			bs_send_image_size = bs_half_image_size;
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+
+			bs_half_image_size = image_size * 0.5;
+			bs_send_image_size = bs_half_image_size;
+		#endif
+
 		bs_send_image_ptr = my_image;
 
-		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend_to_0 );
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
-		//  		Image Sending to 1
+		//  	Image Sending to RIGHT NODE
 		//=====================================
 		bs_pair_node = 1; 
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * image_type );
 
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			if (( image_size % 2 ) != 0 ) // ODD number of pixels
 			{
-				bs_send_image_size++;
+				bs_send_image_size = bs_half_image_size + 1;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			bs_send_image_size = bs_half_image_size - global_add_pixels;
 		#endif
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &isend_to_1 );
-		MPI_Wait( &isend_to_0, &status );
-		MPI_Wait( &isend_to_1, &status );
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
+
 	}
-	
+
 	return EXIT_SUCCESS;
 }
 
@@ -3760,7 +6369,7 @@ int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 4 NODES (2-3-4 Decomposition)
- *         (RGBAZ64, RGBAZ88 and RGBAZ96 Pixels) 
+ *         (RGBA128 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -3774,43 +6383,25 @@ int partial_bswap3_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
-							    unsigned int width, unsigned int height, unsigned int image_type, \
-							    BYTE *my_image, BYTE *temp_image, \
-							    MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap4_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+							 unsigned int width, unsigned int height, unsigned int image_type, \
+							 float *my_image, float *temp_image, \
+							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;	
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
-	BYTE* bs_send_image_ptr;
-	BYTE* bs_recv_image_ptr;
-	BYTE* bs_blnd_image_ptr;
+	float* bs_send_image_ptr;
+	float* bs_recv_image_ptr;
+	float* bs_pair_image_ptr;
+	float* bs_blnd_image_ptr;
 
 	unsigned int bs_pair_node; 
 
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
-	
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif	
-
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
-
-	// Variable Initialization
 	bs_pair_node = 0;
-	bs_send_image_size = 0;
-	bs_blnd_image_ptr = NULL;
 
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
@@ -3821,56 +6412,65 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 	} else if ( my_rank == 3 ){
 		bs_pair_node = 2; 
 	}
+
+	// Variable Initialization
+	bs_half_image_size = 0;
+	bs_send_image_size = 0;
+	bs_recv_image_size = 0;
 	
 	// =========================================================
 	// 					BINARY-SWAP STAGE 1
 	// =========================================================
-
 	if (( my_rank == 0 ) || ( my_rank == 2 )) // LEFT NODE
 	{	
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+
+			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+
+			if (( image_size % 2 ) != 0 ) // ODD number of pixels
 			{
 				bs_send_image_size++;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+			bs_half_image_size = image_size * 0.5;
+
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+			// For avoiding memory access problem
+			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * image_type );
+		bs_send_image_ptr += ( bs_half_image_size * RGBA );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
+		bs_pair_image_ptr = my_image;
+		bs_blnd_image_ptr = my_image;
+
+		composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	else if (( my_rank == 1 ) || ( my_rank == 3 )) // RIGHT NODE
@@ -3878,14 +6478,29 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
 		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			// << MPI_GATHERV >>
+			image_size = (size_t)width * height;
+
+			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
+			bs_send_image_size = bs_half_image_size;
+			bs_recv_image_size = bs_send_image_size;
+
+			if (( image_size % 2 ) != 0 ) // ODD number of pixels
 			{
 				bs_recv_image_size++;
 			}
+		#else
+			// << MPI_GATHER >>
+			// Always EVEN number of pixels
+			image_size = width * height + global_add_pixels;
+
+			bs_half_image_size = image_size * 0.5;
+			bs_recv_image_size = bs_half_image_size;
+			bs_send_image_size = bs_recv_image_size;
+
+			// For avoiding memory access problem
+			bs_recv_image_size -= global_add_pixels;
 		#endif
 
 		//=====================================
@@ -3897,39 +6512,36 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBA, bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * image_type );
+		#ifdef _GATHERV
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#else
+			bs_pair_image_ptr  = my_image;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+
+			bs_blnd_image_ptr  = temp_image;
+			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
+		#endif
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		}
+		composite_alpha_rgba128 ( temp_image, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
-
 	// =========================================================
 	// 					BINARY-SWAP STAGE 2
 	// =========================================================
-
 	if ( my_rank == 0 ) // LEFT NODE
 	{
 		//=====================================
@@ -3937,65 +6549,61 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		bs_pair_node = 2; 
 
-		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		recv_image ( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( my_image, temp_image, my_image, bs_recv_image_size );
-		}
+		bs_recv_image_ptr = my_image;
+		bs_pair_image_ptr = temp_image;
+		bs_blnd_image_ptr = my_image;
+
+		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	else if ( my_rank == 1 ) // RIGHT NODE
 	{
 		//=====================================
-		// 		Image Receiving from 2
+		// 		Image Receiving from 3
 		//=====================================
 		bs_pair_node = 3; 
 
-		bs_recv_image_size = bs_half_image_size;
+		#ifdef _GATHERV
+			image_size = (size_t)width * height;
+			bs_half_image_size = (int)floor( image_size * 0.5 );
 
-		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
+			if (( image_size % 2 ) != 0 )
 			{
-				bs_recv_image_size++;
+				bs_recv_image_size = bs_half_image_size + 1;
 			}
+		#else
+			image_size = width * height + global_add_pixels;
+			bs_half_image_size = image_size * 0.5;
+			bs_recv_image_size = bs_half_image_size - global_add_pixels;
 		#endif
 
-		MPI_Irecv( temp_image, bs_recv_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		bs_recv_image_ptr  = temp_image;
+
+		recv_image ( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
+		//=====================================
+		// No Image Composition (For Test)
+		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		if ( image_type == RGBAZ64 ) 
-		{
-			composite_alpha_rgbaz64 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ88 ) 
-		{
-			composite_alpha_rgbaz88 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
-		else if ( image_type == RGBAZ96 ) 
-		{
-			composite_alpha_rgbaz96 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		}
+		bs_pair_image_ptr  = temp_image;
+		bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+		bs_blnd_image_ptr  = bs_pair_image_ptr;
+
+		composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	else if ( my_rank == 2 )
@@ -4004,12 +6612,11 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//  		Image Sending to 0
 		//=====================================
 		bs_pair_node = 0; 
-		bs_send_image_ptr = my_image;
-
 		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
 
+		bs_send_image_ptr = my_image;
+
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 	}
 	else if ( my_rank == 3 )
 	{
@@ -4017,21 +6624,19 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 		//  		Image Sending to 1
 		//=====================================
 		bs_pair_node = 1; 
-		bs_send_image_ptr  = my_image;
-
-		bs_send_image_ptr += ( bs_half_image_size * image_type );
 
-		#ifdef _GATHERV	
-			if ( image_size % 2 != 0 )
-			{
-				bs_send_image_size++;
-			}
+		#ifdef _GATHERV
+			bs_send_image_size = bs_recv_image_size;
+		#else
+			bs_send_image_size = bs_half_image_size - global_add_pixels;
 		#endif
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * image_type, MPI_BYTE, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		bs_send_image_ptr  = temp_image;
+		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
 	}
-	
+
 	return EXIT_SUCCESS;
 }
 
@@ -4039,7 +6644,7 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         From STAGE 2, After 234Composition
- *         (RGBA128 Pixels) 
+ *         (RGBAZ160 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -4053,24 +6658,23 @@ int partial_bswap4_rgbaz_BYTE ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
+int stage2_bswap_rgbaz160 (  unsigned int my_rank, unsigned int nnodes, \
 							unsigned int width, unsigned int height, unsigned int image_type, \
 							float *my_image, float **comp_image, \
 							unsigned int *bs_offset, unsigned int *bs_counts, \
 							MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size;
-	unsigned int image_size; 
+	size_t bs_send_image_size, bs_recv_image_size;
+	size_t image_size; 
 
 	float* bs_send_image_ptr;
 	float* bs_pair_image_ptr;
 	float* bs_recv_image_ptr;
 	float* bs_blnd_image_ptr;
 
+	unsigned int bs_chunk_pixels;
+	_Bool bs_chunked;
+
 	unsigned int bs_left_node, bs_pair_offset;
 	unsigned int bs_stage, bs_max_stage;
 	unsigned int bs_pair_node; 
@@ -4078,61 +6682,57 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
 	// ====================================================================
+	
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
+	#endif
+
 	#ifdef C99
 		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
 	#else
 		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
 	#endif
 
-	 // Power of two number of pixels
-	#ifdef _GATHERV	
-		// << MPI_GATHERV >>
-		image_size = width * height;
-		bs_send_image_size = (unsigned int)floor( image_size * 0.5 ); // width * height / 2
-		bs_recv_image_size = bs_send_image_size;
-	#else 
-		// << MPI_GATHER >>
-		// Add remaining pixels (Blank Pixels) in order to make
-		// image size (number of pixels) divisible by "nnodes"
-
-		image_size = width * height + global_add_pixels; 
-		bs_send_image_size = image_size * 0.5; // width * height / 2
-		bs_recv_image_size = bs_send_image_size;
-	#endif
+	bs_recv_image_size = 0;
 
+	bs_send_image_size = image_size >> 1; // width * height / 2
 	*bs_counts = (unsigned int)0;
 
-	//=====================================
-	//  			STAGE 1
-	//=====================================
-	// Note: bs_send_image_size and bs_recv_image_sizes
-	// can be different between MPI_GATHERV and MPI_GATHER
-	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 )) // LEFT NODE
+	// STAGE 1
+	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 ))
 	{
 		*bs_offset = (unsigned int)0;
 		bs_blnd_image_ptr = my_image;
 	}
-	else // RIGHT NODE 
+	else 
 	{
 		*bs_offset = (unsigned int)bs_send_image_size;
-
-		bs_blnd_image_ptr  = temp_image_rgba128;  
-		bs_blnd_image_ptr += ( *bs_offset * RGBA ); 
+		bs_blnd_image_ptr = my_image + *bs_offset * RGBAZ; 
 
 		#ifdef _GATHERV	
 			if (( image_size % 2 ) != 0 )
 			{
-				bs_recv_image_size++;
+				bs_send_image_size++;
 			}
 		#endif
 	}
 
-	//=====================================
-	//  			STAGE 2
-	//=====================================
+	// STAGE 2
+
+	// Pipelined exchange and compositing (Not for the RLE, SPAN or ROI exchanges)
+	bs_chunked = ( ( global_merge_ID != ALPHA_COMPRESS ) && \
+		       ( global_merge_ID != DEPTH_COMPRESS ) );
+	bs_chunk_pixels = get_chunk_pixels ( ID_RGBAZ160, RGBAZ160 );
+
 	for ( bs_stage = 1; bs_stage < bs_max_stage; bs_stage++ )
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		begin_stats_phase ( (int)bs_stage );
+
+		bs_pair_offset = 1 << bs_stage; 
 
 		bs_left_node = false;
 		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 )
@@ -4145,17 +6745,18 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			//  LEFT NODE of pair
 			//=====================================
+
 			bs_pair_node = my_rank + bs_pair_offset;
 
 			#ifdef _GATHERV	
-				if (( bs_recv_image_size % 2 ) == 0 ) // EVEN number of pixels
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
-					bs_recv_image_size *= 0.5;
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
 					bs_send_image_size = bs_recv_image_size;
 				}
 				else // ODD number of pixels
 				{
-					bs_recv_image_size = ( unsigned int )floor( bs_recv_image_size * 0.5 );
+					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
 					bs_send_image_size = bs_recv_image_size + 1;
 				}
 			#else
@@ -4164,44 +6765,56 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
 				bs_recv_image_size = bs_send_image_size;
 			#endif
 
-			bs_recv_image_ptr  = temp_image_rgba128;
+			bs_recv_image_ptr  = temp_image_rgbaz160;
 			bs_pair_image_ptr  = bs_blnd_image_ptr;
 			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * RGBA );
+			bs_send_image_ptr += ( bs_recv_image_size * RGBAZ );
 
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+							   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, UNDER, ID_RGBAZ160, RGBAZ160, bs_chunk_pixels, \
+							   bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-			composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				composite_alpha_rgbaz160_blend ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			}
 			#endif
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
 		}
 		else 
 		{		
 			//=====================================
 			//  RIGHT NODE of pair
 			//=====================================
+
 			bs_pair_node = my_rank - bs_pair_offset;
 
 			#ifdef _GATHERV	
-				if (( bs_recv_image_size % 2 ) == 0 ) // EVEN number of pixels
+				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
 				{
-					bs_recv_image_size *= 0.5;
-					bs_send_image_size = bs_recv_image_size;
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
+					bs_recv_image_size = bs_send_image_size;
 				}
 				else // ODD number of pixels
 				{
-					bs_send_image_size = ( unsigned int )floor( bs_recv_image_size * 0.5 );
+					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
 					bs_recv_image_size = bs_send_image_size + 1;
 				}
 			#else
@@ -4215,30 +6828,39 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
 			//=====================================
 			*bs_offset += bs_send_image_size;
 			
-			bs_recv_image_ptr  = temp_image_rgba128;
-
-			bs_pair_image_ptr  = bs_blnd_image_ptr ;
-			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+			bs_recv_image_ptr  = temp_image_rgbaz160;
+			bs_send_image_ptr  = bs_blnd_image_ptr;
+			bs_pair_image_ptr  = bs_send_image_ptr ;
+			bs_pair_image_ptr += ( bs_send_image_size * RGBAZ );
 			bs_blnd_image_ptr  = bs_pair_image_ptr;
 
 			//=====================================
 			//  Image Exchange between pairs
 			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+			if ( bs_chunked == true )
+			{
+				exchange_composite_image ( (BYTE *)bs_send_image_ptr, bs_send_image_size, (BYTE *)bs_recv_image_ptr, bs_recv_image_size, \
+							   (BYTE *)bs_pair_image_ptr, (BYTE *)bs_blnd_image_ptr, OVER, ID_RGBAZ160, RGBAZ160, bs_chunk_pixels, \
+							   bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
+			else
+			{
+				exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+			}
 
 			#ifdef _NOBLEND
 			#else
 			//=====================================
 			//  Image Compositing (Alpha or Depth)
 			//=====================================
-
-			composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			if ( bs_chunked == false ) // Not composited during the exchange
+			{
+				composite_alpha_rgbaz160_blend ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+			}
 			#endif
+
+			bs_blnd_image_ptr  = bs_pair_image_ptr;
+			bs_send_image_size = bs_recv_image_size;
 		}
 	}
 
@@ -4248,11 +6870,12 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
 	return EXIT_SUCCESS;
 }
 
+
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 2 NODES (2-3-4 Decomposition)
- *         (RGBA128 Pixels) 
+ *         (RGBAZ160 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -4266,29 +6889,36 @@ int stage2_bswap_rgba128 (  unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
-							 unsigned int width, unsigned int height, unsigned int image_type, \
-							 float *my_image, float *temp_image, \
-							 MPI_Comm MPI_COMM_BSWAP )
+int partial_bswap2_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
+						 	  unsigned int width, unsigned int height, unsigned int image_type, \
+							  float *my_image, float *temp_image, \
+							  MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size; 
 
 	float* bs_send_image_ptr;
 	float* bs_recv_image_ptr;
-	float* bs_pair_image_ptr;
 	float* bs_blnd_image_ptr;
 
+	unsigned int bs_left_node;
 	unsigned int bs_pair_node; 
-	_Bool bs_left_node;
 
 	// ====================================================================
-	// 			 	COMPOSITE TWO IMAGES ( BINARY SWAP )
+	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
 	// ====================================================================
+
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	bs_half_image_size  = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
+
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 		bs_left_node = true;
@@ -4302,60 +6932,31 @@ int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			if (( image_size % 2 ) == 0 ) // EVEN number of pixels
-			{
-				bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-				bs_recv_image_size = bs_half_image_size;
-				bs_send_image_size = bs_recv_image_size;
-			}
-			else // ODD number of pixels
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
-				bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-				bs_recv_image_size = bs_half_image_size;
-				bs_send_image_size = bs_recv_image_size + 1;
+				bs_send_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-			bs_half_image_size = image_size * 0.5;
-
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
-			// For avoiding memory access problem
-			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_recv_image_ptr = my_image;
-		bs_pair_image_ptr = temp_image;
-		bs_blnd_image_ptr = my_image;
-		
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		#endif
 	}
 	else 
@@ -4363,31 +6964,14 @@ int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			if (( image_size % 2 ) == 0 ) // EVEN number of pixels
-			{
-				bs_send_image_size = ( unsigned int )floor( image_size * 0.5 );
-				bs_recv_image_size = bs_send_image_size;
-			}
-			else // ODD number of pixels
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
-				bs_send_image_size = ( unsigned int )floor( image_size * 0.5 );
-				bs_recv_image_size = bs_send_image_size + 1;
+				bs_recv_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-
-			bs_half_image_size = image_size * 0.5;
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
-
-			// For avoiding memory access problem
-			bs_recv_image_size -= global_add_pixels;
 		#endif
 
 		//=====================================
@@ -4399,49 +6983,29 @@ int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		#ifdef _GATHERV
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
-
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#else
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
-
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#endif
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 	}
 	
 	return EXIT_SUCCESS;
+
 }
 
 /*========================================================*/
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 3 NODES (2-3-4 Decomposition)
- *         (RGBA128 Pixels) 
+ *         (RGBAZ160 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -4455,21 +7019,16 @@ int partial_bswap2_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+int partial_bswap3_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
 							 unsigned int width, unsigned int height, unsigned int image_type, \
 							 float *my_image, float *temp_image, \
 							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend, isend_to_0, isend_to_1;
-	MPI_Request irecv, irecv_from_2;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size; 
-
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size; 
+	
 	float* bs_send_image_ptr;
 	float* bs_recv_image_ptr;
-	float* bs_pair_image_ptr;
 	float* bs_blnd_image_ptr;
 
 	unsigned int bs_pair_node; 
@@ -4477,67 +7036,53 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	bs_half_image_size  = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
+
 	if ( my_rank == 0 ) {
 		bs_pair_node = 1; 
 	} else {
 		bs_pair_node = 0; 
 	}
 
-	if ( my_rank == 0 ) // LEFT NODE
+	if ( my_rank == 0 ) // bs_left_node = TRUE;
 	{	
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
-			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			if (( image_size % 2 ) != 0 ) // ODD number of pixels
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
 				bs_send_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-
-			bs_half_image_size = image_size * 0.5;
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
-			// For avoiding memory access problem
-			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_recv_image_ptr = my_image;
-		bs_pair_image_ptr = temp_image;
-		bs_blnd_image_ptr = my_image;
-		
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		#endif
 
 		//=====================================
@@ -4545,55 +7090,31 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		bs_pair_node = 2; 
 
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv_from_2 );
-		MPI_Wait( &irecv_from_2, &status );
+		bs_recv_image_size = bs_half_image_size;
+		recv_image ( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_recv_image_ptr = my_image;
-		bs_pair_image_ptr = temp_image;
-		bs_blnd_image_ptr = my_image;
-		
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		#endif
+
 	}
-	else if ( my_rank == 1 ) // RIGHT NODE
+	else if ( my_rank == 1 ) // bs_left_node = FALSE;
 	{		
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
-			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-
-			bs_send_image_size = bs_half_image_size;
-			bs_recv_image_size = bs_send_image_size;
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			if (( image_size % 2 ) != 0 ) // ODD number of pixels
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
 				bs_recv_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-
-			bs_half_image_size = image_size * 0.5;
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
-
-			//=====================================
-			//  Offset for Image Gathering
-			//=====================================
-			// For avoiding memory access problem
-			bs_recv_image_size -= global_add_pixels;
 		#endif
 
 		//=====================================
@@ -4605,39 +7126,17 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
-
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		#ifdef _GATHERV
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
-
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#else
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
-
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#endif
-
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
 
 		//=====================================
@@ -4645,70 +7144,55 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		bs_pair_node = 2; 
 
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &irecv_from_2 );
-		MPI_Wait( &irecv_from_2, &status );
+		bs_recv_image_size = bs_half_image_size;
+
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
+
+		recv_image ( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		composite_alpha_rgba128 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
 		#endif
+
 	}
 	else if ( my_rank == 2 ) {
+	// ====================================================================
+	// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
+	// ====================================================================
 
-		// ====================================================================
-		// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
-		// ====================================================================
 		//=====================================
-		//  	Image Sending to LEFT NODE
+		//  		Image Sending to 0
 		//=====================================
 		bs_pair_node = 0; 
-
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
-
-			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-			bs_send_image_size = bs_half_image_size;
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-
-			bs_half_image_size = image_size * 0.5;
-			bs_send_image_size = bs_half_image_size;
-		#endif
-
 		bs_send_image_ptr = my_image;
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend_to_0 );
+		bs_send_image_size = bs_half_image_size;
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
 
 		//=====================================
-		//  	Image Sending to RIGHT NODE
+		//  		Image Sending to 1
 		//=====================================
 		bs_pair_node = 1; 
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			if (( image_size % 2 ) != 0 ) // ODD number of pixels
+			if (( image_size % 2 ) != 0 )
 			{
-				bs_send_image_size = bs_half_image_size + 1;
+				bs_send_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			bs_send_image_size = bs_half_image_size - global_add_pixels;
 		#endif
 
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBA );
-
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &isend_to_1 );
-
-		MPI_Wait( &isend_to_0, &status );
-		MPI_Wait( &isend_to_1, &status );
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP );
 	}
 
 	return EXIT_SUCCESS;
@@ -4718,7 +7202,7 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 /**
  *  @brief Traditional Binary-Swap Image Exchange 
  *         GROUP OF 4 NODES (2-3-4 Decomposition)
- *         (RGBA128 Pixels) 
+ *         (RGBAZ160 Pixels) 
  *
  *  @param  my_rank        [in] My Rank
  *  @param  nnodes         [in] Number of Nodes
@@ -4732,28 +7216,37 @@ int partial_bswap3_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
  *  @param  MPI_COMM_BSWAP [in] MPI Communicator
 */
 /*========================================================*/
-int partial_bswap4_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
+int partial_bswap4_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
 							 unsigned int width, unsigned int height, unsigned int image_type, \
 							 float *my_image, float *temp_image, \
 							 MPI_Comm MPI_COMM_BSWAP )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	size_t bs_send_image_size, bs_recv_image_size, bs_half_image_size;
+	size_t image_size;
 
 	float* bs_send_image_ptr;
 	float* bs_recv_image_ptr;
-	float* bs_pair_image_ptr;
 	float* bs_blnd_image_ptr;
 
 	unsigned int bs_pair_node; 
-
+	
 	// ====================================================================
 	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
 	// ====================================================================
+
+	// Power of two number of pixels
+	#ifdef _GATHERV	
+		image_size = (size_t)width * height;
+	#else
+		// Add remaining pixels (Blank Pixels) to become power-of-two
+		image_size = width * height + global_add_pixels; 
+	#endif
+
+	bs_send_image_size = 0;
+
+	bs_half_image_size  = image_size; // width * height
+	bs_half_image_size *= 0.5; // DIV 2
+
 	bs_pair_node = 0;
 
 	if ( my_rank == 0 ) {
@@ -4765,69 +7258,41 @@ int partial_bswap4_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 	} else if ( my_rank == 3 ){
 		bs_pair_node = 2; 
 	}
-
-	// Variable Initialization
-	bs_half_image_size = 0;
-	bs_send_image_size = 0;
-	bs_recv_image_size = 0;
 	
 	// =========================================================
 	// 					BINARY-SWAP STAGE 1
 	// =========================================================
+
 	if (( my_rank == 0 ) || ( my_rank == 2 )) // LEFT NODE
 	{	
 		//=====================================
 		//  LEFT NODE of pair
 		//=====================================
-		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
-
-			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
 
-			if (( image_size % 2 ) != 0 ) // ODD number of pixels
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
 				bs_send_image_size++;
 			}
-		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
-			bs_half_image_size = image_size * 0.5;
-
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
-			// For avoiding memory access problem
-			bs_send_image_size -= global_add_pixels; 
 		#endif
 
 		bs_recv_image_ptr  = temp_image;
 		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
 
 		//=====================================
 		//  Image Exchange between pairs
 		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
-
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, RECV_TAG, MPI_COMM_BSWAP );
 
 		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
 		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_pair_image_ptr = my_image;
-		bs_blnd_image_ptr = my_image;
-
-		composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		composite_alpha_rgbaz160_blend ( my_image, temp_image, my_image, bs_recv_image_size );
 		#endif
 	}
 	else if (( my_rank == 1 ) || ( my_rank == 3 )) // RIGHT NODE
@@ -4835,171 +7300,357 @@ int partial_bswap4_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 		//=====================================
 		//  RIGHT NODE of pair
 		//=====================================
+		bs_send_image_size = bs_half_image_size; 
+		bs_recv_image_size = bs_send_image_size;
+
 		#ifdef _GATHERV	
-			// << MPI_GATHERV >>
-			image_size = width * height;
+			if (( image_size % 2 ) != 0 )
+			{
+				bs_recv_image_size++;
+			}
+		#endif
 
-			bs_half_image_size = ( unsigned int )floor( image_size * 0.5 );
-			bs_send_image_size = bs_half_image_size;
-			bs_recv_image_size = bs_send_image_size;
+		//=====================================
+		//  Offset for Image Gathering
+		//=====================================
+		bs_recv_image_ptr = temp_image;
+		bs_send_image_ptr = my_image;
 
-			if (( image_size % 2 ) != 0 ) // ODD number of pixels
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		exchange_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, SEND_TAG, MPI_COMM_BSWAP );
+
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+
+		#ifdef _NOBLEND
+		#else
+		composite_alpha_rgbaz160_blend ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
+		#endif
+	}
+
+	// =========================================================
+	// 					BINARY-SWAP STAGE 2
+	// =========================================================
+	if ( my_rank == 0 ) // LEFT NODE
+	{
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 2; 
+
+		bs_recv_image_size = bs_half_image_size;
+		recv_image ( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
+
+		#ifdef _NOBLEND
+		#else
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		composite_alpha_rgbaz160_blend ( my_image, temp_image, my_image, bs_recv_image_size );
+		#endif
+	}
+	else if ( my_rank == 1 ) // LEFT NODE
+	{
+		//=====================================
+		// 		Image Receiving from 2
+		//=====================================
+		bs_pair_node = 3; 
+
+		bs_recv_image_size = bs_half_image_size;
+
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
 			{
 				bs_recv_image_size++;
 			}
+		#endif
+
+		recv_image ( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
+
+		#ifdef _NOBLEND
 		#else
-			// << MPI_GATHER >>
-			// Always EVEN number of pixels
-			image_size = width * height + global_add_pixels;
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		bs_blnd_image_ptr  = my_image;
+		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+
+		composite_alpha_rgbaz160_blend ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
+		#endif
+	}
+	else if ( my_rank == 2 )
+	{
+		//=====================================
+		//  		Image Sending to 0
+		//=====================================
+		bs_pair_node = 0; 
+		bs_send_image_ptr = my_image;
+
+		bs_send_image_size = bs_half_image_size;
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP );
+	}
+	else if ( my_rank == 3 )
+	{
+		//=====================================
+		//  		Image Sending to 1
+		//=====================================
+		bs_pair_node = 1; 
+		bs_send_image_ptr  = my_image;
+		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+
+		#ifdef _GATHERV	
+			if (( image_size % 2 ) != 0 )
+			{
+				bs_send_image_size++;
+			}
+		#endif
+
+		send_image ( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP );
+	}
+	
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Piece of the region kept by a node of a Radix-k 
+ *         group. The index of the node inside the group is 
+ *         bit-reversed, so that the final pieces follow the 
+ *         same bit-reversed rank order as Binary-Swap. 
+ *
+ *  @param  member [in] Index of the node inside the group
+ *  @param  radix  [in] Number of nodes of the group (power-of-two)
+*/
+/*========================================================*/
+static unsigned int radixk_piece ( unsigned int member, unsigned int radix )
+{
+	unsigned int piece;
+
+	piece = 0;
+	while ( radix > 1 )
+	{
+		piece   = ( piece << 1 ) | ( member & 1 );
+		member >>= 1;
+		radix  >>= 1;
+	}
+
+	return piece;
+}
+
+/*========================================================*/
+/**
+ *  @brief Number of pixels of a piece inside my image 
+ *         (Blank pixels added for MPI_Gather are excluded)
+ *
+ *  @param  offset     [in] First pixel of the piece
+ *  @param  counts     [in] Number of pixels of the piece
+ *  @param  num_pixels [in] Number of pixels of my image
+*/
+/*========================================================*/
+static unsigned int radixk_valid_pixels ( unsigned int offset, unsigned int counts, \
+					  unsigned int num_pixels )
+{
+	if ( offset >= num_pixels ) 
+	{
+		return 0;
+	}
+
+	return (( num_pixels - offset ) < counts ) ? ( num_pixels - offset ) : counts;
+}
+
+/*========================================================*/
+/**
+ *  @brief Radix-k rounds. In each round the nodes are split 
+ *         into groups of k nodes, the region of the group is 
+ *         split into k pieces, and each node receives one 
+ *         piece from the other k-1 nodes and composites them 
+ *         in rank order (lower rank in front). 
+ *         The pieces are composited in place (my_image).
+ *
+ *  @param  my_rank      [in]  My Rank
+ *  @param  nnodes       [in]  Number of Nodes (power-of-two)
+ *  @param  first_stride [in]  Distance between the nodes of the first group
+ *  @param  num_pixels   [in]  Number of pixels of my image
+ *  @param  image_ID     [in]  Pixel ID
+ *  @param  my_image     [in]  Image Data
+ *  @param  comp_image   [out] Composited region
+ *  @param  bs_offset    [in,out] Offset of my region (pixels)
+ *  @param  bs_counts    [in,out] Size of my region (pixels)
+ *  @param  MPI_COMM_RADIXK [in] MPI Communicator
+*/
+/*========================================================*/
+static int radixk_rounds ( unsigned int my_rank, unsigned int nnodes, unsigned int first_stride, \
+			   unsigned int num_pixels, unsigned int image_ID, \
+			   BYTE *my_image, BYTE **comp_image, \
+			   unsigned int *bs_offset, unsigned int *bs_counts, \
+			   MPI_Comm MPI_COMM_RADIXK )
+{
+	unsigned int m;
+	size_t pixel_size;
+
+	unsigned int rk_stride;
+	unsigned int rk_radix;
+	unsigned int rk_member;
+	unsigned int rk_first_node;
+	unsigned int rk_round;
+
+	unsigned int rk_region_offset, rk_region_counts;
+	unsigned int rk_piece, rk_piece_offset, rk_piece_counts;
+	unsigned int rk_valid_pixels, rk_send_pixels;
+
+	BYTE* rk_temp_image_ptr;
+	BYTE* rk_blnd_image_ptr;
+	BYTE* rk_recv_image_ptr;
+
+	MPI_Request* rk_isend;
+	MPI_Request* rk_irecv;
+
+	switch ( image_ID ) {
+		case ID_RGBA32: rk_temp_image_ptr = temp_image_rgba32;
+                    break;
+		case ID_RGBA56: rk_temp_image_ptr = temp_image_rgba56;
+                    break;
+		case ID_RGBA64: rk_temp_image_ptr = temp_image_rgba64;
+                    break;
+		case ID_RGBAZ64: rk_temp_image_ptr = temp_image_rgbaz64;
+                     break;
+		case ID_RGBAZ88: rk_temp_image_ptr = temp_image_rgbaz88;
+                     break;
+		case ID_RGBAZ96: rk_temp_image_ptr = temp_image_rgbaz96;
+                     break;
+		case ID_RGBA128: rk_temp_image_ptr = (BYTE *)temp_image_rgba128;
+                     break;
+		case ID_RGBAZ160: rk_temp_image_ptr = (BYTE *)temp_image_rgbaz160;
+                     break;
+		default: printf( "<<< ERROR >> Radix-k: Undefined Pixel ID \n" );
+			 return EXIT_FAILURE;
+ 	}
 
-			bs_half_image_size = image_size * 0.5;
-			bs_recv_image_size = bs_half_image_size;
-			bs_send_image_size = bs_recv_image_size;
+	pixel_size = global_image_type;
 
-			// For avoiding memory access problem
-			bs_recv_image_size -= global_add_pixels;
-		#endif
+	rk_isend = (MPI_Request *)malloc( 2 * bswap_radix * sizeof(MPI_Request) );
+	if ( rk_isend == NULL )
+	{
+		printf( "<<< ERROR >> Cannot allocate memory for the MPI requests \n" );
+		return EXIT_FAILURE;
+	}
+	rk_irecv = rk_isend + bswap_radix;
 
-		//=====================================
-		//  Offset for Image Gathering
-		//=====================================
-		bs_recv_image_ptr = temp_image;
-		bs_send_image_ptr = my_image;
+	rk_region_offset = *bs_offset;
+	rk_region_counts = *bs_counts;
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+	// Numbered as the Binary-Swap stages ( Composition statistics )
+	rk_round = ( first_stride > 1 ) ? 1 : 0;
+
+	for ( rk_stride = first_stride; rk_stride < nnodes; rk_stride *= rk_radix )
+	{
+		begin_stats_phase ( (int)rk_round++ );
+
+		// The last round takes the remaining factor of nnodes
+		rk_radix = bswap_radix;
+		if (( nnodes / rk_stride ) < rk_radix ) 
+		{
+			rk_radix = nnodes / rk_stride;
+		}
 
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+		rk_member     = ( my_rank / rk_stride ) % rk_radix;
+		rk_first_node = my_rank - rk_member * rk_stride;
 
 		//=====================================
-		//  Image Compositing (Alpha or Depth)
+		//  My piece of the region
 		//=====================================
-		#ifdef _GATHERV
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+		rk_piece = radixk_piece ( rk_member, rk_radix );
 
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#else
-			bs_pair_image_ptr  = my_image;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBA );
+		rk_piece_offset = rk_region_offset + \
+				  (unsigned int)(( (unsigned long long)rk_piece * rk_region_counts ) / rk_radix );
+		rk_piece_counts = rk_region_offset + \
+				  (unsigned int)(( (unsigned long long)( rk_piece + 1 ) * rk_region_counts ) / rk_radix ) - rk_piece_offset;
 
-			bs_blnd_image_ptr  = temp_image;
-			bs_blnd_image_ptr += ( bs_send_image_size * RGBA );
-		#endif
+		rk_valid_pixels   = radixk_valid_pixels ( rk_piece_offset, rk_piece_counts, num_pixels );
+		rk_blnd_image_ptr = my_image + rk_piece_offset * pixel_size;
 
-		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
-		#else
-		composite_alpha_rgba128 ( temp_image, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
-	}
-	// =========================================================
-	// 					BINARY-SWAP STAGE 2
-	// =========================================================
-	if ( my_rank == 0 ) // LEFT NODE
-	{
 		//=====================================
-		// 		Image Receiving from 2
+		//  Image Exchange inside the group
 		//=====================================
-		bs_pair_node = 2; 
+		for ( m = 0; m < rk_radix; m++ )
+		{
+			rk_irecv[ m ] = MPI_REQUEST_NULL;
+			if (( m == rk_member ) || ( rk_valid_pixels == 0 )) continue;
 
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+			rk_recv_image_ptr = rk_temp_image_ptr + \
+					    (( m < rk_member ) ? m : m - 1 ) * rk_piece_counts * pixel_size;
 
-		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		bs_recv_image_ptr = my_image;
-		bs_pair_image_ptr = temp_image;
-		bs_blnd_image_ptr = my_image;
+			irecv_persistent( rk_recv_image_ptr, rk_valid_pixels * pixel_size, MPI_BYTE, \
+					  rk_first_node + m * rk_stride, PAIR_TAG, MPI_COMM_RADIXK, &rk_irecv[ m ] );
+		}
 
-		composite_alpha_rgba128 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
-	}
-	else if ( my_rank == 1 ) // RIGHT NODE
-	{
-		//=====================================
-		// 		Image Receiving from 3
-		//=====================================
-		bs_pair_node = 3; 
+		for ( m = 0; m < rk_radix; m++ )
+		{
+			rk_isend[ m ] = MPI_REQUEST_NULL;
+			if ( m == rk_member ) continue;
 
-		#ifdef _GATHERV
-			image_size = width * height;
-			bs_half_image_size = (int)floor( image_size * 0.5 );
+			rk_piece = radixk_piece ( m, rk_radix );
 
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_recv_image_size = bs_half_image_size + 1;
-			}
-		#else
-			image_size = width * height + global_add_pixels;
-			bs_half_image_size = image_size * 0.5;
-			bs_recv_image_size = bs_half_image_size - global_add_pixels;
-		#endif
+			rk_piece_offset = rk_region_offset + \
+					  (unsigned int)(( (unsigned long long)rk_piece * rk_region_counts ) / rk_radix );
+			rk_send_pixels  = radixk_valid_pixels ( rk_piece_offset, rk_region_offset + \
+					  (unsigned int)(( (unsigned long long)( rk_piece + 1 ) * rk_region_counts ) / rk_radix ) - rk_piece_offset, \
+					  num_pixels );
 
-		bs_recv_image_ptr  = temp_image;
+			if ( rk_send_pixels == 0 ) continue;
 
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+			isend_persistent( my_image + rk_piece_offset * pixel_size, rk_send_pixels * pixel_size, MPI_BYTE, \
+					  rk_first_node + m * rk_stride, PAIR_TAG, MPI_COMM_RADIXK, &rk_isend[ m ] );
+		}
 
-		#ifdef _NOBLEND
-		//=====================================
-		// No Image Composition (For Test)
-		//=====================================
-		#else
 		//=====================================
 		//  Image Compositing (Alpha or Depth)
 		//=====================================
-		bs_pair_image_ptr  = temp_image;
-		bs_pair_image_ptr += ( bs_send_image_size * RGBA );
-		bs_blnd_image_ptr  = bs_pair_image_ptr;
+		// Nodes with lower rank (OVER) in front of my piece
+		for ( m = rk_member; m > 0; m-- )
+		{
+			wait_request( &rk_irecv[ m - 1 ], MPI_STATUS_IGNORE );
 
-		composite_alpha_rgba128 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
-	}
-	else if ( my_rank == 2 )
-	{
-		//=====================================
-		//  		Image Sending to 0
-		//=====================================
-		bs_pair_node = 0; 
-		bs_send_image_size = bs_half_image_size;
+			rk_recv_image_ptr = rk_temp_image_ptr + ( m - 1 ) * rk_piece_counts * pixel_size;
+			composite_pixels ( image_ID, rk_recv_image_ptr, rk_blnd_image_ptr, rk_blnd_image_ptr, rk_valid_pixels );
+		}
 
-		bs_send_image_ptr = my_image;
+		// Nodes with higher rank (UNDER) behind my piece
+		for ( m = rk_member + 1; m < rk_radix; m++ )
+		{
+			wait_request( &rk_irecv[ m ], MPI_STATUS_IGNORE );
+
+			rk_recv_image_ptr = rk_temp_image_ptr + ( m - 1 ) * rk_piece_counts * pixel_size;
+			composite_pixels ( image_ID, rk_blnd_image_ptr, rk_recv_image_ptr, rk_blnd_image_ptr, rk_valid_pixels );
+		}
+
+		wait_all_requests( (int)rk_radix, rk_isend, MPI_STATUSES_IGNORE );
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		rk_region_offset = ( rk_blnd_image_ptr - my_image ) / pixel_size;
+		rk_region_counts = rk_piece_counts;
 	}
-	else if ( my_rank == 3 )
-	{
-		//=====================================
-		//  		Image Sending to 1
-		//=====================================
-		bs_pair_node = 1; 
 
-		#ifdef _GATHERV
-			bs_send_image_size = bs_recv_image_size;
-		#else
-			bs_send_image_size = bs_half_image_size - global_add_pixels;
-		#endif
+	free( rk_isend );
 
-		bs_send_image_ptr  = temp_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBA );
+	*bs_offset  = rk_region_offset;
+	*bs_counts  = rk_region_counts;
+	*comp_image = my_image + rk_region_offset * pixel_size;
+
+	// Blank pixels added for MPI_Gather are not part of my_image
+	if (( rk_region_offset + rk_region_counts ) > num_pixels )
+	{
+		rk_valid_pixels = radixk_valid_pixels ( rk_region_offset, rk_region_counts, num_pixels );
+
+		memcpy( rk_temp_image_ptr, *comp_image, rk_valid_pixels * pixel_size );
+		memset( rk_temp_image_ptr + rk_valid_pixels * pixel_size, 0x00, \
+			( rk_region_counts - rk_valid_pixels ) * pixel_size );
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBA, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		*comp_image = rk_temp_image_ptr;
 	}
 
 	return EXIT_SUCCESS;
@@ -5007,799 +7658,1252 @@ int partial_bswap4_rgba128 ( unsigned int my_rank, unsigned int nnodes, \
 
 /*========================================================*/
 /**
- *  @brief Traditional Binary-Swap Image Exchange 
- *         From STAGE 2, After 234Composition
- *         (RGBAZ160 Pixels) 
+ *  @brief Radix-k Image Compositing 
+ *         ( Alternative to Binary-Swap, see Set_234Composition_Radix )
+ *         (RGBA32, RGBA56, RGBA64, RGBAZ64, RGBAZ88, RGBAZ96, 
+ *          RGBA128 and RGBAZ160 Pixels) 
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  bs_offset      [in] Offset for MPI_Gatherv
- *  @param  bs_counts      [in] Counts for MPI_Gatherv
- *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+ *  @param  my_rank    [in]  My Rank
+ *  @param  nnodes     [in]  Number of Nodes (power-of-two)
+ *  @param  width      [in]  Image Width
+ *  @param  height     [in]  Image Height
+ *  @param  image_ID   [in]  Pixel ID
+ *  @param  my_image   [in]  Image Data 
+ *  @param  comp_image [out] Composited region
+ *  @param  bs_offset  [out] Offset of the composited region (pixels)
+ *  @param  bs_counts  [out] Size of the composited region (pixels)
+ *  @param  MPI_COMM_RADIXK [in] MPI Communicator
 */
 /*========================================================*/
-int stage2_bswap_rgbaz160 (  unsigned int my_rank, unsigned int nnodes, \
-							unsigned int width, unsigned int height, unsigned int image_type, \
-							float *my_image, float **comp_image, \
-							unsigned int *bs_offset, unsigned int *bs_counts, \
-							MPI_Comm MPI_COMM_BSWAP )
+int radixk_image ( unsigned int my_rank, unsigned int nnodes, \
+		   unsigned int width, unsigned int height, unsigned int image_ID, \
+		   BYTE *my_image, BYTE **comp_image, \
+		   unsigned int *bs_offset, unsigned int *bs_counts, \
+		   MPI_Comm MPI_COMM_RADIXK )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
-
-	unsigned int bs_send_image_size, bs_recv_image_size;
-	unsigned int image_size; 
+	#ifdef _GATHERV	
+		// << MPI_GATHERV >>
+		*bs_counts = width * height;
+	#else 
+		// << MPI_GATHER >>
+		*bs_counts = width * height + global_add_pixels; 
+	#endif
+	*bs_offset = 0;
 
-	float* bs_send_image_ptr;
-	float* bs_pair_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+	return radixk_rounds ( my_rank, nnodes, 1, width * height, image_ID, \
+			       my_image, comp_image, bs_offset, bs_counts, MPI_COMM_RADIXK );
+}
 
-	unsigned int bs_left_node, bs_pair_offset;
-	unsigned int bs_stage, bs_max_stage;
-	unsigned int bs_pair_node; 
+/*========================================================*/
+/**
+ *  @brief Radix-k Image Compositing from Stage 2
+ *         ( After the 2-3-4 Decomposition, each pair of nodes 
+ *           of the group_bswap list holds one half of the image )
+ *
+ *  @param  my_rank    [in]  My Rank (2nd stage)
+ *  @param  nnodes     [in]  Number of Nodes (2nd stage, power-of-two)
+ *  @param  width      [in]  Image Width
+ *  @param  height     [in]  Image Height
+ *  @param  image_ID   [in]  Pixel ID
+ *  @param  my_image   [in]  Image Data 
+ *  @param  comp_image [out] Composited region
+ *  @param  bs_offset  [out] Offset of the composited region (pixels)
+ *  @param  bs_counts  [out] Size of the composited region (pixels)
+ *  @param  MPI_COMM_RADIXK [in] MPI Communicator
+*/
+/*========================================================*/
+int stage2_radixk_image ( unsigned int my_rank, unsigned int nnodes, \
+			  unsigned int width, unsigned int height, unsigned int image_ID, \
+			  BYTE *my_image, BYTE **comp_image, \
+			  unsigned int *bs_offset, unsigned int *bs_counts, \
+			  MPI_Comm MPI_COMM_RADIXK )
+{
+	size_t image_size;
 
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
-	// ====================================================================
-	
-	// Power of two number of pixels
 	#ifdef _GATHERV	
-		image_size = width * height;
+		image_size = (size_t)width * height;
 	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
 		image_size = width * height + global_add_pixels; 
 	#endif
 
-	#ifdef C99
-		bs_max_stage = (unsigned int)( log2( (double) nnodes ));
-	#else
-		bs_max_stage = (unsigned int)( (float)log( nnodes ) * M_LOG2E );
-	#endif
+	// STAGE 1 ( Left or right half of the image )
+	if (( my_rank % 2 ) == 0 )
+	{
+		*bs_offset = 0;
+		*bs_counts = image_size >> 1;
+	}
+	else 
+	{
+		*bs_offset = image_size >> 1;
+		*bs_counts = image_size - ( image_size >> 1 );
 
-	bs_recv_image_size = 0;
+		// The right half is left in the temporary buffer (RGBA128 Pixels)
+		if ( image_ID == ID_RGBA128 )
+		{
+			memcpy( my_image + *bs_offset * RGBA128, (BYTE *)temp_image_rgba128 + *bs_offset * RGBA128, \
+				radixk_valid_pixels ( *bs_offset, *bs_counts, width * height ) * RGBA128 );
+		}
+	}
 
-	bs_send_image_size = image_size >> 1; // width * height / 2
-	*bs_counts = (unsigned int)0;
+	return radixk_rounds ( my_rank, nnodes, 2, width * height, image_ID, \
+			       my_image, comp_image, bs_offset, bs_counts, MPI_COMM_RADIXK );
+}
 
-	// STAGE 1
-	if ((( my_rank % 4 ) == 0 )  || (( my_rank % 4 ) == 2 ))
+/*========================================================*/
+/**
+ *  @brief Intra-node Image Compositing in shared memory
+ *         ( Hierarchical composition )
+ *         Every rank of the node composites its own range 
+ *         of pixels of all the images, front ( Rank 0 ) to 
+ *         back, into the image of Rank 0. No data is copied: 
+ *         the images are read in the shared memory window.
+ *
+ *  @param  my_rank       [in]  My Rank (node)
+ *  @param  nnodes        [in]  Number of Ranks (node)
+ *  @param  image_size    [in]  Number of pixels
+ *  @param  image_ID      [in]  Pixel ID
+ *  @param  pixel_size    [in]  Bytes per pixel
+ *  @param  node_images [in,out] Image of every rank of the node
+*/
+/*========================================================*/
+int shared_composite_image ( unsigned int my_rank, unsigned int nnodes, \
+			     size_t image_size, unsigned int image_ID, size_t pixel_size, \
+			     BYTE **node_images )
+{
+	unsigned int k;
+
+	size_t sh_offset;	// First pixel of my range
+	size_t sh_counts;	// Number of pixels of my range
+	size_t sh_remain;	// Remainder pixels
+
+	sh_counts = image_size / nnodes;
+	sh_remain = image_size % nnodes;
+
+	sh_offset = my_rank * sh_counts + (( my_rank < sh_remain ) ? my_rank : sh_remain );
+	if ( my_rank < sh_remain ) sh_counts++;
+
+	if ( sh_counts == 0 ) return EXIT_SUCCESS;
+
+	for ( k = 1; k < nnodes; k++ )
 	{
-		*bs_offset = (unsigned int)0;
-		bs_blnd_image_ptr = my_image;
+		composite_pixels ( image_ID, node_images[ 0 ] + sh_offset * pixel_size, \
+				   node_images[ k ] + sh_offset * pixel_size, \
+				   node_images[ 0 ] + sh_offset * pixel_size, (unsigned int)sh_counts );
 	}
-	else 
+
+	return EXIT_SUCCESS;
+}
+
+/*========================================================*/
+/**
+ *  @brief Create an MPI datatype for the same pixel range 
+ *         of every image plane (Planar Pixels). 
+ *         The displacements are absolute addresses, so the 
+ *         datatype must be used with MPI_BOTTOM.
+ *
+ *  @param  image_planes [in]  Pointers to the image planes
+ *  @param  num_planes   [in]  Number of planes (RGBA or RGBAZ)
+ *  @param  offset       [in]  First pixel of the range
+ *  @param  counts       [in]  Number of pixels of the range
+ *  @param  planes_type  [out] MPI datatype
+*/
+/*========================================================*/
+static void create_planes_type ( float** image_planes, unsigned int num_planes, \
+				 unsigned int offset, unsigned int counts, \
+				 MPI_Datatype* planes_type )
+{
+	unsigned int k;
+
+	int      block_length[ RGBAZ ];
+	MPI_Aint block_address[ RGBAZ ];
+
+	for ( k = 0; k < num_planes; k++ )
 	{
-		*bs_offset = (unsigned int)bs_send_image_size;
-		bs_blnd_image_ptr = my_image + *bs_offset * RGBAZ; 
+		block_length[ k ] = (int)counts;
+		MPI_Get_address( image_planes[ k ] + offset, &block_address[ k ] );
+	}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_send_image_size++;
-			}
-		#endif
+	MPI_Type_create_hindexed( (int)num_planes, block_length, block_address, MPI_FLOAT, planes_type );
+	MPI_Type_commit( planes_type );
+}
+
+/*========================================================*/
+/**
+ *  @brief Blend the planes of two images (Planar Pixels)
+ *
+ *  @param  num_planes   [in]  RGBA (Alpha) or RGBAZ (Depth)
+ *  @param  over_planes  [in]  Image to be blended (OVER)
+ *  @param  under_planes [in]  Image to be blended (UNDER)
+ *  @param  blend_planes [out] Blended image 
+ *  @param  image_size   [in]  Number of pixels
+*/
+/*========================================================*/
+static void composite_planes_FLOAT ( unsigned int num_planes, \
+				     float** over_planes, float** under_planes, float** blend_planes, \
+				     unsigned int image_size )
+{
+	#ifdef _NOBLEND
+	#else
+	if ( num_planes == RGBA )
+	{
+		composite_alpha_rgba128_planar ( over_planes, under_planes, blend_planes, image_size );
+	}
+	else
+	{
+		composite_alpha_rgbaz160_planar ( over_planes, under_planes, blend_planes, image_size );
+	}
+	#endif
+}
+
+/*========================================================*/
+/**
+ *  @brief Binary-Swap Image Composition (Planar Pixels:
+ *         RGBA128 and RGBAZ160). 
+ *         Each stage sends the same pixel range of every 
+ *         plane and blends in place, so the composited pixels 
+ *         [bs_offset, bs_offset + bs_counts) stay in image_planes.
+ *         For a non-power-of-two number of nodes, the first 
+ *         ( nnodes - 2^n ) odd ranks send their whole image to 
+ *         the preceding rank beforehand and do not take part 
+ *         in the Binary-Swap ( bs_counts = 0 ).
+ *
+ *  @param  my_rank        [in]  MPI rank
+ *  @param  nnodes         [in]  Number of nodes
+ *  @param  width          [in]  Image width
+ *  @param  height         [in]  Image height
+ *  @param  num_planes     [in]  RGBA (Alpha) or RGBAZ (Depth)
+ *  @param  image_planes   [in,out]  Pointers to the image planes
+ *  @param  temp_image     [in]  Receive buffer 
+ *  @param  bs_offset      [out] First composited pixel
+ *  @param  bs_counts      [out] Number of composited pixels
+ *  @param  MPI_COMM_BSWAP [in]  MPI Communicator
+*/
+/*========================================================*/
+int planar_bswap_float ( unsigned int my_rank, unsigned int nnodes, \
+			 unsigned int width, unsigned int height, unsigned int num_planes, \
+			 float** image_planes, float* temp_image, \
+			 unsigned int* bs_offset, unsigned int* bs_counts, \
+			 MPI_Comm MPI_COMM_BSWAP )
+{
+	unsigned int k;
+	size_t image_size;
+
+	unsigned int bs_nnodes;
+	unsigned int bs_extra_nodes;
+	unsigned int bs_my_rank;
+	unsigned int bs_pair_rank;
+	unsigned int bs_pair_node;
+	unsigned int bs_pair_offset;
+	unsigned int bs_stage;
+
+	unsigned int bs_keep_offset;
+	unsigned int bs_keep_size;
+	unsigned int bs_send_offset;
+	unsigned int bs_send_size;
+	unsigned int bs_half_size;
+
+	int bs_send_tag;
+	int bs_recv_tag;
+
+	_Bool bs_left_node;
+
+	double start;
+
+	float* bs_my_planes  [ RGBAZ ];
+	float* bs_recv_planes[ RGBAZ ];
+
+	MPI_Datatype bs_send_type;
+	MPI_Status   status;
+	MPI_Request  isend;
+	MPI_Request  irecv;
+
+	image_size = (size_t)width * height;
+
+	// Largest power-of-two number of nodes
+	bs_nnodes = 1;
+	while (( bs_nnodes * 2 ) <= nnodes )
+	{
+		bs_nnodes *= 2;
 	}
+	bs_extra_nodes = nnodes - bs_nnodes;
 
-	// STAGE 2
-	for ( bs_stage = 1; bs_stage < bs_max_stage; bs_stage++ )
+	*bs_offset = 0;
+	*bs_counts = 0;
+
+	//=====================================
+	//  Reduce to power-of-two number of nodes
+	//=====================================
+	if ( my_rank < ( 2 * bs_extra_nodes ))
 	{
-		bs_pair_offset = (int) pow( (double)2, (double)bs_stage ); 
+		begin_stats_phase ( STATS_PARTIAL );
 
-		bs_left_node = false;
-		if ((( my_rank / bs_pair_offset ) % 2 ) == 0 )
+		if (( my_rank % 2 ) == 1 )
 		{
-			bs_left_node = true;
+			create_planes_type ( image_planes, num_planes, 0, image_size, &bs_send_type );
+			count_transfer ( true, (size_t)num_planes * image_size, MPI_FLOAT );
+
+			start = MPI_Wtime();
+			MPI_Send( MPI_BOTTOM, 1, bs_send_type, my_rank - 1, SEND_TAG, MPI_COMM_BSWAP );
+			composition_stats.wait_time += MPI_Wtime() - start;
+
+			MPI_Type_free( &bs_send_type );
+
+			return EXIT_SUCCESS;
 		}
-	
-		if ( bs_left_node == true )
-		{		
-			//=====================================
-			//  LEFT NODE of pair
-			//=====================================
 
-			bs_pair_node = my_rank + bs_pair_offset;
+		recv_large( temp_image, num_planes * image_size, MPI_FLOAT, my_rank + 1, SEND_TAG, MPI_COMM_BSWAP );
 
-			#ifdef _GATHERV	
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_recv_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_send_image_size = bs_recv_image_size + 1;
-				}
-			#else
-				// Always EVEN number of pixels
-				bs_send_image_size *= 0.5; // DIV 2
-				bs_recv_image_size = bs_send_image_size;
-			#endif
+		for ( k = 0; k < num_planes; k++ )
+		{
+			bs_recv_planes[ k ] = temp_image + k * image_size;
+		}
 
-			bs_recv_image_ptr  = temp_image_rgbaz160;
-			bs_pair_image_ptr  = bs_blnd_image_ptr;
-			bs_send_image_ptr  = bs_pair_image_ptr ;
-			bs_send_image_ptr += ( bs_recv_image_size * RGBAZ );
+		// Lower rank (OVER)
+		composite_planes_FLOAT ( num_planes, image_planes, bs_recv_planes, image_planes, image_size );
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		bs_my_rank = my_rank / 2;
+	}
+	else
+	{
+		bs_my_rank = my_rank - bs_extra_nodes;
+	}
 
-			MPI_Wait( &isend, &status );
-			MPI_Wait( &irecv, &status );
+	//=====================================
+	//  Binary-Swap
+	//=====================================
+	bs_keep_offset = 0;
+	bs_keep_size   = image_size;
 
-			#ifdef _NOBLEND
-			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgbaz160 ( bs_pair_image_ptr, bs_recv_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+	bs_stage = 0;
 
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
+	for ( bs_pair_offset = 1; bs_pair_offset < bs_nnodes; bs_pair_offset *= 2 )
+	{
+		begin_stats_phase ( (int)bs_stage++ );
+
+		bs_half_size = bs_keep_size / 2;
+
+		bs_left_node = ((( bs_my_rank / bs_pair_offset ) % 2 ) == 0 );
+
+		if ( bs_left_node == true )
+		{
+			bs_pair_rank   = bs_my_rank + bs_pair_offset;
+			bs_send_offset = bs_keep_offset + bs_half_size;
+			bs_send_size   = bs_keep_size - bs_half_size;
+			bs_keep_size   = bs_half_size;
+			bs_send_tag    = SEND_TAG;
+			bs_recv_tag    = RECV_TAG;
+		}
+		else // RIGHT NODE
+		{
+			bs_pair_rank    = bs_my_rank - bs_pair_offset;
+			bs_send_offset  = bs_keep_offset;
+			bs_send_size    = bs_half_size;
+			bs_keep_offset += bs_half_size;
+			bs_keep_size   -= bs_half_size;
+			bs_send_tag     = RECV_TAG;
+			bs_recv_tag     = SEND_TAG;
 		}
-		else 
-		{		
-			//=====================================
-			//  RIGHT NODE of pair
-			//=====================================
 
-			bs_pair_node = my_rank - bs_pair_offset;
+		bs_pair_node = ( bs_pair_rank < bs_extra_nodes ) ? ( 2 * bs_pair_rank ) : ( bs_pair_rank + bs_extra_nodes );
 
-			#ifdef _GATHERV	
-				if (( bs_send_image_size % 2 ) == 0 ) // EVEN number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size;
-				}
-				else // ODD number of pixels
-				{
-					bs_send_image_size = ( unsigned int )floor( bs_send_image_size * 0.5 );
-					bs_recv_image_size = bs_send_image_size + 1;
-				}
-			#else
-				// Always EVEN number of pixels
-				bs_send_image_size *= 0.5; // DIV 2
-				bs_recv_image_size = bs_send_image_size;
-			#endif
+		//=====================================
+		//  Image Exchange between pairs
+		//=====================================
+		create_planes_type ( image_planes, num_planes, bs_send_offset, bs_send_size, &bs_send_type );
 
-			//=====================================
-			//  Offset for Image Gathering
-			//=====================================
-			*bs_offset += bs_send_image_size;
-			
-			bs_recv_image_ptr  = temp_image_rgbaz160;
-			bs_send_image_ptr  = bs_blnd_image_ptr;
-			bs_pair_image_ptr  = bs_send_image_ptr ;
-			bs_pair_image_ptr += ( bs_send_image_size * RGBAZ );
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
+		irecv_large( temp_image, (size_t)num_planes * bs_keep_size, MPI_FLOAT, bs_pair_node, bs_recv_tag, MPI_COMM_BSWAP, &irecv );
+		count_transfer ( true, (size_t)num_planes * bs_send_size, MPI_FLOAT );
+		MPI_Isend( MPI_BOTTOM, 1, bs_send_type, bs_pair_node, bs_send_tag, MPI_COMM_BSWAP, &isend );
 
-			//=====================================
-			//  Image Exchange between pairs
-			//=====================================
-			MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-			MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+		wait_request( &isend, &status );
+		wait_request( &irecv, &status );
 
-			MPI_Wait( &irecv, &status );
-			MPI_Wait( &isend, &status );
+		MPI_Type_free( &bs_send_type );
 
-			#ifdef _NOBLEND
-			#else
-			//=====================================
-			//  Image Compositing (Alpha or Depth)
-			//=====================================
-			composite_alpha_rgbaz160 ( bs_recv_image_ptr, bs_pair_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-			#endif
+		//=====================================
+		//  Image Compositing (Alpha or Depth)
+		//=====================================
+		for ( k = 0; k < num_planes; k++ )
+		{
+			bs_my_planes  [ k ] = image_planes[ k ] + bs_keep_offset;
+			bs_recv_planes[ k ] = temp_image + (size_t)k * bs_keep_size;
+		}
 
-			bs_blnd_image_ptr  = bs_pair_image_ptr;
-			bs_send_image_size = bs_recv_image_size;
+		if ( bs_left_node == true ) // LEFT NODE (OVER)
+		{
+			composite_planes_FLOAT ( num_planes, bs_my_planes, bs_recv_planes, bs_my_planes, bs_keep_size );
+		}
+		else // RIGHT NODE (UNDER)
+		{
+			composite_planes_FLOAT ( num_planes, bs_recv_planes, bs_my_planes, bs_my_planes, bs_keep_size );
 		}
 	}
 
-	*bs_counts  = bs_recv_image_size;
-	*comp_image = (float *)bs_blnd_image_ptr;
+	*bs_offset = bs_keep_offset;
+	*bs_counts = bs_keep_size;
 
 	return EXIT_SUCCESS;
 }
 
-
 /*========================================================*/
 /**
- *  @brief Traditional Binary-Swap Image Exchange 
- *         GROUP OF 2 NODES (2-3-4 Decomposition)
- *         (RGBAZ160 Pixels) 
+ *  @brief Gather the composited pixel ranges of every node
+ *         into a planar image on the ROOT_NODE (Planar Pixels).
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  bs_offset      [in] Offset for MPI_Gatherv
- *  @param  bs_counts      [in] Counts for MPI_Gatherv
- *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+ *  @param  my_rank      [in]  MPI rank
+ *  @param  nnodes       [in]  Number of nodes
+ *  @param  width        [in]  Image width
+ *  @param  height       [in]  Image height
+ *  @param  num_planes   [in]  RGBA or RGBAZ
+ *  @param  image_planes [in]  Pointers to the image planes
+ *  @param  bs_offset    [in]  First composited pixel
+ *  @param  bs_counts    [in]  Number of composited pixels
+ *  @param  gather_image [out] Gathered planar image (ROOT_NODE)
+ *  @param  MPI_COMM_GATHER [in]  MPI Communicator
 */
 /*========================================================*/
-int partial_bswap2_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
-						 	  unsigned int width, unsigned int height, unsigned int image_type, \
-							  float *my_image, float *temp_image, \
-							  MPI_Comm MPI_COMM_BSWAP )
+int gather_planar_float ( unsigned int my_rank, unsigned int nnodes, \
+			  unsigned int width, unsigned int height, unsigned int num_planes, \
+			  float** image_planes, unsigned int bs_offset, unsigned int bs_counts, \
+			  float* gather_image, MPI_Comm MPI_COMM_GATHER )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	unsigned int i, k;
+	size_t image_size;
+	unsigned int num_requests;
+	unsigned int counts_offset[2];
 
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size; 
+	MPI_Datatype planes_type;
+	MPI_Request* irecv;
 
-	float* bs_send_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+	image_size = (size_t)width * height;
 
-	unsigned int bs_left_node;
-	unsigned int bs_pair_node; 
+	counts_offset[0] = bs_counts;
+	counts_offset[1] = bs_offset;
 
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES ( BINARY SWAP )
-	// ====================================================================
+	MPI_Gather( counts_offset, 2, MPI_UNSIGNED, bs_gatherv_counts_offset, 2, MPI_UNSIGNED, ROOT_NODE, MPI_COMM_GATHER );
 
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif
+	if ( my_rank == ROOT_NODE )
+	{
+		if (( irecv = (MPI_Request *)malloc( nnodes * sizeof(MPI_Request) )) == NULL )
+		{
+			printf( "<<< ERROR >> Cannot allocate memory for the MPI requests \n" );
+			return EXIT_FAILURE;
+		}
 
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
+		num_requests = 0;
+		for ( i = 0; i < nnodes; i++ )
+		{
+			bs_counts = (unsigned int)bs_gatherv_counts_offset[ 2 * i     ];
+			bs_offset = (unsigned int)bs_gatherv_counts_offset[ 2 * i + 1 ];
 
-	if ( my_rank == 0 ) {
-		bs_pair_node = 1; 
-		bs_left_node = true;
-	} else {
-		bs_pair_node = 0; 
-		bs_left_node = false;
+			if (( i == ROOT_NODE ) || ( bs_counts == 0 ))
+			{
+				continue;
+			}
+
+			MPI_Type_vector( (int)num_planes, (int)bs_counts, (int)image_size, MPI_FLOAT, &planes_type );
+			MPI_Type_commit( &planes_type );
+
+			MPI_Irecv( gather_image + bs_offset, 1, planes_type, i, SEND_TAG, MPI_COMM_GATHER, &irecv[ num_requests++ ] );
+
+			MPI_Type_free( &planes_type );
+		}
+
+		// Composited pixels of the ROOT_NODE
+		bs_counts = (unsigned int)bs_gatherv_counts_offset[ 2 * ROOT_NODE     ];
+		bs_offset = (unsigned int)bs_gatherv_counts_offset[ 2 * ROOT_NODE + 1 ];
+
+		for ( k = 0; k < num_planes; k++ )
+		{
+			memcpy( gather_image + k * image_size + bs_offset, image_planes[ k ] + bs_offset, bs_counts * sizeof(float) );
+		}
+
+		MPI_Waitall( (int)num_requests, irecv, MPI_STATUSES_IGNORE );
+
+		free( irecv );
+	}
+	else if ( bs_counts > 0 )
+	{
+		create_planes_type ( image_planes, num_planes, bs_offset, bs_counts, &planes_type );
+		MPI_Send( MPI_BOTTOM, 1, planes_type, ROOT_NODE, SEND_TAG, MPI_COMM_GATHER );
+		MPI_Type_free( &planes_type );
 	}
 
-	if ( bs_left_node == true )
-	{		
-		//=====================================
-		//  LEFT NODE of pair
-		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
+	return EXIT_SUCCESS;
+}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_send_image_size++;
-			}
-		#endif
+/*========================================================*/
+/**
+ *  @brief Create an MPI datatype for the same pixel range 
+ *         of the color and depth segments (Split RGBAZ Pixels). 
+ *         The displacements are absolute addresses, so the 
+ *         datatype must be used with MPI_BOTTOM.
+ *
+ *  @param  color_image [in]  RGBA values ( Interleaved pixels )
+ *  @param  color_size  [in]  Bytes of the RGBA values of a pixel
+ *  @param  depth_image [in]  Depth values ( NULL: RGBA values only )
+ *  @param  offset      [in]  First pixel of the range
+ *  @param  counts      [in]  Number of pixels of the range
+ *  @param  split_type  [out] MPI datatype
+*/
+/*========================================================*/
+static void create_split_type ( BYTE* color_image, unsigned int color_size, const float* depth_image, \
+				unsigned int offset, unsigned int counts, MPI_Datatype* split_type )
+{
+	int          num_blocks;
+	int          block_length [ 2 ];
+	MPI_Aint     block_address[ 2 ];
+	MPI_Datatype block_type   [ 2 ];
 
-		bs_recv_image_ptr  = temp_image;
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+	MPI_Type_contiguous( (int)color_size, MPI_BYTE, &block_type[ 0 ] );
+	block_type[ 1 ] = MPI_FLOAT;
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+	block_length[ 0 ] = (int)counts;
+	block_length[ 1 ] = (int)counts;
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+	MPI_Get_address( color_image + (size_t)offset * color_size, &block_address[ 0 ] );
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgbaz160 ( my_image, temp_image, my_image, bs_recv_image_size );
-		#endif
+	num_blocks = 1;
+	if ( depth_image != NULL )
+	{
+		MPI_Get_address( (void *)( depth_image + offset ), &block_address[ 1 ] );
+		num_blocks = 2;
 	}
-	else 
-	{		
-		//=====================================
-		//  RIGHT NODE of pair
-		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_recv_image_size++;
-			}
-		#endif
+	MPI_Type_create_struct( num_blocks, block_length, block_address, block_type, split_type );
+	MPI_Type_commit( split_type );
+
+	MPI_Type_free( &block_type[ 0 ] );
+}
+
+/*========================================================*/
+/**
+ *  @brief Blend the color and depth segments of two images 
+ *         (Split RGBAZ Pixels)
+ *
+ *  @param  pixel_ID    [in]  RGBAZ64 or RGBAZ160
+ *  @param  over_color  [in]  RGBA values to be blended (OVER)
+ *  @param  over_depth  [in]  Depth values to be blended (OVER)
+ *  @param  under_color [in]  RGBA values to be blended (UNDER)
+ *  @param  under_depth [in]  Depth values to be blended (UNDER)
+ *  @param  blend_color [out] Blended RGBA values
+ *  @param  blend_depth [out] Blended depth values
+ *  @param  image_size  [in]  Number of pixels
+*/
+/*========================================================*/
+static void composite_split_rgbaz ( unsigned int pixel_ID, \
+				    BYTE* over_color,  float* over_depth, \
+				    BYTE* under_color, float* under_depth, \
+				    BYTE* blend_color, float* blend_depth, \
+				    unsigned int image_size )
+{
+	#ifdef _NOBLEND
+	#else
+	if ( pixel_ID == ID_RGBAZ64 )
+	{
+		composite_alpha_rgbaz64_split ( over_color, over_depth, under_color, under_depth, \
+						blend_color, blend_depth, image_size );
+	}
+	else
+	{
+		composite_alpha_rgbaz160_split ( (float *)over_color, over_depth, (float *)under_color, under_depth, \
+						 (float *)blend_color, blend_depth, image_size );
+	}
+	#endif
+}
+
+/*========================================================*/
+/**
+ *  @brief First rank of a group of the 2-3-4 decomposition 
+ *         ( See create_234_communicators )
+ *
+ *  @param  group       [in] Group
+ *  @param  num_groups  [in] Number of groups
+ *  @param  group_base  [in] Nodes of the smaller groups
+ *  @param  group_over  [in] Number of larger groups ( group_base + 1 nodes )
+*/
+/*========================================================*/
+static unsigned int icomp_group_first ( unsigned int group, unsigned int num_groups, \
+					unsigned int group_base, unsigned int group_over )
+{
+	if ( group < ( num_groups - group_over ))
+	{
+		return group * group_base;
+	}
 
-		//=====================================
-		//  Offset for Image Gathering
-		//=====================================
-		bs_recv_image_ptr = temp_image;
-		bs_send_image_ptr = my_image;
+	return (( num_groups - group_over ) * group_base ) + (( group - ( num_groups - group_over )) * ( group_base + 1 ));
+}
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+/*========================================================*/
+/**
+ *  @brief Append a stage to the schedule of a node
+ *
+ *  @param  stages      [in,out] Schedule
+ *  @param  num_stages  [in,out] Number of stages
+ *  @param  phase       [in] STATS_PARTIAL or Binary-Swap stage
+ *  @param  blnd_offset [in] First pixel blended by the node
+ *  @param  blnd_counts [in] Number of pixels blended by the node
+ *  @return New stage
+*/
+/*========================================================*/
+static Compositor234_Stage* icomp_add_stage ( Compositor234_Stage* stages, unsigned int* num_stages, int phase, \
+					      unsigned int blnd_offset, unsigned int blnd_counts )
+{
+	Compositor234_Stage* stage;
 
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+	stage = &stages[ (*num_stages)++ ];
+	memset( stage, 0x00, sizeof(Compositor234_Stage) );
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+	stage->phase       = phase;
+	stage->blnd_offset = blnd_offset;
+	stage->blnd_counts = blnd_counts;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgbaz160 ( bs_recv_image_ptr, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
-	}
-	
-	return EXIT_SUCCESS;
+	return stage;
+}
 
+/*========================================================*/
+/**
+ *  @brief Add a node to a stage
+ *
+ *  @param  stage       [in,out] Stage
+ *  @param  pair_node   [in] MPI Rank of the node
+ *  @param  send_offset [in] First pixel sent to the node
+ *  @param  send_counts [in] Number of pixels sent to the node ( 0: None )
+ *  @param  recv        [in] Pixels of the blended range received from the node
+*/
+/*========================================================*/
+static void icomp_add_pair ( Compositor234_Stage* stage, unsigned int pair_node, \
+			     unsigned int send_offset, unsigned int send_counts, _Bool recv )
+{
+	stage->pair_node  [ stage->num_pairs ] = (int)pair_node;
+	stage->send_offset[ stage->num_pairs ] = send_offset;
+	stage->send_counts[ stage->num_pairs ] = send_counts;
+	stage->recv       [ stage->num_pairs ] = recv;
+	stage->num_pairs++;
 }
 
 /*========================================================*/
 /**
- *  @brief Traditional Binary-Swap Image Exchange 
- *         GROUP OF 3 NODES (2-3-4 Decomposition)
- *         (RGBAZ160 Pixels) 
+ *  @brief Add a blend to a stage
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  bs_offset      [in] Offset for MPI_Gatherv
- *  @param  bs_counts      [in] Counts for MPI_Gatherv
- *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+ *  @param  stage   [in,out] Stage
+ *  @param  over    [in] Image in front ( ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE or ICOMP_RECV_IMAGE2 )
+ *  @param  under   [in] Image behind
+ *  @param  reverse [in] Images exchanged ( RGBAZ88 and RGBAZ96 of the 
+ *                       2-3-4 partial stage and of the 3 node Direct-Send )
 */
 /*========================================================*/
-int partial_bswap3_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
-							 unsigned int width, unsigned int height, unsigned int image_type, \
-							 float *my_image, float *temp_image, \
-							 MPI_Comm MPI_COMM_BSWAP )
+static void icomp_add_blend ( Compositor234_Stage* stage, unsigned int over, unsigned int under, _Bool reverse )
 {
-	MPI_Status  status;
-	MPI_Request isend, isend_to_0, isend_to_1;
-	MPI_Request irecv;
+	stage->blnd_over [ stage->num_blends ] = ( reverse == true ) ? under : over;
+	stage->blnd_under[ stage->num_blends ] = ( reverse == true ) ? over : under;
+	stage->num_blends++;
+}
 
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size; 
-	
-	float* bs_send_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+/*========================================================*/
+/**
+ *  @brief Append a Binary-Swap stage: the pair nodes exchange 
+ *         one half of their pixel range and blend the other
+ *
+ *  @param  stages     [in,out] Schedule
+ *  @param  num_stages [in,out] Number of stages
+ *  @param  phase      [in] STATS_PARTIAL or Binary-Swap stage
+ *  @param  pair_node  [in] MPI Rank of the pair node
+ *  @param  left_node  [in] LEFT node of the pair (OVER)
+ *  @param  reverse    [in] Images exchanged ( See icomp_add_blend )
+ *  @param  offset     [in,out] First pixel of the range of the node
+ *  @param  counts     [in,out] Number of pixels of the range of the node
+*/
+/*========================================================*/
+static void icomp_add_exchange ( Compositor234_Stage* stages, unsigned int* num_stages, int phase, \
+				 unsigned int pair_node, _Bool left_node, _Bool reverse, \
+				 unsigned int* offset, unsigned int* counts )
+{
+	Compositor234_Stage* stage;
+	unsigned int half_counts;
 
-	unsigned int bs_pair_node; 
+	half_counts = *counts / 2;
 
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
-	// ====================================================================
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif
+	if ( left_node == true )
+	{
+		stage = icomp_add_stage ( stages, num_stages, phase, *offset, half_counts );
+		icomp_add_pair  ( stage, pair_node, *offset + half_counts, *counts - half_counts, true );
+		icomp_add_blend ( stage, ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE, reverse );
 
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
+		*counts = half_counts;
+	}
+	else // RIGHT NODE
+	{
+		stage = icomp_add_stage ( stages, num_stages, phase, *offset + half_counts, *counts - half_counts );
+		icomp_add_pair  ( stage, pair_node, *offset, half_counts, true );
+		icomp_add_blend ( stage, ICOMP_RECV_IMAGE, ICOMP_MY_IMAGE, reverse );
 
-	if ( my_rank == 0 ) {
-		bs_pair_node = 1; 
-	} else {
-		bs_pair_node = 0; 
+		*offset += half_counts;
+		*counts -= half_counts;
 	}
+}
 
-	if ( my_rank == 0 ) // bs_left_node = TRUE;
-	{	
+/*========================================================*/
+/**
+ *  @brief Schedule of a node for the stages of Do_234Composition: 
+ *         Binary-Swap ( Power-of-two number of nodes ), 3 node 
+ *         Direct-Send, or 2-3-4 partial stage followed by the 
+ *         2nd stage Binary-Swap. The pixels are blended in the 
+ *         same order, so the composited image is the same. 
+ *
+ *  @param  my_rank      [in]  MPI Rank of the node
+ *  @param  nnodes       [in]  Number of nodes
+ *  @param  pixel_ID     [in]  Pixel ID
+ *  @param  image_size   [in]  Number of pixels
+ *  @param  stages       [out] Schedule ( ICOMP_MAX_STAGES )
+ *  @param  num_stages   [out] Number of stages
+ *  @param  final_offset [out] First pixel composited by the node
+ *  @param  final_counts [out] Number of pixels composited by the node ( 0: None )
+ *  @return Number of pixels received by the node at a time
+*/
+/*========================================================*/
+static unsigned int build_schedule ( unsigned int my_rank, unsigned int nnodes, \
+				     unsigned int pixel_ID, unsigned int image_size, \
+				     Compositor234_Stage* stages, unsigned int* num_stages, \
+				     unsigned int* final_offset, unsigned int* final_counts )
+{
+	unsigned int i;
+	unsigned int recv_pixels;
+	unsigned int num_recv;
+
+	unsigned int offset;
+	unsigned int counts;
+	unsigned int half_counts;
+	unsigned int block_counts;
+	unsigned int pair_offset;
+	unsigned int pair_rank;
+	unsigned int bs_stage;
+
+	unsigned int num_groups;
+	unsigned int group_base;
+	unsigned int group_over;
+	unsigned int group_threshold;
+	unsigned int group;
+	unsigned int group_first;
+	unsigned int group_nnodes;
+	unsigned int group_rank;
+	unsigned int stage2_rank;
+
+	_Bool left_node;
+	_Bool reverse;
+	_Bool second_stage;
+
+	Compositor234_Stage* stage;
+
+	*num_stages = 0;
+
+	offset = 0;
+	counts = image_size;
+
+	// RGBAZ88 and RGBAZ96: images exchanged by the 2-3-4 
+	// partial stage and the 3 node Direct-Send
+	reverse = (( pixel_ID == ID_RGBAZ88 ) || ( pixel_ID == ID_RGBAZ96 ));
+
+	if ( nnodes == 3 )
+	{
 		//=====================================
-		//  LEFT NODE of pair
+		//  Direct-Send: one third of the image per node
 		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
-
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_send_image_size++;
-			}
-		#endif
+		block_counts = image_size / 3;
 
-		bs_recv_image_ptr  = temp_image;
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+		offset = my_rank * block_counts;
+		counts = ( my_rank == 2 ) ? ( image_size - 2 * block_counts ) : block_counts;
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		stage = icomp_add_stage ( stages, num_stages, STATS_PARTIAL, offset, counts );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		for ( i = 0; i < 3; i++ )
+		{
+			if ( i != my_rank )
+			{
+				icomp_add_pair ( stage, i, i * block_counts, \
+						 ( i == 2 ) ? ( image_size - 2 * block_counts ) : block_counts, true );
+			}
+		}
 
-		#ifdef _NOBLEND
-		#else
+		// 0 over ( 1 over 2 )
+		if ( my_rank == 0 )
+		{
+			icomp_add_blend ( stage, ICOMP_RECV_IMAGE, ICOMP_RECV_IMAGE2, reverse );
+			icomp_add_blend ( stage, ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE, reverse );
+		}
+		else if ( my_rank == 1 )
+		{
+			icomp_add_blend ( stage, ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE2, reverse );
+			icomp_add_blend ( stage, ICOMP_RECV_IMAGE, ICOMP_MY_IMAGE, reverse );
+		}
+		else
+		{
+			icomp_add_blend ( stage, ICOMP_RECV_IMAGE2, ICOMP_MY_IMAGE, reverse );
+			icomp_add_blend ( stage, ICOMP_RECV_IMAGE, ICOMP_MY_IMAGE, reverse );
+		}
+	}
+	else if ( check_pow2 ( nnodes ) == true )
+	{
 		//=====================================
-		//  Image Compositing (Alpha or Depth)
+		//  Binary-Swap
 		//=====================================
-		composite_alpha_rgbaz160 ( my_image, temp_image, my_image, bs_recv_image_size );
-		#endif
+		bs_stage = 0;
+		for ( pair_offset = 1; pair_offset < nnodes; pair_offset *= 2 )
+		{
+			left_node = ((( my_rank / pair_offset ) % 2 ) == 0 );
+			pair_rank = ( left_node == true ) ? ( my_rank + pair_offset ) : ( my_rank - pair_offset );
 
+			icomp_add_exchange ( stages, num_stages, (int)bs_stage++, pair_rank, left_node, false, &offset, &counts );
+		}
+	}
+	else
+	{
 		//=====================================
-		// 		Image Receiving from 2
+		//  2-3-4 Decomposition
 		//=====================================
-		bs_pair_node = 2; 
-
-		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+		num_groups = get_nearest_pow2 ( nnodes ) / 2;
+		group_base = nnodes / num_groups;
+		group_over = nnodes % num_groups;
+		group_threshold = nnodes - ( group_over * ( group_base + 1 ));
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgbaz160 ( my_image, temp_image, my_image, bs_recv_image_size );
-		#endif
+		if ( my_rank < group_threshold )
+		{
+			group = my_rank / group_base;
+		}
+		else
+		{
+			group = ( num_groups - group_over ) + (( my_rank - group_threshold ) / ( group_base + 1 ));
+		}
 
-	}
-	else if ( my_rank == 1 ) // bs_left_node = FALSE;
-	{		
-		//=====================================
-		//  RIGHT NODE of pair
-		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
+		group_first  = icomp_group_first ( group, num_groups, group_base, group_over );
+		group_nnodes = ( my_rank < group_threshold ) ? group_base : ( group_base + 1 );
+		group_rank   = my_rank - group_first;
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_recv_image_size++;
-			}
-		#endif
+		// Partial stage: the composited image of the group is left 
+		// on its first two nodes ( lower and upper half )
+		second_stage = ( group_rank < 2 );
 
-		//=====================================
-		//  Offset for Image Gathering
-		//=====================================
-		bs_recv_image_ptr = temp_image;
-		bs_send_image_ptr = my_image;
+		if (( group_nnodes == 3 ) && ( group_rank == 2 ))
+		{
+			half_counts = image_size / 2;
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+			stage = icomp_add_stage ( stages, num_stages, STATS_PARTIAL, 0, 0 );
+			icomp_add_pair ( stage, group_first,     0, half_counts, false );
+			icomp_add_pair ( stage, group_first + 1, half_counts, image_size - half_counts, false );
 
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+			counts = 0;
+		}
+		else
+		{
+			left_node = (( group_rank % 2 ) == 0 );
+			pair_rank = ( left_node == true ) ? ( my_rank + 1 ) : ( my_rank - 1 );
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+			icomp_add_exchange ( stages, num_stages, STATS_PARTIAL, pair_rank, left_node, reverse, &offset, &counts );
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgbaz160 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
+			if (( group_nnodes == 3 ) || (( group_nnodes == 4 ) && ( group_rank < 2 )))
+			{
+				stage = icomp_add_stage ( stages, num_stages, STATS_PARTIAL, offset, counts );
+				icomp_add_pair  ( stage, ( group_nnodes == 3 ) ? ( group_first + 2 ) : ( my_rank + 2 ), 0, 0, true );
+				icomp_add_blend ( stage, ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE, reverse );
+			}
+			else if ( group_nnodes == 4 )
+			{
+				stage = icomp_add_stage ( stages, num_stages, STATS_PARTIAL, 0, 0 );
+				icomp_add_pair ( stage, my_rank - 2, offset, counts, false );
 
-		//=====================================
-		// 		Image Receiving from 2
-		//=====================================
-		bs_pair_node = 2; 
+				counts = 0;
+			}
+		}
 
-		bs_recv_image_size = bs_half_image_size;
+		// 2nd stage Binary-Swap between the first two nodes of the groups
+		if ( second_stage == true )
+		{
+			stage2_rank = ( 2 * group ) + group_rank;
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
+			bs_stage = 1;
+			for ( pair_offset = 2; pair_offset < ( 2 * num_groups ); pair_offset *= 2 )
 			{
-				bs_recv_image_size++;
+				left_node = ((( stage2_rank / pair_offset ) % 2 ) == 0 );
+				pair_rank = ( left_node == true ) ? ( stage2_rank + pair_offset ) : ( stage2_rank - pair_offset );
+				pair_rank = icomp_group_first ( pair_rank / 2, num_groups, group_base, group_over ) + ( pair_rank % 2 );
+
+				icomp_add_exchange ( stages, num_stages, (int)bs_stage++, pair_rank, left_node, false, &offset, &counts );
 			}
-		#endif
+		}
+	}
 
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+	*final_offset = ( counts > 0 ) ? offset : 0;
+	*final_counts = counts;
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgbaz160 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
+	// Receive buffer: blended range of each node of the stage
+	recv_pixels = 0;
+	for ( i = 0; i < *num_stages; i++ )
+	{
+		num_recv = ( stages[ i ].recv[ 0 ] ? 1 : 0 ) + ( stages[ i ].recv[ 1 ] ? 1 : 0 );
 
+		if ( recv_pixels < ( num_recv * stages[ i ].blnd_counts ))
+		{
+			recv_pixels = num_recv * stages[ i ].blnd_counts;
+		}
 	}
-	else if ( my_rank == 2 ) {
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES 0 , 1 with 2 ( BINARY SWAP )
-	// ====================================================================
 
-		//=====================================
-		//  		Image Sending to 0
-		//=====================================
-		bs_pair_node = 0; 
-		bs_send_image_ptr = my_image;
+	return recv_pixels;
+}
 
-		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend_to_0 );
+/*========================================================*/
+/**
+ *  @brief Schedule of my node ( See build_schedule )
+ *
+ *  @param  request [in,out] Composition ( my_rank, nnodes, 
+ *                           pixel_ID and image_size )
+ *  @return Number of pixels of recv_image
+*/
+/*========================================================*/
+unsigned int icomp_schedule ( Compositor234_Request* request )
+{
+	return build_schedule ( request->my_rank, request->nnodes, request->pixel_ID, request->image_size, \
+				request->stages, &request->num_stages, \
+				&request->final_offset, &request->final_counts );
+}
 
-		//=====================================
-		//  		Image Sending to 1
-		//=====================================
-		bs_pair_node = 1; 
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+/*========================================================*/
+/**
+ *  @brief Create an MPI datatype for a pixel range of the 
+ *         image being composited or of a receive buffer
+ *
+ *  @param  request    [in]  Composition
+ *  @param  image      [in]  Pixels ( RGBA values of split pixels )
+ *  @param  depth      [in]  Depth values of split pixels ( NULL: None )
+ *  @param  offset     [in]  First pixel of the range
+ *  @param  counts     [in]  Number of pixels of the range
+ *  @param  icomp_type [out] MPI datatype ( Used with MPI_BOTTOM )
+*/
+/*========================================================*/
+static void icomp_create_type ( Compositor234_Request* request, BYTE* image, const float* depth, \
+				unsigned int offset, unsigned int counts, MPI_Datatype* icomp_type )
+{
+	create_split_type ( image, (unsigned int)request->color_size, ( request->my_depth != NULL ) ? depth : NULL, \
+			    offset, counts, icomp_type );
+}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_send_image_size++;
-			}
-		#endif
+/*========================================================*/
+/**
+ *  @brief Pixels ( and depth values ) of an image of a stage
+ *
+ *  @param  request [in]  Composition
+ *  @param  stage   [in]  Stage
+ *  @param  operand [in]  ICOMP_MY_IMAGE, ICOMP_RECV_IMAGE or ICOMP_RECV_IMAGE2
+ *  @param  blend   [in]  Blended pixels ( Depth values of my node: blnd_depth )
+ *  @param  image   [out] First pixel of the blended range
+ *  @param  depth   [out] First depth value of the blended range ( Split pixels )
+*/
+/*========================================================*/
+static void icomp_stage_image ( Compositor234_Request* request, Compositor234_Stage* stage, \
+				unsigned int operand, _Bool blend, BYTE** image, float** depth )
+{
+	if ( operand == ICOMP_MY_IMAGE )
+	{
+		*image = request->my_image + (size_t)stage->blnd_offset * request->color_size;
+		*depth = (( blend == true ) || ( request->has_blnd_depth == true )) ? \
+			 request->blnd_depth : (float *)request->my_depth;
+	}
+	else
+	{
+		*image = request->recv_image + (size_t)( operand - ICOMP_RECV_IMAGE ) * stage->blnd_counts * request->pixel_size;
+		*depth = (float *)( *image + (size_t)stage->blnd_counts * request->color_size );
+	}
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_12_TAG, MPI_COMM_BSWAP, &isend_to_1 );
-		MPI_Wait( &isend_to_0, &status );
-		MPI_Wait( &isend_to_1, &status );
+	if (( operand == ICOMP_MY_IMAGE ) && ( *depth != NULL ))
+	{
+		*depth += stage->blnd_offset;
 	}
-
-	return EXIT_SUCCESS;
 }
 
 /*========================================================*/
 /**
- *  @brief Traditional Binary-Swap Image Exchange 
- *         GROUP OF 4 NODES (2-3-4 Decomposition)
- *         (RGBAZ160 Pixels) 
+ *  @brief Post the receives and sends of the current stage
  *
- *  @param  my_rank        [in] My Rank
- *  @param  nnodes         [in] Number of Nodes
- *  @param  width          [in] Image Width
- *  @param  height         [in] Image Height
- *  @param  image_type     [in] Image Type
- *  @param  my_image       [in] Image Data 
- *  @param  temp_image     [in] Temporary Buffer
- *  @param  bs_offset      [in] Offset for MPI_Gatherv
- *  @param  bs_counts      [in] Counts for MPI_Gatherv
- *  @param  MPI_COMM_BSWAP [in] MPI Communicator
+ *  @param  request [in,out] Composition
 */
 /*========================================================*/
-int partial_bswap4_rgbaz160 ( unsigned int my_rank, unsigned int nnodes, \
-							 unsigned int width, unsigned int height, unsigned int image_type, \
-							 float *my_image, float *temp_image, \
-							 MPI_Comm MPI_COMM_BSWAP )
+static void icomp_post_stage ( Compositor234_Request* request )
 {
-	MPI_Status  status;
-	MPI_Request isend;
-	MPI_Request irecv;
+	unsigned int i;
+	unsigned int num_recv;
 
-	unsigned int bs_send_image_size, bs_recv_image_size, bs_half_image_size;
-	unsigned int image_size;
+	BYTE*  stage_image;
+	float* stage_depth;
 
-	float* bs_send_image_ptr;
-	float* bs_recv_image_ptr;
-	float* bs_blnd_image_ptr;
+	MPI_Datatype stage_type;
+	Compositor234_Stage* stage;
 
-	unsigned int bs_pair_node; 
-	
-	// ====================================================================
-	// 			 	COMPOSITE IMAGES 0 and 1 ( BINARY SWAP )
-	// ====================================================================
+	stage = &request->stages[ request->cur_stage ];
 
-	// Power of two number of pixels
-	#ifdef _GATHERV	
-		image_size = width * height;
-	#else
-		// Add remaining pixels (Blank Pixels) to become power-of-two
-		image_size = width * height + global_add_pixels; 
-	#endif
+	if ( request->record_stats == true )
+	{
+		begin_stats_phase ( stage->phase );
+	}
 
-	bs_send_image_size = 0;
+	request->num_requests = 0;
+	request->state = ICOMP_STAGE;
 
-	bs_half_image_size  = image_size; // width * height
-	bs_half_image_size *= 0.5; // DIV 2
+	num_recv = 0;
+	for ( i = 0; i < stage->num_pairs; i++ )
+	{
+		// Nothing is sent for an empty range ( Images smaller than nnodes )
+		if (( stage->recv[ i ] == false ) || ( stage->blnd_counts == 0 ))
+		{
+			continue;
+		}
 
-	bs_pair_node = 0;
+		icomp_stage_image ( request, stage, ICOMP_RECV_IMAGE + num_recv++, false, &stage_image, &stage_depth );
+		icomp_create_type ( request, stage_image, stage_depth, 0, stage->blnd_counts, &stage_type );
 
-	if ( my_rank == 0 ) {
-		bs_pair_node = 1; 
-	} else if ( my_rank == 1 ){
-		bs_pair_node = 0; 
-	} else if ( my_rank == 2 ){
-		bs_pair_node = 3; 
-	} else if ( my_rank == 3 ){
-		bs_pair_node = 2; 
-	}
-	
-	// =========================================================
-	// 					BINARY-SWAP STAGE 1
-	// =========================================================
+		if ( request->record_stats == true )
+		{
+			count_transfer ( false, 1, stage_type );
+		}
 
-	if (( my_rank == 0 ) || ( my_rank == 2 )) // LEFT NODE
-	{	
-		//=====================================
-		//  LEFT NODE of pair
-		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
+		MPI_Irecv( MPI_BOTTOM, 1, stage_type, stage->pair_node[ i ], request->tag + ICOMP_STAGE, \
+			   request->comm, &request->requests[ request->num_requests++ ] );
+		MPI_Type_free( &stage_type );
+	}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_send_image_size++;
-			}
-		#endif
+	// Depth values of my pixels
+	stage_depth = ( request->has_blnd_depth == true ) ? request->blnd_depth : (float *)request->my_depth;
 
-		bs_recv_image_ptr  = temp_image;
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+	for ( i = 0; i < stage->num_pairs; i++ )
+	{
+		if ( stage->send_counts[ i ] == 0 )
+		{
+			continue;
+		}
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &irecv );
+		icomp_create_type ( request, request->my_image, stage_depth, \
+				    stage->send_offset[ i ], stage->send_counts[ i ], &stage_type );
 
-		MPI_Wait( &isend, &status );
-		MPI_Wait( &irecv, &status );
+		if ( request->record_stats == true )
+		{
+			count_transfer ( true, 1, stage_type );
+		}
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgbaz160 ( my_image, temp_image, my_image, bs_recv_image_size );
-		#endif
+		MPI_Isend( MPI_BOTTOM, 1, stage_type, stage->pair_node[ i ], request->tag + ICOMP_STAGE, \
+			   request->comm, &request->requests[ request->num_requests++ ] );
+		MPI_Type_free( &stage_type );
 	}
-	else if (( my_rank == 1 ) || ( my_rank == 3 )) // RIGHT NODE
-	{		
-		//=====================================
-		//  RIGHT NODE of pair
-		//=====================================
-		bs_send_image_size = bs_half_image_size; 
-		bs_recv_image_size = bs_send_image_size;
+}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
-			{
-				bs_recv_image_size++;
-			}
-		#endif
+/*========================================================*/
+/**
+ *  @brief Blend the pixels received at the current stage
+ *
+ *  @param  request [in,out] Composition
+*/
+/*========================================================*/
+static void icomp_blend_stage ( Compositor234_Request* request )
+{
+	unsigned int i;
+	unsigned int blnd;
 
-		//=====================================
-		//  Offset for Image Gathering
-		//=====================================
-		bs_recv_image_ptr = temp_image;
-		bs_send_image_ptr = my_image;
+	BYTE*  over_image;
+	BYTE*  under_image;
+	BYTE*  blnd_image;
+	float* over_depth;
+	float* under_depth;
+	float* blnd_depth;
 
-		//=====================================
-		//  Image Exchange between pairs
-		//=====================================
-		MPI_Irecv( bs_recv_image_ptr, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, SEND_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, RECV_TAG, MPI_COMM_BSWAP, &isend );
+	Compositor234_Stage* stage;
 
-		MPI_Wait( &irecv, &status );
-		MPI_Wait( &isend, &status );
+	stage = &request->stages[ request->cur_stage ];
 
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+	for ( i = 0; i < stage->num_blends; i++ )
+	{
+		blnd = (( stage->blnd_over[ i ] == ICOMP_MY_IMAGE ) || ( stage->blnd_under[ i ] == ICOMP_MY_IMAGE )) ? \
+		       ICOMP_MY_IMAGE : ICOMP_RECV_IMAGE;
 
-		#ifdef _NOBLEND
-		#else
-		composite_alpha_rgbaz160 ( temp_image, bs_blnd_image_ptr, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
+		icomp_stage_image ( request, stage, stage->blnd_over [ i ], false, &over_image,  &over_depth );
+		icomp_stage_image ( request, stage, stage->blnd_under[ i ], false, &under_image, &under_depth );
+		icomp_stage_image ( request, stage, blnd, true, &blnd_image, &blnd_depth );
+
+		if (( request->nnodes == 3 ) && ( request->pixel_ID == ID_RGBA32 ))
+		{
+			// Look-Up Table of the 3 node Direct-Send ( See dsend3_rgba_BYTE )
+			#ifdef _NOBLEND
+			#else
+			composite_alpha_rgba32 ( over_image, under_image, blnd_image, stage->blnd_counts );
+			#endif
+		}
+		else if ( request->my_depth == NULL )
+		{
+			composite_pixels ( request->pixel_ID, over_image, under_image, blnd_image, stage->blnd_counts );
+		}
+		else
+		{
+			composite_split_rgbaz ( request->pixel_ID, over_image, over_depth, under_image, under_depth, \
+						blnd_image, blnd_depth, stage->blnd_counts );
+
+			if ( blnd == ICOMP_MY_IMAGE )
+			{
+				request->has_blnd_depth = true;
+			}
+		}
 	}
+}
 
-	// =========================================================
-	// 					BINARY-SWAP STAGE 2
-	// =========================================================
-	if ( my_rank == 0 ) // LEFT NODE
+/*========================================================*/
+/**
+ *  @brief Post the final image gathering into my_image of 
+ *         the ROOT_NODE ( RGBA values only for split pixels )
+ *
+ *  @param  request [in,out] Composition
+*/
+/*========================================================*/
+static void icomp_post_gather ( Compositor234_Request* request )
+{
+	if ( request->record_stats == true )
 	{
-		//=====================================
-		// 		Image Receiving from 2
-		//=====================================
-		bs_pair_node = 2; 
+		begin_stats_phase ( STATS_GATHER );
+	}
 
-		bs_recv_image_size = bs_half_image_size;
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+	request->num_requests = 0;
+	request->state = ICOMP_GATHER;
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		composite_alpha_rgbaz160 ( my_image, temp_image, my_image, bs_recv_image_size );
-		#endif
-	}
-	else if ( my_rank == 1 ) // LEFT NODE
+	#ifdef _NOGATHER
+		// NO FINAL IMAGE GATHERING
+	#else
+	unsigned int i;
+	unsigned int num_stages;
+	unsigned int final_offset;
+	unsigned int final_counts;
+
+	MPI_Datatype gather_type;
+	Compositor234_Stage stages[ ICOMP_MAX_STAGES ];
+
+	if ( request->my_rank == ROOT_NODE )
 	{
-		//=====================================
-		// 		Image Receiving from 2
-		//=====================================
-		bs_pair_node = 3; 
+		for ( i = 0; i < request->nnodes; i++ )
+		{
+			if ( i == ROOT_NODE )
+			{
+				continue;
+			}
 
-		bs_recv_image_size = bs_half_image_size;
+			build_schedule ( i, request->nnodes, request->pixel_ID, request->image_size, \
+					 stages, &num_stages, &final_offset, &final_counts );
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
+			if ( final_counts == 0 )
 			{
-				bs_recv_image_size++;
+				continue;
 			}
-		#endif
 
-		MPI_Irecv( temp_image, bs_recv_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &irecv );
-		MPI_Wait( &irecv, &status );
+			icomp_create_type ( request, request->my_image, NULL, final_offset, final_counts, &gather_type );
 
-		#ifdef _NOBLEND
-		#else
-		//=====================================
-		//  Image Compositing (Alpha or Depth)
-		//=====================================
-		bs_blnd_image_ptr  = my_image;
-		bs_blnd_image_ptr += ( bs_half_image_size * RGBAZ );
+			if ( request->record_stats == true )
+			{
+				count_transfer ( false, 1, gather_type );
+			}
 
-		composite_alpha_rgbaz160 ( bs_blnd_image_ptr, temp_image, bs_blnd_image_ptr, bs_recv_image_size );
-		#endif
+			MPI_Irecv( MPI_BOTTOM, 1, gather_type, (int)i, request->tag + ICOMP_GATHER, \
+				   request->comm, &request->requests[ request->num_requests++ ] );
+			MPI_Type_free( &gather_type );
+		}
 	}
-	else if ( my_rank == 2 )
+	else if ( request->final_counts > 0 )
 	{
-		//=====================================
-		//  		Image Sending to 0
-		//=====================================
-		bs_pair_node = 0; 
-		bs_send_image_ptr = my_image;
+		icomp_create_type ( request, request->my_image, NULL, request->final_offset, request->final_counts, &gather_type );
 
-		bs_send_image_size = bs_half_image_size;
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_02_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
+		if ( request->record_stats == true )
+		{
+			count_transfer ( true, 1, gather_type );
+		}
+
+		MPI_Isend( MPI_BOTTOM, 1, gather_type, ROOT_NODE, request->tag + ICOMP_GATHER, \
+			   request->comm, &request->requests[ request->num_requests++ ] );
+		MPI_Type_free( &gather_type );
 	}
-	else if ( my_rank == 3 )
+	#endif
+}
+
+/*========================================================*/
+/**
+ *  @brief Start a composition following the schedule of 
+ *         my node ( See icomp_schedule ). recv_image holds 
+ *         the number of pixels returned by icomp_schedule, and 
+ *         requests nnodes + 4 MPI requests.
+ *
+ *  @param  request [in,out] Composition
+*/
+/*========================================================*/
+void icomp_begin ( Compositor234_Request* request )
+{
+	request->cur_stage = 0;
+	request->has_blnd_depth = false;
+
+	if ( request->num_stages > 0 )
 	{
-		//=====================================
-		//  		Image Sending to 1
-		//=====================================
-		bs_pair_node = 1; 
-		bs_send_image_ptr  = my_image;
-		bs_send_image_ptr += ( bs_half_image_size * RGBAZ );
+		icomp_post_stage ( request );
+	}
+	else
+	{
+		icomp_post_gather ( request );
+	}
+}
 
-		#ifdef _GATHERV	
-			if (( image_size % 2 ) != 0 )
+/*========================================================*/
+/**
+ *  @brief Advance a composition. Each stage is blended as 
+ *         soon as its messages have arrived and the messages 
+ *         of the next stage are posted.
+ *
+ *  @param  request  [in,out] Composition
+ *  @param  blocking [in]  Wait until the composition is completed
+ *  @return true when the composition is completed
+*/
+/*========================================================*/
+_Bool icomp_progress ( Compositor234_Request* request, _Bool blocking )
+{
+	int flag;
+	double start;
+
+	while ( request->state != ICOMP_DONE )
+	{
+		if ( blocking == true )
+		{
+			start = MPI_Wtime();
+			MPI_Waitall( (int)request->num_requests, request->requests, MPI_STATUSES_IGNORE );
+
+			if ( request->record_stats == true )
 			{
-				bs_send_image_size++;
+				composition_stats.wait_time += MPI_Wtime() - start;
 			}
-		#endif
+		}
+		else
+		{
+			MPI_Testall( (int)request->num_requests, request->requests, &flag, MPI_STATUSES_IGNORE );
+			if ( flag == 0 ) 
+			{
+				return false;
+			}
+		}
 
-		MPI_Isend( bs_send_image_ptr, bs_send_image_size * RGBAZ, MPI_FLOAT, bs_pair_node, PAIR_13_TAG, MPI_COMM_BSWAP, &isend );
-		MPI_Wait( &isend, &status );
-	}
-	
-	return EXIT_SUCCESS;
-}
+		if ( request->state == ICOMP_GATHER )
+		{
+			request->state = ICOMP_DONE;
+			continue;
+		}
+
+		icomp_blend_stage ( request );
+		request->cur_stage++;
 
+		if ( request->cur_stage < request->num_stages )
+		{
+			icomp_post_stage ( request );
+		}
+		else
+		{
+			icomp_post_gather ( request );
+		}
+	}
 
+	return true;
+}
@@ -26,6 +26,10 @@
 
 #include "merge.h"
 
+#ifdef _SIMDBLEND
+	#include <immintrin.h>
+#endif
+
 /*========================================================*/
 /**
  *  @brief Alpha-blend compositing (RGBA32 Pixels)
@@ -1391,6 +1395,293 @@ int composite_alpha_rgba32f \
 	return EXIT_SUCCESS;
 }
 
+/*===========================================================================*/
+/**
+ *  @brief Clamp a float value to 0.0 - 1.0 (Same as clamp_float)
+ *         Inlined so that the planar loops can be vectorized.
+ */
+/*===========================================================================*/
+static inline float clamp_float_unit ( const float val )
+{
+	return ( val > 1.0f ? 1.0f : val < 0.0f ? 0.0f : val );
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing (RGBA128 Planar Pixels)
+ *         R, G, B and A are stored in separate planes, so the 
+ *         loop runs over contiguous floats. Same arithmetic 
+ *         as composite_alpha_rgba128.
+ *
+ *  @param  over_planes  [in] R, G, B, A planes to be alpha blended
+ *  @param  under_planes [in] R, G, B, A planes to be alpha blended
+ *  @param  blend_planes [out] Alpha blended R, G, B, A planes
+ *  @param  image_size   [in] Image size
+ */
+/*===========================================================================*/
+int composite_alpha_rgba128_planar \
+	( float** over_planes, \
+	  float** under_planes, \
+	  float** blend_planes, \
+	  unsigned int image_size )
+{
+	unsigned int i;
+
+	float* over_r  = over_planes[ 0 ];
+	float* over_g  = over_planes[ 1 ];
+	float* over_b  = over_planes[ 2 ];
+	float* over_a  = over_planes[ 3 ];
+
+	float* under_r = under_planes[ 0 ];
+	float* under_g = under_planes[ 1 ];
+	float* under_b = under_planes[ 2 ];
+	float* under_a = under_planes[ 3 ];
+
+	float* blend_r = blend_planes[ 0 ];
+	float* blend_g = blend_planes[ 1 ];
+	float* blend_b = blend_planes[ 2 ];
+	float* blend_a = blend_planes[ 3 ];
+
+	float one_minus_alpha;
+	float r, g, b, a;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, one_minus_alpha, r, g, b, a ) 
+	#endif
+
+	for ( i = 0; i < image_size; i++ )
+	{
+		// Pre-calculate 1 - Src_A
+		one_minus_alpha = 1.0f - over_a[ i ];
+
+		a = over_a[ i ] + ( under_a[ i ] * one_minus_alpha );
+		r = over_r[ i ] + ( under_r[ i ] * one_minus_alpha );
+		g = over_g[ i ] + ( under_g[ i ] * one_minus_alpha );
+		b = over_b[ i ] + ( under_b[ i ] * one_minus_alpha );
+
+		blend_r[ i ] = clamp_float_unit( r );
+		blend_g[ i ] = clamp_float_unit( g );
+		blend_b[ i ] = clamp_float_unit( b );
+		blend_a[ i ] = clamp_float_unit( a );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth sorting and alpha-blend compositing 
+ *         (RGBAZ160 Planar Pixels). 
+ *         R, G, B, A and Z are stored in separate planes. 
+ *         Same arithmetic as composite_alpha_rgbaz160, with the 
+ *         depth sorting done by selection instead of branching.
+ *
+ *  @param  over_planes  [in] R, G, B, A, Z planes to be blended
+ *  @param  under_planes [in] R, G, B, A, Z planes to be blended
+ *  @param  blend_planes [out] Blended R, G, B, A, Z planes
+ *  @param  image_size   [in] Image size
+ */
+/*===========================================================================*/
+int composite_alpha_rgbaz160_planar \
+	( float** over_planes, \
+	  float** under_planes, \
+	  float** blend_planes, \
+	  unsigned int image_size )
+{
+	unsigned int i;
+
+	float* over_r  = over_planes[ 0 ];
+	float* over_g  = over_planes[ 1 ];
+	float* over_b  = over_planes[ 2 ];
+	float* over_a  = over_planes[ 3 ];
+	float* over_z  = over_planes[ 4 ];
+
+	float* under_r = under_planes[ 0 ];
+	float* under_g = under_planes[ 1 ];
+	float* under_b = under_planes[ 2 ];
+	float* under_a = under_planes[ 3 ];
+	float* under_z = under_planes[ 4 ];
+
+	float* blend_r = blend_planes[ 0 ];
+	float* blend_g = blend_planes[ 1 ];
+	float* blend_b = blend_planes[ 2 ];
+	float* blend_a = blend_planes[ 3 ];
+	float* blend_z = blend_planes[ 4 ];
+
+	float front_r, front_g, front_b, front_a, front_z;
+	float back_r,  back_g,  back_b,  back_a;
+	float one_minus_alpha;
+	float r, g, b, a;
+	_Bool swap;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, swap, one_minus_alpha, r, g, b, a, \
+				 front_r, front_g, front_b, front_a, front_z, \
+				 back_r,  back_g,  back_b,  back_a ) 
+	#endif
+
+	for ( i = 0; i < image_size; i++ )
+	{
+		// Depth sorting
+		swap = ( over_z[ i ] > under_z[ i ] );
+
+		front_r = swap ? under_r[ i ] : over_r[ i ];
+		front_g = swap ? under_g[ i ] : over_g[ i ];
+		front_b = swap ? under_b[ i ] : over_b[ i ];
+		front_a = swap ? under_a[ i ] : over_a[ i ];
+		front_z = swap ? under_z[ i ] : over_z[ i ];
+
+		back_r  = swap ? over_r[ i ] : under_r[ i ];
+		back_g  = swap ? over_g[ i ] : under_g[ i ];
+		back_b  = swap ? over_b[ i ] : under_b[ i ];
+		back_a  = swap ? over_a[ i ] : under_a[ i ];
+
+		// Pre-calculate 1 - Src_A
+		one_minus_alpha = 1.0f - front_a;
+
+		a = front_a + ( back_a * one_minus_alpha );
+		r = front_r + ( back_r * one_minus_alpha );
+		g = front_g + ( back_g * one_minus_alpha );
+		b = front_b + ( back_b * one_minus_alpha );
+
+		blend_r[ i ] = clamp_float_unit( r );
+		blend_g[ i ] = clamp_float_unit( g );
+		blend_b[ i ] = clamp_float_unit( b );
+		blend_a[ i ] = clamp_float_unit( a );
+		blend_z[ i ] = front_z;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ64 Split Pixels)
+ *         The RGBA values and the depth values are stored in 
+ *         separate segments ( See Do_234ZComposition ). Same 
+ *         result as composite_alpha_rgbaz64, with the depth 
+ *         sorting done by selection instead of branching.
+ *
+ *  @param  over_rgba   [in]  RGBA values to be blended
+ *  @param  over_z      [in]  Depth values to be blended
+ *  @param  under_rgba  [in]  RGBA values to be blended
+ *  @param  under_z     [in]  Depth values to be blended
+ *  @param  blend_rgba  [out] Blended RGBA values
+ *  @param  blend_z     [out] Blended depth values
+ *  @param  image_size  [in]  Image size
+ */
+/*===========================================================================*/
+int composite_alpha_rgbaz64_split \
+	( BYTE*  over_rgba,  float* over_z, \
+	  BYTE*  under_rgba, float* under_z, \
+	  BYTE*  blend_rgba, float* blend_z, \
+	  unsigned int image_size )
+{
+	unsigned int i;
+	unsigned int k;
+
+	BYTE* front_rgba;
+	_Bool swap;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, k, swap, front_rgba ) 
+	#endif
+
+	for ( i = 0; i < image_size; i++ )
+	{
+		// Depth sorting
+		swap = ( over_z[ i ] > under_z[ i ] );
+
+		front_rgba = swap ? under_rgba : over_rgba;
+
+		for ( k = 0; k < RGBA; k++ )
+		{
+			blend_rgba[ i * RGBA + k ] = front_rgba[ i * RGBA + k ];
+		}
+		blend_z[ i ] = swap ? under_z[ i ] : over_z[ i ];
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing (RGBAZ160 Split Pixels)
+ *         The RGBA values and the depth values are stored in 
+ *         separate segments ( See Do_234ZComposition ). Same 
+ *         arithmetic as composite_alpha_rgbaz160.
+ *
+ *  @param  over_rgba   [in]  RGBA values to be blended
+ *  @param  over_z      [in]  Depth values to be blended
+ *  @param  under_rgba  [in]  RGBA values to be blended
+ *  @param  under_z     [in]  Depth values to be blended
+ *  @param  blend_rgba  [out] Blended RGBA values
+ *  @param  blend_z     [out] Blended depth values
+ *  @param  image_size  [in]  Image size
+ */
+/*===========================================================================*/
+int composite_alpha_rgbaz160_split \
+	( float* over_rgba,  float* over_z, \
+	  float* under_rgba, float* under_z, \
+	  float* blend_rgba, float* blend_z, \
+	  unsigned int image_size )
+{
+	unsigned int i;
+
+	float* front;
+	float* back;
+	float  front_z;
+	float  one_minus_alpha;
+	float  r, g, b, a;
+	_Bool  swap;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, swap, front, back, front_z, one_minus_alpha, r, g, b, a ) 
+	#endif
+
+	for ( i = 0; i < image_size; i++ )
+	{
+		// Depth sorting
+		swap = ( over_z[ i ] > under_z[ i ] );
+
+		front   = ( swap ? under_rgba : over_rgba  ) + i * RGBA;
+		back    = ( swap ? over_rgba  : under_rgba ) + i * RGBA;
+		front_z =   swap ? under_z[ i ] : over_z[ i ];
+
+		// Pre-calculate 1 - Src_A
+		one_minus_alpha = 1.0f - front[ 3 ];
+
+		a = front[ 3 ] + ( back[ 3 ] * one_minus_alpha );
+		r = front[ 0 ] + ( back[ 0 ] * one_minus_alpha );
+		g = front[ 1 ] + ( back[ 1 ] * one_minus_alpha );
+		b = front[ 2 ] + ( back[ 2 ] * one_minus_alpha );
+
+		blend_rgba[ i * RGBA     ] = clamp_float_unit( r );
+		blend_rgba[ i * RGBA + 1 ] = clamp_float_unit( g );
+		blend_rgba[ i * RGBA + 2 ] = clamp_float_unit( b );
+		blend_rgba[ i * RGBA + 3 ] = clamp_float_unit( a );
+		blend_z[ i ] = front_z;
+	}
+
+	return EXIT_SUCCESS;
+}
+
 // =================================================================
 //				  	ALPHA BLENDING IMAGE COMPOSITION
 // =================================================================
@@ -1437,7 +1728,9 @@ void Create_AlphaBlend_LUT ( void )
 	for ( Alpha = 0; Alpha < 256; Alpha++ ) 
 	{
 		Alpha_Div_256 = Alpha << 8;
-		Alpha_Sub_255 = 255 - Alpha;
+
+		// Empty pixel ( Alpha = 0 ): Color kept unchanged
+		Alpha_Sub_255 = ( Alpha == 0 ) ? 256 : ( 255 - Alpha );
 
 		for ( Color = 0; Color < 256; Color++ ) 
 		{
@@ -1555,3 +1848,884 @@ void Create_AlphaBlend_LUT ( void )
 }
 
 
+
+#ifdef _SIMDBLEND
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing (RGBA32 Pixels) using SSE4.1.
+ *         Same arithmetic as the look-up tables: 
+ *         Blend = Sat( Over + (( 255 - Over_A ) * Under + 0x80 ) >> 8 ) 
+ *         ( 256 instead of 255 - Over_A for Over_A = 0 ) 
+ *         computed with 16-bit multiplications, 4 pixels at a time.
+ *         The remaining pixels are blended by composite_alpha_rgba32_LUT.
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "sse4.1" ) ))
+int composite_alpha_rgba32_sse41 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m128i over, under, alpha;
+	__m128i under_lo, under_hi;
+	__m128i alpha_lo, alpha_hi;
+
+	const __m128i zero      = _mm_setzero_si128();
+	const __m128i all_ones  = _mm_set1_epi8( (char)0xFF );
+	const __m128i round     = _mm_set1_epi16( 0x80 );
+	const __m128i empty     = _mm_set1_epi16( 0xFF );
+	const __m128i alpha_idx = _mm_set_epi8( 15, 15, 15, 15, 11, 11, 11, 11, \
+						 7,  7,  7,  7,  3,  3,  3,  3 );
+
+	num_blocks  = (int)( image_size / 4 ); // 4 Pixels per block
+	remain_size = image_size % 4;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over, under, alpha, \
+				 under_lo, under_hi, alpha_lo, alpha_hi ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		over  = _mm_loadu_si128( (__m128i *)( over_image  + i * 16 ));
+		under = _mm_loadu_si128( (__m128i *)( under_image + i * 16 ));
+
+		// 255 - Over_A replicated on R, G, B and A
+		alpha = _mm_xor_si128( _mm_shuffle_epi8( over, alpha_idx ), all_ones );
+
+		under_lo = _mm_unpacklo_epi8( under, zero );
+		under_hi = _mm_unpackhi_epi8( under, zero );
+		alpha_lo = _mm_unpacklo_epi8( alpha, zero );
+		alpha_hi = _mm_unpackhi_epi8( alpha, zero );
+
+		// 256 for an empty over pixel ( Under kept unchanged )
+		alpha_lo = _mm_sub_epi16( alpha_lo, _mm_cmpeq_epi16( alpha_lo, empty ));
+		alpha_hi = _mm_sub_epi16( alpha_hi, _mm_cmpeq_epi16( alpha_hi, empty ));
+
+		under_lo = _mm_srli_epi16( _mm_add_epi16( _mm_mullo_epi16( under_lo, alpha_lo ), round ), 8 );
+		under_hi = _mm_srli_epi16( _mm_add_epi16( _mm_mullo_epi16( under_hi, alpha_hi ), round ), 8 );
+
+		under = _mm_packus_epi16( under_lo, under_hi );
+
+		_mm_storeu_si128( (__m128i *)( blend_image + i * 16 ), _mm_adds_epu8( over, under ));
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgba32_LUT ( over_image  + num_blocks * 16, \
+					     under_image + num_blocks * 16, \
+					     blend_image + num_blocks * 16, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing (RGBA32 Pixels) using AVX2.
+ *         8 pixels at a time (See composite_alpha_rgba32_sse41).
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+int composite_alpha_rgba32_avx2 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m256i over, under, alpha;
+	__m256i under_lo, under_hi;
+	__m256i alpha_lo, alpha_hi;
+
+	const __m256i zero      = _mm256_setzero_si256();
+	const __m256i all_ones  = _mm256_set1_epi8( (char)0xFF );
+	const __m256i round     = _mm256_set1_epi16( 0x80 );
+	const __m256i empty     = _mm256_set1_epi16( 0xFF );
+	const __m256i alpha_idx = _mm256_set_epi8( 15, 15, 15, 15, 11, 11, 11, 11, \
+						    7,  7,  7,  7,  3,  3,  3,  3, \
+						   15, 15, 15, 15, 11, 11, 11, 11, \
+						    7,  7,  7,  7,  3,  3,  3,  3 );
+
+	num_blocks  = (int)( image_size / 8 ); // 8 Pixels per block
+	remain_size = image_size % 8;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over, under, alpha, \
+				 under_lo, under_hi, alpha_lo, alpha_hi ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		over  = _mm256_loadu_si256( (__m256i *)( over_image  + i * 32 ));
+		under = _mm256_loadu_si256( (__m256i *)( under_image + i * 32 ));
+
+		// 255 - Over_A replicated on R, G, B and A
+		alpha = _mm256_xor_si256( _mm256_shuffle_epi8( over, alpha_idx ), all_ones );
+
+		under_lo = _mm256_unpacklo_epi8( under, zero );
+		under_hi = _mm256_unpackhi_epi8( under, zero );
+		alpha_lo = _mm256_unpacklo_epi8( alpha, zero );
+		alpha_hi = _mm256_unpackhi_epi8( alpha, zero );
+
+		// 256 for an empty over pixel ( Under kept unchanged )
+		alpha_lo = _mm256_sub_epi16( alpha_lo, _mm256_cmpeq_epi16( alpha_lo, empty ));
+		alpha_hi = _mm256_sub_epi16( alpha_hi, _mm256_cmpeq_epi16( alpha_hi, empty ));
+
+		under_lo = _mm256_srli_epi16( _mm256_add_epi16( _mm256_mullo_epi16( under_lo, alpha_lo ), round ), 8 );
+		under_hi = _mm256_srli_epi16( _mm256_add_epi16( _mm256_mullo_epi16( under_hi, alpha_hi ), round ), 8 );
+
+		// Unpack and pack work within 128-bit lanes: pixel order is kept
+		under = _mm256_packus_epi16( under_lo, under_hi );
+
+		_mm256_storeu_si256( (__m256i *)( blend_image + i * 32 ), _mm256_adds_epu8( over, under ));
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgba32_sse41 ( over_image  + num_blocks * 32, \
+					       under_image + num_blocks * 32, \
+					       blend_image + num_blocks * 32, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing (RGBA32 Pixels) using AVX-512BW.
+ *         16 pixels at a time (See composite_alpha_rgba32_sse41).
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx512f,avx512bw" ) ))
+int composite_alpha_rgba32_avx512 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m512i over, under, alpha;
+	__m512i under_lo, under_hi;
+	__m512i alpha_lo, alpha_hi;
+
+	const __m512i zero      = _mm512_setzero_si512();
+	const __m512i all_ones  = _mm512_set1_epi8( (char)0xFF );
+	const __m512i round     = _mm512_set1_epi16( 0x80 );
+	const __m512i empty     = _mm512_set1_epi16( 0xFF );
+	const __m512i alpha_idx = _mm512_set4_epi32( 0x0F0F0F0F, 0x0B0B0B0B, 0x07070707, 0x03030303 );
+
+	num_blocks  = (int)( image_size / 16 ); // 16 Pixels per block
+	remain_size = image_size % 16;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over, under, alpha, \
+				 under_lo, under_hi, alpha_lo, alpha_hi ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		over  = _mm512_loadu_si512( (void *)( over_image  + i * 64 ));
+		under = _mm512_loadu_si512( (void *)( under_image + i * 64 ));
+
+		// 255 - Over_A replicated on R, G, B and A
+		alpha = _mm512_xor_si512( _mm512_shuffle_epi8( over, alpha_idx ), all_ones );
+
+		under_lo = _mm512_unpacklo_epi8( under, zero );
+		under_hi = _mm512_unpackhi_epi8( under, zero );
+		alpha_lo = _mm512_unpacklo_epi8( alpha, zero );
+		alpha_hi = _mm512_unpackhi_epi8( alpha, zero );
+
+		// 256 for an empty over pixel ( Under kept unchanged )
+		alpha_lo = _mm512_sub_epi16( alpha_lo, _mm512_movm_epi16( _mm512_cmpeq_epi16_mask( alpha_lo, empty )));
+		alpha_hi = _mm512_sub_epi16( alpha_hi, _mm512_movm_epi16( _mm512_cmpeq_epi16_mask( alpha_hi, empty )));
+
+		under_lo = _mm512_srli_epi16( _mm512_add_epi16( _mm512_mullo_epi16( under_lo, alpha_lo ), round ), 8 );
+		under_hi = _mm512_srli_epi16( _mm512_add_epi16( _mm512_mullo_epi16( under_hi, alpha_hi ), round ), 8 );
+
+		// Unpack and pack work within 128-bit lanes: pixel order is kept
+		under = _mm512_packus_epi16( under_lo, under_hi );
+
+		_mm512_storeu_si512( (void *)( blend_image + i * 64 ), _mm512_adds_epu8( over, under ));
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgba32_sse41 ( over_image  + num_blocks * 64, \
+					       under_image + num_blocks * 64, \
+					       blend_image + num_blocks * 64, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ64 Pixels) using AVX2.
+ *         The depth values of 8 pixels are compared at once and 
+ *         the nearest pixels are selected with masked moves.
+ *         The remaining pixels are processed by composite_alpha_rgbaz64.
+ *
+ *  @param  over_image  [in] Image to be depth composited
+ *  @param  under_image [in] Image to be depth composited
+ *  @param  blend_image [out] Depth composited image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+int composite_alpha_rgbaz64_avx2 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m256i over_0, over_1;
+	__m256i under_0, under_1;
+	__m256i mask_0, mask_1;
+
+	num_blocks  = (int)( image_size / 8 ); // 8 Pixels (2 x 4) per block
+	remain_size = image_size % 8;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over_0, over_1, under_0, under_1, mask_0, mask_1 ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		over_0  = _mm256_loadu_si256( (__m256i *)( over_image  + i * 64      ));
+		over_1  = _mm256_loadu_si256( (__m256i *)( over_image  + i * 64 + 32 ));
+		under_0 = _mm256_loadu_si256( (__m256i *)( under_image + i * 64      ));
+		under_1 = _mm256_loadu_si256( (__m256i *)( under_image + i * 64 + 32 ));
+
+		// Z is the upper 32-bit word of each pixel: 
+		// Over_Z > Under_Z is copied to the whole pixel
+		mask_0 = _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( over_0 ), \
+							     _mm256_castsi256_ps( under_0 ), _CMP_GT_OQ ));
+		mask_1 = _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( over_1 ), \
+							     _mm256_castsi256_ps( under_1 ), _CMP_GT_OQ ));
+		mask_0 = _mm256_shuffle_epi32( mask_0, _MM_SHUFFLE( 3, 3, 1, 1 ));
+		mask_1 = _mm256_shuffle_epi32( mask_1, _MM_SHUFFLE( 3, 3, 1, 1 ));
+
+		_mm256_storeu_si256( (__m256i *)( blend_image + i * 64      ), _mm256_blendv_epi8( over_0, under_0, mask_0 ));
+		_mm256_storeu_si256( (__m256i *)( blend_image + i * 64 + 32 ), _mm256_blendv_epi8( over_1, under_1, mask_1 ));
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgbaz64 ( over_image  + num_blocks * 64, \
+					  under_image + num_blocks * 64, \
+					  blend_image + num_blocks * 64, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ64 Pixels) using AVX-512.
+ *         16 pixels at a time (See composite_alpha_rgbaz64_avx2).
+ *
+ *  @param  over_image  [in] Image to be depth composited
+ *  @param  under_image [in] Image to be depth composited
+ *  @param  blend_image [out] Depth composited image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx512f" ) ))
+int composite_alpha_rgbaz64_avx512 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m512i over_0, over_1;
+	__m512i under_0, under_1;
+	__mmask16 mask_0, mask_1;
+
+	num_blocks  = (int)( image_size / 16 ); // 16 Pixels (2 x 8) per block
+	remain_size = image_size % 16;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over_0, over_1, under_0, under_1, mask_0, mask_1 ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		over_0  = _mm512_loadu_si512( (void *)( over_image  + i * 128      ));
+		over_1  = _mm512_loadu_si512( (void *)( over_image  + i * 128 + 64 ));
+		under_0 = _mm512_loadu_si512( (void *)( under_image + i * 128      ));
+		under_1 = _mm512_loadu_si512( (void *)( under_image + i * 128 + 64 ));
+
+		// Z is the upper 32-bit word of each pixel: 
+		// Over_Z > Under_Z is copied to the whole pixel
+		mask_0 = _mm512_cmp_ps_mask( _mm512_castsi512_ps( over_0 ), \
+					     _mm512_castsi512_ps( under_0 ), _CMP_GT_OQ ) & 0xAAAA;
+		mask_1 = _mm512_cmp_ps_mask( _mm512_castsi512_ps( over_1 ), \
+					     _mm512_castsi512_ps( under_1 ), _CMP_GT_OQ ) & 0xAAAA;
+		mask_0 |= ( mask_0 >> 1 );
+		mask_1 |= ( mask_1 >> 1 );
+
+		_mm512_storeu_si512( (void *)( blend_image + i * 128      ), _mm512_mask_blend_epi32( mask_0, over_0, under_0 ));
+		_mm512_storeu_si512( (void *)( blend_image + i * 128 + 64 ), _mm512_mask_blend_epi32( mask_1, over_1, under_1 ));
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgbaz64_avx2 ( over_image  + num_blocks * 128, \
+					       under_image + num_blocks * 128, \
+					       blend_image + num_blocks * 128, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth sorting and alpha-blending of 8 pixels (AVX2).
+ *         Same arithmetic as the scalar routines: the pixel with 
+ *         the smaller Z is blended over the other one, and the 
+ *         result is clamped to 0.0 - 1.0.
+ *
+ *  @param  over   [in]  R, G, B, A and Z of the over pixels
+ *  @param  under  [in]  R, G, B, A and Z of the under pixels
+ *  @param  blend  [out] R, G, B, A and Z of the blended pixels
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+static inline void sort_blend_avx2 ( __m256* over, __m256* under, __m256* blend )
+{
+	int k;
+
+	__m256 swap;
+	__m256 front[ RGBAZ ];
+	__m256 back [ RGBAZ ];
+	__m256 one_minus_alpha;
+
+	const __m256 zero = _mm256_setzero_ps();
+	const __m256 one  = _mm256_set1_ps( 1.0f );
+
+	// Depth sorting if necessary
+	swap = _mm256_cmp_ps( over[ 4 ], under[ 4 ], _CMP_GT_OQ );
+
+	for ( k = 0; k < RGBAZ; k++ )
+	{
+		front[ k ] = _mm256_blendv_ps( over [ k ], under[ k ], swap );
+		back [ k ] = _mm256_blendv_ps( under[ k ], over [ k ], swap );
+	}
+
+	// Pre-calculate 1 - Src_A
+	one_minus_alpha = _mm256_sub_ps( one, front[ 3 ] );
+
+	for ( k = 0; k < RGBA; k++ )
+	{
+		blend[ k ] = _mm256_add_ps( front[ k ], _mm256_mul_ps( back[ k ], one_minus_alpha ));
+
+		// Clamp (0.0 - 1.0)
+		blend[ k ] = _mm256_max_ps( zero, _mm256_min_ps( one, blend[ k ] ));
+	}
+
+	blend[ 4 ] = front[ 4 ];
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Load 8 RGBAZ88 or RGBAZ96 pixels (AVX2).
+ *         The R, G, B bytes and the A, Z floats are gathered from 
+ *         the interleaved pixels: 11 bytes (RGB A Z) or 12 bytes 
+ *         (RGBX A Z).
+ *
+ *  @param  image      [in]  Image data
+ *  @param  pixel_size [in]  RGBAZ88 or RGBAZ96
+ *  @param  pixel      [out] R, G, B (0.0 - 1.0), A and Z
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+static inline void load_rgbaz_byte_avx2 ( BYTE* image, int pixel_size, __m256* pixel )
+{
+	__m256i offset;
+	__m256i color;
+
+	const __m256i byte_mask = _mm256_set1_epi32( 0xFF );
+	const __m256  scale     = _mm256_set1_ps( 255.0f );
+
+	offset = _mm256_mullo_epi32( _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ), \
+				     _mm256_set1_epi32( pixel_size ));
+
+	// RGB bytes (and the first byte of A for RGBAZ88)
+	color = _mm256_i32gather_epi32( (int *)image, offset, 1 );
+
+	pixel[ 0 ] = _mm256_div_ps( _mm256_cvtepi32_ps( _mm256_and_si256( color, byte_mask )), scale );
+	pixel[ 1 ] = _mm256_div_ps( _mm256_cvtepi32_ps( _mm256_and_si256( _mm256_srli_epi32( color,  8 ), byte_mask )), scale );
+	pixel[ 2 ] = _mm256_div_ps( _mm256_cvtepi32_ps( _mm256_and_si256( _mm256_srli_epi32( color, 16 ), byte_mask )), scale );
+
+	// A and Z floats follow the RGB (RGBAZ88) or RGBX (RGBAZ96) bytes
+	offset = _mm256_add_epi32( offset, _mm256_set1_epi32( pixel_size - 2 * sizeof(float) ));
+
+	pixel[ 3 ] = _mm256_i32gather_ps( (float *)image, offset, 1 );
+	pixel[ 4 ] = _mm256_i32gather_ps( (float *)image, _mm256_add_epi32( offset, _mm256_set1_epi32( sizeof(float) )), 1 );
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Store 8 RGBAZ88 or RGBAZ96 pixels (AVX2).
+ *
+ *  @param  image      [out] Image data
+ *  @param  pixel_size [in]  RGBAZ88 or RGBAZ96
+ *  @param  pixel      [in]  R, G, B (0.0 - 1.0), A and Z
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+static inline void store_rgbaz_byte_avx2 ( BYTE* image, int pixel_size, __m256* pixel )
+{
+	int j;
+
+	int   color[ RGB ][ 8 ];
+	float alpha[ 8 ];
+	float depth[ 8 ];
+
+	const __m256 scale = _mm256_set1_ps( 255.0f );
+
+	_mm256_storeu_si256( (__m256i *)color[ 0 ], _mm256_cvttps_epi32( _mm256_mul_ps( pixel[ 0 ], scale )));
+	_mm256_storeu_si256( (__m256i *)color[ 1 ], _mm256_cvttps_epi32( _mm256_mul_ps( pixel[ 1 ], scale )));
+	_mm256_storeu_si256( (__m256i *)color[ 2 ], _mm256_cvttps_epi32( _mm256_mul_ps( pixel[ 2 ], scale )));
+	_mm256_storeu_ps( alpha, pixel[ 3 ] );
+	_mm256_storeu_ps( depth, pixel[ 4 ] );
+
+	for ( j = 0; j < 8; j++, image += pixel_size )
+	{
+		image[ 0 ] = (BYTE)color[ 0 ][ j ]; // R
+		image[ 1 ] = (BYTE)color[ 1 ][ j ]; // G
+		image[ 2 ] = (BYTE)color[ 2 ][ j ]; // B
+		if ( pixel_size == RGBAZ96 ) 
+		{
+			image[ 3 ] = (BYTE)0;       // X
+		}
+		memcpy( image + pixel_size - 2 * sizeof(float), &alpha[ j ], sizeof(float) ); // A
+		memcpy( image + pixel_size -     sizeof(float), &depth[ j ], sizeof(float) ); // Z
+	}
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ88 Pixels) using AVX2.
+ *         8 pixels at a time. The odd 11-byte pixels are gathered 
+ *         into separate R, G, B, A and Z vectors.
+ *         The remaining pixels are processed by composite_alpha_rgbaz88.
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+int composite_alpha_rgbaz88_avx2 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m256 over [ RGBAZ ];
+	__m256 under[ RGBAZ ];
+	__m256 blend[ RGBAZ ];
+
+	num_blocks  = (int)( image_size / 8 ); // 8 Pixels per block
+	remain_size = image_size % 8;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over, under, blend ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		load_rgbaz_byte_avx2 ( over_image  + i * 8 * RGBAZ88, RGBAZ88, over  );
+		load_rgbaz_byte_avx2 ( under_image + i * 8 * RGBAZ88, RGBAZ88, under );
+
+		sort_blend_avx2 ( over, under, blend );
+
+		store_rgbaz_byte_avx2 ( blend_image + i * 8 * RGBAZ88, RGBAZ88, blend );
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgbaz88 ( over_image  + num_blocks * 8 * RGBAZ88, \
+					  under_image + num_blocks * 8 * RGBAZ88, \
+					  blend_image + num_blocks * 8 * RGBAZ88, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ96 Pixels) using AVX2.
+ *         8 pixels at a time (See composite_alpha_rgbaz88_avx2).
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+int composite_alpha_rgbaz96_avx2 \
+	( BYTE* over_image, \
+	  BYTE* under_image, \
+	  BYTE* blend_image, \
+	  unsigned int  image_size )
+{
+	int i;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m256 over [ RGBAZ ];
+	__m256 under[ RGBAZ ];
+	__m256 blend[ RGBAZ ];
+
+	num_blocks  = (int)( image_size / 8 ); // 8 Pixels per block
+	remain_size = image_size % 8;
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, over, under, blend ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		load_rgbaz_byte_avx2 ( over_image  + i * 8 * RGBAZ96, RGBAZ96, over  );
+		load_rgbaz_byte_avx2 ( under_image + i * 8 * RGBAZ96, RGBAZ96, under );
+
+		sort_blend_avx2 ( over, under, blend );
+
+		store_rgbaz_byte_avx2 ( blend_image + i * 8 * RGBAZ96, RGBAZ96, blend );
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgbaz96 ( over_image  + num_blocks * 8 * RGBAZ96, \
+					  under_image + num_blocks * 8 * RGBAZ96, \
+					  blend_image + num_blocks * 8 * RGBAZ96, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/*===========================================================================*/
+/**
+ *  @brief Depth compositing (RGBAZ160 Pixels) using AVX2.
+ *         8 pixels at a time (See composite_alpha_rgbaz88_avx2).
+ *
+ *  @param  over_image  [in] Image to be alpha blended
+ *  @param  under_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ */
+/*===========================================================================*/
+__attribute__(( target( "avx2" ) ))
+int composite_alpha_rgbaz160_avx2 \
+	( float* over_image, \
+	  float* under_image, \
+	  float* blend_image, \
+	  unsigned int  image_size )
+{
+	int i, j, k;
+	int num_blocks;
+	unsigned int remain_size;
+
+	__m256i offset;
+
+	__m256 over [ RGBAZ ];
+	__m256 under[ RGBAZ ];
+	__m256 blend[ RGBAZ ];
+
+	float blend_f[ RGBAZ ][ 8 ];
+
+	num_blocks  = (int)( image_size / 8 ); // 8 Pixels per block
+	remain_size = image_size % 8;
+
+	offset = _mm256_setr_epi32( 0, 5, 10, 15, 20, 25, 30, 35 ); // 5 elements per pixel
+
+	//=====================================
+	//  	Shared Memory Parallelism
+	//=====================================
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for \
+			private( i, j, k, over, under, blend, blend_f ) 
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		for ( k = 0; k < RGBAZ; k++ )
+		{
+			over [ k ] = _mm256_i32gather_ps( over_image  + i * 8 * RGBAZ + k, offset, sizeof(float) );
+			under[ k ] = _mm256_i32gather_ps( under_image + i * 8 * RGBAZ + k, offset, sizeof(float) );
+		}
+
+		sort_blend_avx2 ( over, under, blend );
+
+		for ( k = 0; k < RGBAZ; k++ )
+		{
+			_mm256_storeu_ps( blend_f[ k ], blend[ k ] );
+		}
+
+		for ( j = 0; j < 8; j++ )
+		{
+			for ( k = 0; k < RGBAZ; k++ )
+			{
+				blend_image[ ( i * 8 + j ) * RGBAZ + k ] = blend_f[ k ][ j ];
+			}
+		}
+	}
+
+	if ( remain_size > 0 )
+	{
+		composite_alpha_rgbaz160 ( over_image  + num_blocks * 8 * RGBAZ, \
+					   under_image + num_blocks * 8 * RGBAZ, \
+					   blend_image + num_blocks * 8 * RGBAZ, remain_size );
+	}
+
+	return EXIT_SUCCESS;
+}
+#endif
+
+// Compositing routines selected by Select_AlphaBlend_SIMD
+int (*composite_alpha_rgba32_blend)  ( BYTE*,  BYTE*,  BYTE*,  unsigned int ) = composite_alpha_rgba32_LUT;
+int (*composite_alpha_rgbaz64_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ) = composite_alpha_rgbaz64;
+int (*composite_alpha_rgbaz88_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ) = composite_alpha_rgbaz88;
+int (*composite_alpha_rgbaz96_blend) ( BYTE*,  BYTE*,  BYTE*,  unsigned int ) = composite_alpha_rgbaz96;
+int (*composite_alpha_rgbaz160_blend)( float*, float*, float*, unsigned int ) = composite_alpha_rgbaz160;
+
+/*===========================================================================*/
+/**
+ *  @brief Select the compositing routines for RGBA32 (LUT) and 
+ *         RGBAZ pixels (composite_alpha_xxx_blend) according to 
+ *         the instruction sets supported by the CPU. 
+ *         The scalar routines are used when none is available.
+ */
+/*===========================================================================*/
+void Select_AlphaBlend_SIMD ( void )
+{
+	composite_alpha_rgba32_blend   = composite_alpha_rgba32_LUT;
+	composite_alpha_rgbaz64_blend  = composite_alpha_rgbaz64;
+	composite_alpha_rgbaz88_blend  = composite_alpha_rgbaz88;
+	composite_alpha_rgbaz96_blend  = composite_alpha_rgbaz96;
+	composite_alpha_rgbaz160_blend = composite_alpha_rgbaz160;
+
+	#ifdef _SIMDBLEND
+		__builtin_cpu_init();
+
+		if ( __builtin_cpu_supports( "avx512bw" ) )
+		{
+			composite_alpha_rgba32_blend = composite_alpha_rgba32_avx512;
+		}
+		else if ( __builtin_cpu_supports( "avx2" ) )
+		{
+			composite_alpha_rgba32_blend = composite_alpha_rgba32_avx2;
+		}
+		else if ( __builtin_cpu_supports( "sse4.1" ) )
+		{
+			composite_alpha_rgba32_blend = composite_alpha_rgba32_sse41;
+		}
+
+		if ( __builtin_cpu_supports( "avx2" ) )
+		{
+			composite_alpha_rgbaz64_blend  = composite_alpha_rgbaz64_avx2;
+			composite_alpha_rgbaz88_blend  = composite_alpha_rgbaz88_avx2;
+			composite_alpha_rgbaz96_blend  = composite_alpha_rgbaz96_avx2;
+			composite_alpha_rgbaz160_blend = composite_alpha_rgbaz160_avx2;
+		}
+
+		if ( __builtin_cpu_supports( "avx512f" ) )
+		{
+			composite_alpha_rgbaz64_blend  = composite_alpha_rgbaz64_avx512;
+		}
+	#endif
+}
+
+
+/*===========================================================================*/
+/**
+ *  @brief Alpha-blend compositing of a span encoded image 
+ *         (ALPHA_SPARSE) with a dense image (RGBA32 Pixels). 
+ *         Only the active pixels of the span encoded image are 
+ *         visited. Where one of the images is empty the other 
+ *         one is kept unchanged, and the look-up tables are used 
+ *         only where both images have active pixels. 
+ *         blend_image may be the same as dense_image.
+ *
+ *  @param  span_image  [in] Span encoded image
+ *  @param  dense_image [in] Image to be alpha blended
+ *  @param  blend_image [out] Alpha blended image
+ *  @param  image_size  [in] Image size
+ *  @param  order       [in] OVER or UNDER (span_image)
+ */
+/*===========================================================================*/
+int composite_alpha_rgba32_span \
+	( BYTE* span_image, \
+	  BYTE* dense_image, \
+	  BYTE* blend_image, \
+	  unsigned int image_size, \
+	  unsigned int order )
+{
+	unsigned int i;
+	unsigned int span, num_spans;
+	unsigned int empty_pixels, active_pixels;
+	unsigned int pixel;
+
+	unsigned int* span_list;
+
+	BYTE *active_ptr;
+	BYTE *dense_ptr;
+	BYTE *blend_ptr;
+	BYTE *over_ptr;
+	BYTE *under_ptr;
+
+	unsigned int Alpha_Div_256;
+
+	span_list  = (unsigned int *)span_image;
+	num_spans  = span_list[ 0 ];
+	active_ptr = span_image + ( 1 + 2 * num_spans ) * sizeof(unsigned int);
+
+	pixel = 0;
+	for ( span = 0; span < num_spans; span++ )
+	{
+		empty_pixels  = span_list[ 1 + 2 * span ];
+		active_pixels = span_list[ 2 + 2 * span ];
+
+		// Empty pixels: keep dense_image
+		if ( blend_image != dense_image ) 
+		{
+			memcpy( blend_image + pixel * RGBA32, dense_image + pixel * RGBA32, empty_pixels * RGBA32 );
+		}
+		pixel += empty_pixels;
+
+		dense_ptr = dense_image + pixel * RGBA32;
+		blend_ptr = blend_image + pixel * RGBA32;
+
+		for ( i = 0; i < active_pixels; i++ )
+		{
+			if (( active_ptr[ 0 ] | active_ptr[ 1 ] | active_ptr[ 2 ] | active_ptr[ 3 ] ) == 0 ) 
+			{
+				// Empty pixel in span_image (dense encoded spans)
+				blend_ptr[ 0 ] = dense_ptr[ 0 ];
+				blend_ptr[ 1 ] = dense_ptr[ 1 ];
+				blend_ptr[ 2 ] = dense_ptr[ 2 ];
+				blend_ptr[ 3 ] = dense_ptr[ 3 ];
+			}
+			else if (( dense_ptr[ 0 ] | dense_ptr[ 1 ] | dense_ptr[ 2 ] | dense_ptr[ 3 ] ) == 0 ) 
+			{
+				// Empty pixel in dense_image: keep span_image
+				blend_ptr[ 0 ] = active_ptr[ 0 ];
+				blend_ptr[ 1 ] = active_ptr[ 1 ];
+				blend_ptr[ 2 ] = active_ptr[ 2 ];
+				blend_ptr[ 3 ] = active_ptr[ 3 ];
+			}
+			else 
+			{
+				if ( order == OVER ) 
+				{
+					over_ptr  = active_ptr;
+					under_ptr = dense_ptr;
+				}
+				else 
+				{
+					over_ptr  = dense_ptr;
+					under_ptr = active_ptr;
+				}
+
+				Alpha_Div_256 = ((unsigned int)over_ptr[ 3 ]) << 8;
+
+				blend_ptr[ 0 ] = (BYTE)LUT_Sat[ ((unsigned int)LUT_Mult[ \
+							Alpha_Div_256 | ((unsigned int)under_ptr[ 0 ] ) ] ) \
+							+ ((unsigned int)over_ptr[ 0 ] ) ];
+				blend_ptr[ 1 ] = (BYTE)LUT_Sat[ ((unsigned int)LUT_Mult[ \
+							Alpha_Div_256 | ((unsigned int)under_ptr[ 1 ] ) ] ) \
+							+ ((unsigned int)over_ptr[ 1 ] ) ];
+				blend_ptr[ 2 ] = (BYTE)LUT_Sat[ ((unsigned int)LUT_Mult[ \
+							Alpha_Div_256 | ((unsigned int)under_ptr[ 2 ] ) ] ) \
+							+ ((unsigned int)over_ptr[ 2 ] ) ];
+				blend_ptr[ 3 ] = (BYTE)LUT_Sat[ ((unsigned int)LUT_Mult[ \
+							Alpha_Div_256 | ((unsigned int)under_ptr[ 3 ] ) ] ) \
+							+ ((unsigned int)over_ptr[ 3 ] ) ];
+			}
+
+			active_ptr += RGBA32;
+			dense_ptr  += RGBA32;
+			blend_ptr  += RGBA32;
+		}
+		pixel += active_pixels;
+	}
+
+	// Trailing empty pixels: keep dense_image
+	if (( blend_image != dense_image ) && ( pixel < image_size ))
+	{
+		memcpy( blend_image + pixel * RGBA32, dense_image + pixel * RGBA32, ( image_size - pixel ) * RGBA32 );
+	}
+
+	return EXIT_SUCCESS;
+}
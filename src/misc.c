@@ -20,6 +20,10 @@
 
 #include "misc.h"
 
+#ifndef _NOHUGEPAGE
+	#include <sys/mman.h> // madvise
+#endif
+
 /*========================================================*/
 /**
  *  @brief Clamp a floating value using the min-max range
@@ -148,6 +152,76 @@ unsigned int bitrevorder ( unsigned int rank, unsigned int nnodes )
 	return ( bitrev_my_rank );
 }
 
+/*========================================================*/
+/**
+ *  @brief Clear a memory region in parallel. The threads 
+ *         clear contiguous blocks in the same static 
+ *         schedule as the merge routines, so that the first 
+ *         touch places the pages on the NUMA node of the 
+ *         thread that processes them.
+ *
+ *  @param  mem_region [in] Memory region
+ *  @param  mem_bytes  [in] Size in bytes
+ */
+/*========================================================*/
+void clear_memory_region ( void* mem_region, size_t mem_bytes ) 
+{
+	long   i, num_blocks;
+	size_t block_bytes;
+
+	num_blocks = (long)(( mem_bytes + MEMORY_TOUCH_BLOCK - 1 ) / MEMORY_TOUCH_BLOCK );
+
+	#if defined ( _OPENMP ) 
+		#pragma omp parallel for schedule( static ) private( i, block_bytes ) \
+			if ( num_blocks > 1 )
+	#endif
+
+	for ( i = 0; i < num_blocks; i++ )
+	{
+		block_bytes = mem_bytes - (size_t)i * MEMORY_TOUCH_BLOCK;
+		if ( block_bytes > MEMORY_TOUCH_BLOCK ) block_bytes = MEMORY_TOUCH_BLOCK;
+
+		memset( (BYTE *)mem_region + (size_t)i * MEMORY_TOUCH_BLOCK, 0x00, block_bytes );
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Allocate a cleared memory region aligned to 
+ *         MEMORY_ALIGNMENT bytes. Regions of HUGE_PAGE_SIZE 
+ *         bytes or larger are aligned to the huge page size 
+ *         and advised to be backed by huge pages. 
+ *         The region is released by free().
+ *
+ *  @param  mem_bytes [in] Size in bytes
+ *  @return Allocated memory region ( NULL: Not enough memory )
+ */
+/*========================================================*/
+static void *allocate_aligned_memory_region ( size_t mem_bytes ) 
+{
+	void*  mem_region;
+	size_t alignment;
+
+	alignment = ( mem_bytes >= HUGE_PAGE_SIZE ) ? HUGE_PAGE_SIZE : MEMORY_ALIGNMENT;
+
+	if ( posix_memalign( &mem_region, alignment, ( mem_bytes > 0 ) ? mem_bytes : 1 ) != 0 ) 
+	{
+		return NULL;
+	}
+
+#if defined ( MADV_HUGEPAGE ) && !defined ( _NOHUGEPAGE )
+	// Advice only: ignored where huge pages are not available
+	if ( alignment == HUGE_PAGE_SIZE ) 
+	{
+		madvise( mem_region, mem_bytes & ~( (size_t)HUGE_PAGE_SIZE - 1 ), MADV_HUGEPAGE );
+	}
+#endif
+
+	clear_memory_region( mem_region, mem_bytes );
+
+	return mem_region;
+}
+
 /*========================================================*/
 /**
  *  @brief Allocate memory region (BYTE data) 
@@ -156,17 +230,15 @@ unsigned int bitrevorder ( unsigned int rank, unsigned int nnodes )
  *  @return Allocated memory region 
  */
 /*========================================================*/
-BYTE *allocate_byte_memory_region ( unsigned int mem_size ) 
+BYTE *allocate_byte_memory_region ( size_t mem_size ) 
 {
 	BYTE *mem_region;
 
-	if (( mem_region = (BYTE *)malloc( sizeof(BYTE) * mem_size )) == NULL) 
+	if (( mem_region = (BYTE *)allocate_aligned_memory_region( sizeof(BYTE) * mem_size )) == NULL) 
 	{ 
        	printf( "<<< ERROR >> Cannot allocate memory for BYTE Data \n" );
       		return NULL;
 	}
-	
-	memset( mem_region, 0x00, sizeof(BYTE) * mem_size );
 
 	return (BYTE *)mem_region;
 }
@@ -179,17 +251,15 @@ BYTE *allocate_byte_memory_region ( unsigned int mem_size )
  *  @return Allocated memory region 
  */
 /*========================================================*/
-float *allocate_float_memory_region ( unsigned int mem_size ) 
+float *allocate_float_memory_region ( size_t mem_size ) 
 {
 	float *mem_region;
 
-	if (( mem_region = (float *)malloc( sizeof(float) * mem_size )) == NULL) 
+	if (( mem_region = (float *)allocate_aligned_memory_region( sizeof(float) * mem_size )) == NULL) 
 	{ 
        	printf( "<<< ERROR >> Cannot allocate memory for FLOAT Data \n" );
       		return NULL;
 	}
-	
-	memset( mem_region, 0x00, sizeof(float) * mem_size );
 
 	return (float *)mem_region;
 }
@@ -203,18 +273,470 @@ float *allocate_float_memory_region ( unsigned int mem_size )
  *  @return Allocated memory region 
  */
 /*========================================================*/
-unsigned int *allocate_int_memory_region ( unsigned int mem_size ) 
+unsigned int *allocate_int_memory_region ( size_t mem_size ) 
 {
 	unsigned int *mem_region;
 
-	if (( mem_region = (unsigned int *)malloc( sizeof(unsigned int) * mem_size )) == NULL) 
+	if (( mem_region = (unsigned int *)allocate_aligned_memory_region( sizeof(unsigned int) * mem_size )) == NULL) 
 	{ 
        	printf( "<<< ERROR >> Cannot allocate memory for INT Data \n" );
       		return NULL;
 	}
-	
-	memset( mem_region, 0x00, sizeof(unsigned int) * mem_size );
 
 	return (unsigned int *)mem_region;
 }
 
+/*========================================================*/
+/**
+ *  @brief Allocate a cleared memory region of at least 
+ *         mem_size bytes. The smallest region of the pool 
+ *         large enough is reused, otherwise a new region 
+ *         is allocated.
+ *
+ *  @param  pool     [in] Released regions ( MEMORY_POOL_ENTRIES )
+ *  @param  mem_size [in] Size in bytes
+ *  @return Allocated memory region ( NULL: Not enough memory )
+ */
+/*========================================================*/
+void* allocate_pooled_memory_region ( struct Compositor234_Memory* pool, size_t mem_size ) 
+{
+	unsigned int i, best;
+	void* mem_region;
+
+	best = MEMORY_POOL_ENTRIES;
+	for ( i = 0; i < MEMORY_POOL_ENTRIES; i++ )
+	{
+		if (( pool[ i ].region == NULL ) || ( pool[ i ].size < mem_size )) continue;
+
+		if (( best == MEMORY_POOL_ENTRIES ) || ( pool[ i ].size < pool[ best ].size )) 
+			best = i;
+	}
+
+	if ( best == MEMORY_POOL_ENTRIES ) 
+	{
+		return (void *)allocate_byte_memory_region( mem_size );
+	}
+
+	mem_region = pool[ best ].region;
+	pool[ best ].region = NULL;
+	pool[ best ].size   = 0;
+
+	clear_memory_region( mem_region, mem_size );
+
+	return mem_region;
+}
+
+/*========================================================*/
+/**
+ *  @brief Keep a region allocated by allocate_pooled_memory_region 
+ *         for reuse. When the pool is full, the smallest 
+ *         of the regions is freed.
+ *
+ *  @param  pool       [in] Released regions ( MEMORY_POOL_ENTRIES )
+ *  @param  mem_region [in] Memory region ( NULL: None )
+ *  @param  mem_size   [in] Size in bytes
+ */
+/*========================================================*/
+void release_pooled_memory_region ( struct Compositor234_Memory* pool, void* mem_region, size_t mem_size ) 
+{
+	unsigned int i, entry;
+
+	if ( mem_region == NULL ) return;
+
+	// Empty entry, otherwise the smallest region
+	entry = 0;
+	for ( i = 0; i < MEMORY_POOL_ENTRIES; i++ )
+	{
+		if ( pool[ i ].region == NULL ) {
+			entry = i;
+			break;
+		}
+
+		if ( pool[ i ].size < pool[ entry ].size ) entry = i;
+	}
+
+	if ( pool[ entry ].region != NULL ) 
+	{
+		if ( pool[ entry ].size >= mem_size ) {
+			free( mem_region );
+			return;
+		}
+
+		free( pool[ entry ].region );
+	}
+
+	pool[ entry ].region = mem_region;
+	pool[ entry ].size   = mem_size;
+}
+
+/*========================================================*/
+/**
+ *  @brief Free the regions kept in the pool
+ *
+ *  @param  pool [in] Released regions ( MEMORY_POOL_ENTRIES )
+ */
+/*========================================================*/
+void free_memory_pool ( struct Compositor234_Memory* pool ) 
+{
+	unsigned int i;
+
+	for ( i = 0; i < MEMORY_POOL_ENTRIES; i++ )
+	{
+		if ( pool[ i ].region != NULL ) 
+			free( pool[ i ].region );
+
+		pool[ i ].region = NULL;
+		pool[ i ].size   = 0;
+	}
+}
+
+/*========================================================*/
+/**
+ *  @brief Get the bounding rectangle of the pixels with 
+ *         non-zero alpha (ALPHA_ROI and DEPTH_ROI). 
+ *         An image without such pixels gets an empty 
+ *         rectangle ( x_min == x_max ).
+ *
+ *  @param  image    [in]  Image data
+ *  @param  width    [in]  Image width
+ *  @param  height   [in]  Image height
+ *  @param  pixel_ID [in]  Pixel type
+ *  @param  roi      [out] ROI ( x_min, y_min, x_max, y_max ) 
+ *                         x_max and y_max are not included
+ */
+/*========================================================*/
+void get_image_roi ( void* image, unsigned int width, unsigned int height, \
+		     unsigned int pixel_ID, int* roi )
+{
+	unsigned int x, y;
+	unsigned int pixel_size;
+	unsigned int alpha_offset;
+
+	int x_min, y_min, x_max, y_max;
+
+	BYTE* image_ptr;
+	float alpha;
+	_Bool  is_float;
+
+	// Location of the alpha value in each pixel type
+	switch ( pixel_ID ) {
+		case ID_RGBA32:   pixel_size = RGBA32;   alpha_offset = 3; is_float = false; break;
+		case ID_RGBAZ64:  pixel_size = RGBAZ64;  alpha_offset = 3; is_float = false; break;
+		case ID_RGBA56:   pixel_size = RGBA56;   alpha_offset = 3; is_float = true;  break;
+		case ID_RGBAZ88:  pixel_size = RGBAZ88;  alpha_offset = 3; is_float = true;  break;
+		case ID_RGBA64:   pixel_size = RGBA64;   alpha_offset = 4; is_float = true;  break;
+		case ID_RGBAZ96:  pixel_size = RGBAZ96;  alpha_offset = 4; is_float = true;  break;
+		case ID_RGBA128:  pixel_size = RGBA128;  alpha_offset = 3 * sizeof(float); is_float = true; break;
+		case ID_RGBAZ160: pixel_size = RGBAZ160; alpha_offset = 3 * sizeof(float); is_float = true; break;
+		default: 
+			roi[ 0 ] = roi[ 1 ] = roi[ 2 ] = roi[ 3 ] = 0;
+			return;
+	}
+
+	x_min = (int)width;
+	y_min = (int)height;
+	x_max = 0;
+	y_max = 0;
+
+	image_ptr = (BYTE *)image + alpha_offset;
+	for ( y = 0; y < height; y++ )
+	{
+		for ( x = 0; x < width; x++, image_ptr += pixel_size )
+		{
+			if ( is_float == true ) 
+			{
+				memcpy( &alpha, image_ptr, sizeof(float) );
+				if ( alpha == 0.0f ) continue;
+			}
+			else if ( *image_ptr == 0 ) 
+			{
+				continue;
+			}
+
+			if ( (int)x <  x_min ) x_min = (int)x;
+			if ( (int)x >= x_max ) x_max = (int)x + 1;
+			if ( (int)y <  y_min ) y_min = (int)y;
+			y_max = (int)y + 1;
+		}
+	}
+
+	if ( x_max == 0 ) 
+	{
+		// Empty image
+		x_min = y_min = 0;
+	}
+
+	roi[ 0 ] = x_min;
+	roi[ 1 ] = y_min;
+	roi[ 2 ] = x_max;
+	roi[ 3 ] = y_max;
+}
+
+// Domain of a node and its sort key
+struct DomainKey {
+	int   rank;
+	float key;
+} ;
+
+/*========================================================*/
+/**
+ *  @brief Compare two domains by their sort key 
+ *         ( Ties in rank order )
+*/
+/*========================================================*/
+static int compare_domain_keys ( const void* a, const void* b )
+{
+	const struct DomainKey *x, *y;
+
+	x = (const struct DomainKey *)a;
+	y = (const struct DomainKey *)b;
+
+	if ( x -> key < y -> key ) return -1;
+	if ( x -> key > y -> key ) return  1;
+
+	return ( x -> rank ) - ( y -> rank );
+}
+
+/*========================================================*/
+/**
+ *  @brief Sort a list of domains in visibility order 
+ *         (kd-tree traversal). The list is split by the 
+ *         axis-aligned plane that separates it in the 
+ *         most balanced way, and the side facing the 
+ *         viewer is placed first. Domains that cannot be 
+ *         separated by such a plane are sorted by the 
+ *         distance of their centers along the view direction.
+ *
+ *  @param  list           [in,out] Ranks of the domains
+ *  @param  count          [in]  Number of domains in the list
+ *  @param  bounds         [in]  Bounding box of each rank
+ *  @param  view_direction [in]  View direction
+ *  @param  work           [in]  Work area ( count entries )
+*/
+/*========================================================*/
+static void sort_domains ( int* list, unsigned int count, const float* bounds, \
+			   const float* view_direction, struct DomainKey* work )
+{
+	unsigned int i, axis;
+	unsigned int split, best_split, best_axis, balance, best_balance;
+
+	const float* box;
+	float max_end;
+
+	if ( count <= 1 ) return;
+
+	best_axis    = 3;
+	best_split   = 0;
+	best_balance = count;
+
+	// Look for the most balanced separating plane
+	for ( axis = 0; axis < 3; axis++ )
+	{
+		for ( i = 0; i < count; i++ ) {
+			work[ i ].rank = list[ i ];
+			work[ i ].key  = bounds[ 6 * list[ i ] + axis ];
+		}
+
+		qsort( work, count, sizeof(struct DomainKey), compare_domain_keys );
+
+		max_end = bounds[ 6 * work[ 0 ].rank + 3 + axis ];
+		for ( split = 1; split < count; split++ )
+		{
+			// Every domain before the split ends 
+			// before the domains after it start
+			if ( max_end <= work[ split ].key ) 
+			{
+				balance = ( 2 * split > count ) ? ( 2 * split - count ) : ( count - 2 * split );
+				if ( balance < best_balance ) {
+					best_balance = balance;
+					best_split   = split;
+					best_axis    = axis;
+				}
+			}
+
+			box = bounds + 6 * work[ split ].rank;
+			if ( box[ 3 + axis ] > max_end ) max_end = box[ 3 + axis ];
+		}
+	}
+
+	if ( best_axis == 3 ) 
+	{
+		// Overlapping domains: distance along the view direction
+		for ( i = 0; i < count; i++ ) {
+			box = bounds + 6 * list[ i ];
+			work[ i ].rank = list[ i ];
+			work[ i ].key  = ( box[ 0 ] + box[ 3 ] ) * view_direction[ 0 ] + \
+					 ( box[ 1 ] + box[ 4 ] ) * view_direction[ 1 ] + \
+					 ( box[ 2 ] + box[ 5 ] ) * view_direction[ 2 ];
+		}
+
+		qsort( work, count, sizeof(struct DomainKey), compare_domain_keys );
+
+		for ( i = 0; i < count; i++ ) {
+			list[ i ] = work[ i ].rank;
+		}
+		return;
+	}
+
+	for ( i = 0; i < count; i++ ) {
+		work[ i ].rank = list[ i ];
+		work[ i ].key  = bounds[ 6 * list[ i ] + best_axis ];
+	}
+
+	qsort( work, count, sizeof(struct DomainKey), compare_domain_keys );
+
+	// Looking towards +axis: the lower side is in front
+	if ( view_direction[ best_axis ] >= 0.0f ) 
+	{
+		for ( i = 0; i < count; i++ ) {
+			list[ i ] = work[ i ].rank;
+		}
+	}
+	else 
+	{
+		for ( i = 0; i < count - best_split; i++ ) {
+			list[ i ] = work[ best_split + i ].rank;
+		}
+		for ( i = 0; i < best_split; i++ ) {
+			list[ count - best_split + i ] = work[ i ].rank;
+		}
+		best_split = count - best_split;
+	}
+
+	sort_domains ( list, best_split, bounds, view_direction, work );
+	sort_domains ( list + best_split, count - best_split, bounds, view_direction, work );
+}
+
+/*========================================================*/
+/**
+ *  @brief Visibility order of the domains of the nodes
+ *         for a view direction (closest first)
+ *
+ *  @param  nnodes         [in]  Number of nodes
+ *  @param  bounds         [in]  Bounding box of each rank 
+ *                               ( x, y, z min and x, y, z max )
+ *  @param  view_direction [in]  View direction ( x, y, z )
+ *  @param  order          [out] Rank of each position
+ *  @return EXIT_SUCCESS or EXIT_FAILURE
+*/
+/*========================================================*/
+int get_visibility_order ( unsigned int nnodes, const float* bounds, \
+			   const float* view_direction, int* order )
+{
+	unsigned int i;
+	struct DomainKey* work;
+
+	if (( work = (struct DomainKey *)malloc ( nnodes * sizeof(struct DomainKey) )) == NULL ) {
+		printf( "<<< ERROR >> Cannot allocate memory for the visibility order \n" );
+		return EXIT_FAILURE;
+	}
+
+	for ( i = 0; i < nnodes; i++ ) {
+		order[ i ] = (int)i;
+	}
+
+	sort_domains ( order, nnodes, bounds, view_direction, work );
+
+	free ( work );
+
+	return EXIT_SUCCESS;
+}
+
+// Node and its placement key
+struct PlacementKey {
+	int                rank;
+	unsigned long long key;
+} ;
+
+/*========================================================*/
+/**
+ *  @brief Compare two nodes by their placement key 
+ *         ( Ties in rank order )
+*/
+/*========================================================*/
+static int compare_placement_keys ( const void* a, const void* b )
+{
+	const struct PlacementKey *x, *y;
+
+	x = (const struct PlacementKey *)a;
+	y = (const struct PlacementKey *)b;
+
+	if ( x -> key < y -> key ) return -1;
+	if ( x -> key > y -> key ) return  1;
+
+	return ( x -> rank ) - ( y -> rank );
+}
+
+/*========================================================*/
+/**
+ *  @brief Placement order of the nodes from their network 
+ *         coordinates. The nodes are sorted along the 
+ *         Z-order (Morton) curve of their coordinates, so 
+ *         that the halves, quarters, ... of the order, and 
+ *         the groups of consecutive nodes, are close in the 
+ *         network. Nodes with the same coordinates are kept 
+ *         together in rank order.
+ *
+ *  @param  nnodes [in]  Number of nodes
+ *  @param  coords [in]  Coordinates of each rank ( ndims per rank )
+ *  @param  ndims  [in]  Number of coordinates per rank
+ *  @param  order  [out] Rank of each position
+ *  @return EXIT_SUCCESS or EXIT_FAILURE
+*/
+/*========================================================*/
+int get_placement_order ( unsigned int nnodes, const int* coords, \
+			  unsigned int ndims, int* order )
+{
+	unsigned int i, d, b;
+	unsigned int bits;		// Bits per coordinate
+	unsigned int coord;
+
+	int* min_coords;
+	struct PlacementKey* work;
+
+	work       = (struct PlacementKey *)malloc ( nnodes * sizeof(struct PlacementKey) );
+	min_coords = (int *)malloc ( ndims * sizeof(int) );
+
+	if (( work == NULL ) || ( min_coords == NULL )) {
+		printf( "<<< ERROR >> Cannot allocate memory for the placement order \n" );
+		free ( work );
+		free ( min_coords );
+		return EXIT_FAILURE;
+	}
+
+	// Coordinates from 0 ( Torus coordinates may be negative )
+	for ( d = 0; d < ndims; d++ ) {
+		min_coords[ d ] = coords[ d ];
+		for ( i = 1; i < nnodes; i++ ) {
+			if ( coords[ i * ndims + d ] < min_coords[ d ] ) min_coords[ d ] = coords[ i * ndims + d ];
+		}
+	}
+
+	bits = ( 8 * sizeof(unsigned long long) ) / ndims;
+	if ( bits > 32 ) bits = 32;
+
+	// Interleave the bits of the coordinates ( Last coordinate: lowest bit )
+	for ( i = 0; i < nnodes; i++ ) {
+		work[ i ].rank = (int)i;
+		work[ i ].key  = 0;
+
+		for ( d = 0; d < ndims; d++ ) {
+			coord = (unsigned int)( coords[ i * ndims + d ] - min_coords[ d ] );
+
+			for ( b = 0; b < bits; b++ ) {
+				work[ i ].key |= (unsigned long long)(( coord >> b ) & 1 ) << ( b * ndims + ( ndims - 1 - d ));
+			}
+		}
+	}
+
+	qsort( work, nnodes, sizeof(struct PlacementKey), compare_placement_keys );
+
+	for ( i = 0; i < nnodes; i++ ) {
+		order[ i ] = work[ i ].rank;
+	}
+
+	free ( work );
+	free ( min_coords );
+
+	return EXIT_SUCCESS;
+}